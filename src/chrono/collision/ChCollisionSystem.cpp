@@ -51,6 +51,21 @@ void ChCollisionSystem::UnbindItem(std::shared_ptr<ChPhysicsItem> item) {
     item->RemoveCollisionModelsFromSystem(this);
 }
 
+int ChCollisionSystem::RayHitBatch(const std::vector<ChVector3d>& from,
+                                   const std::vector<ChVector3d>& to,
+                                   std::vector<ChRayhitResult>& results) const {
+    assert(from.size() == to.size());
+    results.resize(from.size());
+
+    int num_hits = 0;
+    for (size_t i = 0; i < from.size(); i++) {
+        if (RayHit(from[i], to[i], results[i]))
+            num_hits++;
+    }
+
+    return num_hits;
+}
+
 void ChCollisionSystem::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChCollisionSystem>();
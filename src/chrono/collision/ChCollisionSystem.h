@@ -186,6 +186,16 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Perform a batch of ray-hit tests with the collision models.
+    /// The i-th ray goes from 'from[i]' to 'to[i]'. On return, 'results' has the same size as the input arrays and
+    /// its i-th entry holds the closest hit (if any) of the i-th ray. Return the number of rays with a hit.
+    /// The default implementation calls RayHit() for each ray in turn. Derived classes may override it to amortize
+    /// the cost of traversing the broadphase and to process the rays in parallel; rays are most efficiently processed
+    /// if neighboring entries in the input arrays are spatially coherent.
+    virtual int RayHitBatch(const std::vector<ChVector3d>& from,
+                            const std::vector<ChVector3d>& to,
+                            std::vector<ChRayhitResult>& results) const;
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
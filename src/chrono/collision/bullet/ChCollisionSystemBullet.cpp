@@ -37,7 +37,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 CH_UPCASTING(ChCollisionSystemBullet, ChCollisionSystem)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr), m_num_threads(1) {
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
 #ifdef BT_USE_OPENMP
@@ -125,6 +125,7 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
 }
 
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    m_num_threads = std::max(1, nthreads);
 #ifdef BT_USE_OPENMP
     cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
 #endif
@@ -212,90 +213,98 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
     // This should remove all old contacts (or at least rewind the index)
     mcontactcontainer->BeginAddContact();
 
+    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
+
+    // User callbacks are not required to be thread-safe; if any is present, process all manifolds serially.
+    int nthreads = (broad_callback || narrow_callback) ? 1 : m_num_threads;
+
+    // Convert contiguous chunks of manifolds into per-chunk lists of collision info objects, then pass these lists to
+    // the contact container in chunk order. The order of contacts is therefore independent of the number of threads.
+    int num_chunks = std::max(1, std::min(numManifolds, 4 * nthreads));
+    m_contact_buffers.resize(num_chunks);
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthreads) if (nthreads > 1)
+    for (int ic = 0; ic < num_chunks; ic++) {
+        auto& buffer = m_contact_buffers[ic];
+        buffer.clear();
+        int start = (int)((long long)numManifolds * ic / num_chunks);
+        int end = (int)((long long)numManifolds * (ic + 1) / num_chunks);
+        for (int i = start; i < end; i++)
+            ReportManifold(bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i), buffer);
+    }
+
+    for (const auto& buffer : m_contact_buffers)
+        mcontactcontainer->AddContacts(buffer);
+
+    mcontactcontainer->EndAddContact();
+}
+
+void ChCollisionSystemBullet::ReportManifold(cbtPersistentManifold* contactManifold,
+                                             std::vector<ChCollisionInfo>& contacts) {
     // NOTE: Bullet does not provide information on radius of curvature at a contact point.
     // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
     ChCollisionInfo icontact;
 
-    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
-    for (int i = 0; i < numManifolds; i++) {
-        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
-        const cbtCollisionObject* obA = contactManifold->getBody0();
-        const cbtCollisionObject* obB = contactManifold->getBody1();
-        contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
+    const cbtCollisionObject* obA = contactManifold->getBody0();
+    const cbtCollisionObject* obB = contactManifold->getBody1();
+    contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
 
-        auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
-        auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
-
-        icontact.modelA = bt_modelA->model;
-        icontact.modelB = bt_modelB->model;
+    auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
+    auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
 
-        double envelopeA = icontact.modelA->GetEnvelope();
-        double envelopeB = icontact.modelB->GetEnvelope();
+    icontact.modelA = bt_modelA->model;
+    icontact.modelB = bt_modelB->model;
 
-        double marginA = icontact.modelA->GetSafeMargin();
-        double marginB = icontact.modelB->GetSafeMargin();
+    double envelopeA = icontact.modelA->GetEnvelope();
+    double envelopeB = icontact.modelB->GetEnvelope();
 
-        // Execute custom broadphase callback, if any
-        bool do_narrow_contactgeneration = true;
-        if (broad_callback)
-            do_narrow_contactgeneration = broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+    double marginA = icontact.modelA->GetSafeMargin();
+    double marginB = icontact.modelB->GetSafeMargin();
 
-        if (do_narrow_contactgeneration) {
-            int numContacts = contactManifold->getNumContacts();
-            // std::cout << "numContacts=" << numContacts << std::endl;
-            for (int j = 0; j < numContacts; j++) {
-                cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
+    // Execute custom broadphase callback, if any
+    if (broad_callback && !broad_callback->OnBroadphase(icontact.modelA, icontact.modelB))
+        return;
 
-                // Discard "too far" constraints (the Bullet engine also has its threshold)
-                if (pt.getDistance() < marginA + marginB) {
-                    cbtVector3 ptA = pt.getPositionWorldOnA();
-                    cbtVector3 ptB = pt.getPositionWorldOnB();
+    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
 
-                    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
-                    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
+    int numContacts = contactManifold->getNumContacts();
+    for (int j = 0; j < numContacts; j++) {
+        cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
 
-                    icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
-                                    -pt.m_normalWorldOnB.getZ());
-                    icontact.vN.Normalize();
+        // Discard "too far" constraints (the Bullet engine also has its threshold)
+        if (pt.getDistance() >= marginA + marginB)
+            continue;
 
-                    double ptdist = pt.getDistance();
+        cbtVector3 ptA = pt.getPositionWorldOnA();
+        cbtVector3 ptB = pt.getPositionWorldOnB();
 
-                    icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
-                    icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
-                    icontact.distance = ptdist + envelopeA + envelopeB;
+        icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
+        icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
 
-                    icontact.reaction_cache = pt.reactions_cache;
+        icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(), -pt.m_normalWorldOnB.getZ());
+        icontact.vN.Normalize();
 
-                    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-                    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+        double ptdist = pt.getDistance();
 
-                    int indexA = compoundA ? pt.m_index0 : 0;
-                    int indexB = compoundB ? pt.m_index1 : 0;
+        icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
+        icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
+        icontact.distance = ptdist + envelopeA + envelopeB;
 
-                    icontact.shapeA = bt_modelA->m_shapes[indexA].get();
-                    icontact.shapeB = bt_modelB->m_shapes[indexB].get();
+        icontact.reaction_cache = pt.reactions_cache;
 
-                    // Execute some user custom callback, if any
-                    bool add_contact = true;
-                    if (this->narrow_callback)
-                        add_contact = this->narrow_callback->OnNarrowphase(icontact);
+        int indexA = compoundA ? pt.m_index0 : 0;
+        int indexB = compoundB ? pt.m_index1 : 0;
 
-                    // Add to contact container
-                    if (add_contact) {
-                        ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
-                        ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" <<
-                        /// icontact.shapeB->m_type << std::endl;
+        icontact.shapeA = bt_modelA->m_shapes[indexA].get();
+        icontact.shapeB = bt_modelB->m_shapes[indexB].get();
 
-                        mcontactcontainer->AddContact(icontact);
-                    }
-                }
-            }
-        }
+        // Execute some user custom callback, if any
+        if (narrow_callback && !narrow_callback->OnNarrowphase(icontact))
+            continue;
 
-        // Uncomment this line to remove all points
-        ////contactManifold->clearManifold();
+        contacts.push_back(icontact);
     }
-    mcontactcontainer->EndAddContact();
 }
 
 void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximitycontainer) {
@@ -358,6 +367,26 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
     return false;
 }
 
+int ChCollisionSystemBullet::RayHitBatch(const std::vector<ChVector3d>& from,
+                                         const std::vector<ChVector3d>& to,
+                                         std::vector<ChRayhitResult>& results) const {
+    assert(from.size() == to.size());
+    int num_rays = (int)from.size();
+    results.resize(num_rays);
+
+    // Bullet is built thread-safe: concurrent ray tests on the (unmodified) collision world are allowed.
+    // Contiguous chunks of rays are assigned to the same thread so that coherent rays reuse cached tree nodes.
+    int nthreads = m_num_threads;
+    int num_hits = 0;
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads) reduction(+ : num_hits) if (nthreads > 1)
+    for (int i = 0; i < num_rays; i++) {
+        if (RayHit(from[i], to[i], results[i], cbtBroadphaseProxy::DefaultFilter, cbtBroadphaseProxy::AllFilter))
+            num_hits++;
+    }
+
+    return num_hits;
+}
+
 bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
                                      const ChVector3d& to,
                                      ChCollisionModel* model,
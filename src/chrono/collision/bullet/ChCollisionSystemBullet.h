@@ -73,8 +73,11 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// ChContactContainer. For instance ChSystem, after each Run()
     /// collision detection, calls this method multiple times for all contact containers in the system,
     /// The basic behavior of the implementation is the following: collision system
-    /// will call in sequence the functions BeginAddContact(), AddContact() (x n times),
+    /// will call in sequence the functions BeginAddContact(), AddContacts() (x n times),
     /// EndAddContact() of the contact container.
+    /// Contact manifolds are converted to collision info objects concurrently, using the number of threads specified
+    /// through SetNumThreads(), unless broadphase or narrowphase callbacks are registered. Contacts are always passed to
+    /// the container in the order of the Bullet manifolds, independent of the number of threads.
     virtual void ReportContacts(ChContactContainer* mcontactcontainer) override;
 
     /// After the Run() has completed, you can call this function to
@@ -95,6 +98,13 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform a batch of ray-hit tests with all collision models.
+    /// Rays are split in contiguous chunks which are processed concurrently, using the number of threads specified
+    /// through SetNumThreads(). Each ray traverses the Bullet broadphase tree with its own stack.
+    virtual int RayHitBatch(const std::vector<ChVector3d>& from,
+                            const std::vector<ChVector3d>& to,
+                            std::vector<ChRayhitResult>& results) const override;
+
     /// Specify a callback object to be used for debug rendering of collision shapes.
     virtual void RegisterVisualizationCallback(std::shared_ptr<VisualizationCallback> callback) override;
 
@@ -136,6 +146,9 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                 short int filter_group,
                 short int filter_mask) const;
 
+    /// Append to the given list the contacts of the specified Bullet contact manifold.
+    void ReportManifold(cbtPersistentManifold* contactManifold, std::vector<ChCollisionInfo>& contacts);
+
     /// Remove the specified Bullet model from this collision system.
     /// If erase=true, also remove from the bt_models list.
     void Remove(ChCollisionModelBullet* bt_model, bool erase);
@@ -160,6 +173,10 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
 
     cbtIDebugDraw* m_debug_drawer;
 
+    int m_num_threads;  ///< number of threads for batched ray-hit tests and contact reporting
+
+    std::vector<std::vector<ChCollisionInfo>> m_contact_buffers;  ///< per-chunk lists of reported contacts
+
     friend class ChCollisionModelBullet;
 };
 
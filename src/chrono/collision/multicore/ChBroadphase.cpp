@@ -38,6 +38,10 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      large_shape_bins(64),
+      incremental(false),
+      prev_valid(false),
+      prev_num_shapes(0),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -196,7 +200,9 @@ void ChBroadphase::ComputeTopLevelResolution() {
             bins_per_axis.z = (int)std::ceil(diag.z / bin_size.z);
             break;
         case GridType::FIXED_DENSITY:
+        case GridType::TWO_LEVEL:
             bins_per_axis = Compute_Grid_Resolution(num_shapes, diag, grid_density);
+            break;
     }
 
     // Calculate actual bin dimension
@@ -212,18 +218,106 @@ void ChBroadphase::ComputeTopLevelResolution() {
 void ChBroadphase::Process() {
     // Compute overall AABB and then offset all AABBs
     DetermineBoundingBox();
+    bool reuse = ReuseGrid();
     OffsetAABB();
 
     // Determine resolution of the top level grid
     ComputeTopLevelResolution();
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    reuse = reuse && bins_per_axis.x == prev_bins_per_axis.x && bins_per_axis.y == prev_bins_per_axis.y &&
+            bins_per_axis.z == prev_bins_per_axis.z;
 
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (reuse)
+            IncrementalBroadphase();
+        else
+            OneLevelBroadphase();
+
+        if (incremental)
+            SaveState();
+        else
+            prev_valid = false;
+
+        LargeShapeBroadphase();
+
+        // Sort the candidate pairs by shape IDs. The order of the pairs (and hence of the generated contacts) then
+        // does not depend on the grid domain and resolution, nor on the incremental update of the grid data.
+        Thrust_Sort(cd_data->pair_shapeIDs);
+
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
     }
     return;
 }
 
+// In incremental mode, keep the grid domain of the previous step if it still contains all shapes.
+// Otherwise, enlarge the new grid domain, so that it can be reused over the next steps.
+bool ChBroadphase::ReuseGrid() {
+    if (!incremental)
+        return false;
+
+    real3& min_point = cd_data->min_bounding_point;
+    real3& max_point = cd_data->max_bounding_point;
+
+    bool reuse = prev_valid && cd_data->num_rigid_shapes == prev_num_shapes;
+    reuse = reuse && cd_data->state_data.num_fluid_bodies == 0;
+    reuse = reuse && grid_type == prev_grid_type && large_shape_bins == prev_large_shape_bins;
+    reuse = reuse && min_point.x >= prev_min_bounding_point.x && max_point.x <= prev_max_bounding_point.x;
+    reuse = reuse && min_point.y >= prev_min_bounding_point.y && max_point.y <= prev_max_bounding_point.y;
+    reuse = reuse && min_point.z >= prev_min_bounding_point.z && max_point.z <= prev_max_bounding_point.z;
+
+    if (reuse) {
+        min_point = prev_min_bounding_point;
+        max_point = prev_max_bounding_point;
+    } else {
+        real3 margin = real(0.05) * (max_point - min_point);
+        min_point = min_point - margin;
+        max_point = max_point + margin;
+    }
+    cd_data->global_origin = min_point;
+
+    return reuse;
+}
+
+// Pack the state of a shape (presence in the system, state of the associated body) in a set of flags.
+static inline char ShapeState(uint id, const std::vector<char>& active, const std::vector<char>& collide) {
+    if (id == UINT_MAX)
+        return 0;
+    return 1 | (active[id] ? 2 : 0) | (collide[id] ? 4 : 0);
+}
+
+// Save the broadphase data needed for an incremental update at the next step.
+void ChBroadphase::SaveState() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    prev_num_shapes = num_shapes;
+    prev_grid_type = grid_type;
+    prev_large_shape_bins = large_shape_bins;
+    prev_bins_per_axis = cd_data->bins_per_axis;
+    prev_min_bounding_point = cd_data->min_bounding_point;
+    prev_max_bounding_point = cd_data->max_bounding_point;
+
+    prev_aabb_min = cd_data->aabb_min;
+    prev_aabb_max = cd_data->aabb_max;
+    prev_fam = cd_data->shape_data.fam_rigid;
+    prev_large_flags = cd_data->large_shape_flags;
+
+    prev_state.resize(num_shapes);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        prev_state[i] = ShapeState(obj_data_id[i], obj_active, obj_collide);
+    }
+
+    prev_bin_active.assign(cd_data->bin_active.begin(), cd_data->bin_active.begin() + cd_data->num_active_bins);
+    prev_bin_num_contact = cd_data->bin_num_contact;
+    prev_pair_shapeIDs = cd_data->pair_shapeIDs;
+
+    prev_valid = true;
+}
+
 void ChBroadphase::OneLevelBroadphase() {
     const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
     const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
@@ -256,14 +350,36 @@ void ChBroadphase::OneLevelBroadphase() {
     bin_intersections.resize(num_shapes + 1);
     bin_intersections[num_shapes] = 0;
 
+    // With a two-level grid, shapes intersecting more than 'large_shape_bins' bins are kept out of the grid and are
+    // processed separately (see LargeShapeBroadphase). Rigid-fluid collision detection relies on the grid, so all
+    // shapes are binned if there are fluid particles.
+    bool separate_large = grid_type == GridType::TWO_LEVEL && cd_data->state_data.num_fluid_bodies == 0;
+    std::vector<uint>& large_shapes = cd_data->large_shapes;
+    std::vector<uint>& large_shape_flags = cd_data->large_shape_flags;
+    large_shape_flags.resize(num_shapes);
+
     // Count the number of bins intersected by each shape AABB -> bin_intersections
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
+        large_shape_flags[i] = 0;
         if (obj_data_id[i] == UINT_MAX) {
             bin_intersections[i] = 0;
             continue;
         }
         f_Count_AABB_BIN_Intersection(i, inv_bin_size, aabb_min, aabb_max, bin_intersections);
+        if (separate_large && bin_intersections[i] > large_shape_bins) {
+            large_shape_flags[i] = 1;
+            bin_intersections[i] = 0;
+        }
+    }
+
+    // Collect the large shapes
+    large_shapes.clear();
+    if (separate_large) {
+        for (int i = 0; i < num_shapes; i++) {
+            if (large_shape_flags[i])
+                large_shapes.push_back(i);
+        }
     }
 
     // Calculate total number of bin - shape AABB intersections
@@ -278,7 +394,7 @@ void ChBroadphase::OneLevelBroadphase() {
     // For each shape, store the bin index and the shape ID for intersections with this shape
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX)
+        if (obj_data_id[i] == UINT_MAX || large_shape_flags[i])
             continue;
         f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections, bin_number,
                                       bin_aabb_number);
@@ -289,7 +405,12 @@ void ChBroadphase::OneLevelBroadphase() {
     num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
 
     if (num_active_bins <= 0) {
+        num_active_bins = 0;
         num_possible_collisions = 0;
+        pair_shapeIDs.clear();
+        bin_start_index.assign(1, 0);
+        bin_num_contact.assign(1, 0);
+        UpdateExtendedStartIndex();
         return;
     }
 
@@ -323,10 +444,265 @@ void ChBroadphase::OneLevelBroadphase() {
 
     pair_shapeIDs.resize(num_possible_collisions);
 
-    // For use in ray intersection tests, also create an "extended" vector of start indices that also includes bins with
-    // no shape AABB intersections.
+    UpdateExtendedStartIndex();
+}
+
+// Incremental broadphase, using the grid and the data retained from the previous step.
+void ChBroadphase::IncrementalBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const std::vector<uint>& bin_active = cd_data->bin_active;
+    const std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
+    std::vector<uint>& large_shapes = cd_data->large_shapes;
+    std::vector<uint>& large_shape_flags = cd_data->large_shape_flags;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    uint& num_bins = cd_data->num_bins;
+    const uint& num_active_bins = cd_data->num_active_bins;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
+
+    bool separate_large = grid_type == GridType::TWO_LEVEL;
+
+    // Flag the shapes with a modified AABB or state (1) and, among these, the shapes which must be re-binned (2)
+    shape_changed.resize(num_shapes);
+    large_shape_flags.resize(num_shapes);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        uint id = obj_data_id[i];
+        char state = ShapeState(id, obj_active, obj_collide);
+
+        vec3 gmin = HashMin(aabb_min[i], inv_bin_size);
+        vec3 gmax = HashMax(aabb_max[i], inv_bin_size);
+        uint num_bins_shape = (gmax.x - gmin.x + 1) * (gmax.y - gmin.y + 1) * (gmax.z - gmin.z + 1);
+        large_shape_flags[i] = (separate_large && id != UINT_MAX && num_bins_shape > large_shape_bins) ? 1 : 0;
+
+        bool changed = state != prev_state[i] || !(aabb_min[i] == prev_aabb_min[i]) ||
+                       !(aabb_max[i] == prev_aabb_max[i]) || fam_data[i].x != prev_fam[i].x ||
+                       fam_data[i].y != prev_fam[i].y;
+        if (!changed) {
+            shape_changed[i] = 0;
+            continue;
+        }
+
+        bool in_grid = id != UINT_MAX && !large_shape_flags[i];
+        bool prev_in_grid = (prev_state[i] & 1) && !prev_large_flags[i];
+        bool rebin = in_grid != prev_in_grid;
+        if (in_grid && prev_in_grid) {
+            vec3 prev_gmin = HashMin(prev_aabb_min[i], inv_bin_size);
+            vec3 prev_gmax = HashMax(prev_aabb_max[i], inv_bin_size);
+            rebin = gmin.x != prev_gmin.x || gmin.y != prev_gmin.y || gmin.z != prev_gmin.z ||  //
+                    gmax.x != prev_gmax.x || gmax.y != prev_gmax.y || gmax.z != prev_gmax.z;
+        }
+        shape_changed[i] = rebin ? 2 : 1;
+    }
+
+    std::vector<uint> changed;
+    std::vector<uint> rebinned;
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_changed[i])
+            changed.push_back(i);
+        if (shape_changed[i] == 2)
+            rebinned.push_back(i);
+    }
+
+    // Fall back on a full rebuild if a large fraction of the shapes was modified
+    if (2 * changed.size() > (size_t)num_shapes) {
+        OneLevelBroadphase();
+        return;
+    }
+
+    large_shapes.clear();
+    if (separate_large) {
+        for (int i = 0; i < num_shapes; i++) {
+            if (large_shape_flags[i])
+                large_shapes.push_back(i);
+        }
+    }
+
+    // Flag the bins intersected by the modified shapes, at the current and at the previous step
+    bin_dirty.assign(num_bins, 0);
+
+#pragma omp parallel for
+    for (int j = 0; j < (signed)changed.size(); j++) {
+        uint i = changed[j];
+        for (int step = 0; step < 2; step++) {
+            bool in_grid = (step == 0) ? (prev_state[i] & 1) && !prev_large_flags[i]
+                                       : obj_data_id[i] != UINT_MAX && !large_shape_flags[i];
+            if (!in_grid)
+                continue;
+            vec3 gmin = HashMin(step == 0 ? prev_aabb_min[i] : aabb_min[i], inv_bin_size);
+            vec3 gmax = HashMax(step == 0 ? prev_aabb_max[i] : aabb_max[i], inv_bin_size);
+            for (int a = gmin.x; a <= gmax.x; a++) {
+                for (int b = gmin.y; b <= gmax.y; b++) {
+                    for (int c = gmin.z; c <= gmax.z; c++) {
+                        uint bin = Hash_Index(vec3(a, b, c), bins_per_axis);
+#pragma omp atomic write
+                        bin_dirty[bin] = 1;
+                    }
+                }
+            }
+        }
+    }
+
+    // Update the sorted bin - shape AABB intersections
+    if (!rebinned.empty())
+        UpdateBinShapeData(rebinned);
+
+    if (num_active_bins == 0) {
+        num_possible_collisions = 0;
+        pair_shapeIDs.clear();
+        bin_num_contact.assign(1, 0);
+        return;
+    }
+
+    bin_num_contact.resize(num_active_bins + 1);
+    bin_num_contact[num_active_bins] = 0;
+
+    // Count the number of AABB-AABB intersections in each active bin -> bin_num_contact.
+    // A bin with no modified shapes has the same candidate pairs as at the previous step.
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_active_bins; i++) {
+        if (bin_dirty[bin_active[i]]) {
+            f_Count_AABB_AABB_Intersection(i, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_active,
+                                           bin_aabb_number, bin_start_index, fam_data, obj_active, obj_collide,
+                                           obj_data_id, bin_num_contact);
+        } else {
+            auto k = std::lower_bound(prev_bin_active.begin(), prev_bin_active.end(), bin_active[i]) -
+                     prev_bin_active.begin();
+            bin_num_contact[i] = prev_bin_num_contact[k + 1] - prev_bin_num_contact[k];
+        }
+    }
+
+    thrust::exclusive_scan(bin_num_contact.begin(), bin_num_contact.end(), bin_num_contact.begin());
+    num_possible_collisions = bin_num_contact.back();
+    pair_shapeIDs.resize(num_possible_collisions);
+
+    // Store the list of shape pairs in potential collision (i.e. with intersecting AABBs)
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_active_bins; i++) {
+        if (bin_dirty[bin_active[i]]) {
+            f_Store_AABB_AABB_Intersection(i, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_active,
+                                           bin_aabb_number, bin_start_index, bin_num_contact, fam_data, obj_active,
+                                           obj_collide, obj_data_id, pair_shapeIDs);
+        } else {
+            auto k = std::lower_bound(prev_bin_active.begin(), prev_bin_active.end(), bin_active[i]) -
+                     prev_bin_active.begin();
+            std::copy(prev_pair_shapeIDs.begin() + prev_bin_num_contact[k],
+                      prev_pair_shapeIDs.begin() + prev_bin_num_contact[k + 1],
+                      pair_shapeIDs.begin() + bin_num_contact[i]);
+        }
+    }
+}
+
+// Update the sorted bin - shape AABB intersections, removing the entries of the re-binned shapes and merging their new
+// entries. As with a full rebuild, entries are ordered by bin index and then by shape index.
+void ChBroadphase::UpdateBinShapeData(const std::vector<uint>& rebinned) {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& large_shape_flags = cd_data->large_shape_flags;
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    uint& num_active_bins = cd_data->num_active_bins;
+    uint& num_bin_aabb_intersections = cd_data->num_bin_aabb_intersections;
+
+    // Remove the entries of the re-binned shapes
+    uint num_kept = 0;
+    for (uint j = 0; j < num_bin_aabb_intersections; j++) {
+        if (shape_changed[bin_aabb_number[j]] == 2)
+            continue;
+        bin_number[num_kept] = bin_number[j];
+        bin_aabb_number[num_kept] = bin_aabb_number[j];
+        num_kept++;
+    }
+
+    // Generate and sort the new entries of the re-binned shapes
+    std::vector<std::pair<uint, uint>> entries;
+    for (uint i : rebinned) {
+        if (obj_data_id[i] == UINT_MAX || large_shape_flags[i])
+            continue;
+        vec3 gmin = HashMin(aabb_min[i], inv_bin_size);
+        vec3 gmax = HashMax(aabb_max[i], inv_bin_size);
+        for (int a = gmin.x; a <= gmax.x; a++) {
+            for (int b = gmin.y; b <= gmax.y; b++) {
+                for (int c = gmin.z; c <= gmax.z; c++) {
+                    entries.push_back(std::make_pair(Hash_Index(vec3(a, b, c), bins_per_axis), i));
+                }
+            }
+        }
+    }
+    std::sort(entries.begin(), entries.end());
+
+    // Merge (in place, starting from the back)
+    num_bin_aabb_intersections = num_kept + (uint)entries.size();
+    bin_number.resize(num_bin_aabb_intersections);
+    bin_aabb_number.resize(num_bin_aabb_intersections);
+
+    int r = (int)num_kept - 1;
+    int e = (int)entries.size() - 1;
+    int w = (int)num_bin_aabb_intersections - 1;
+    while (e >= 0) {
+        if (r >= 0 && std::make_pair(bin_number[r], bin_aabb_number[r]) > entries[e]) {
+            bin_number[w] = bin_number[r];
+            bin_aabb_number[w] = bin_aabb_number[r];
+            r--;
+        } else {
+            bin_number[w] = entries[e].first;
+            bin_aabb_number[w] = entries[e].second;
+            e--;
+        }
+        w--;
+    }
+
+    // Find the active bins and their start indices
+    bin_active.resize(num_bin_aabb_intersections);
+    bin_start_index.resize(num_bin_aabb_intersections);
+    num_active_bins = (uint)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
+
+    bin_active.resize(num_active_bins);
+    bin_start_index.resize(num_active_bins + 1);
+    bin_start_index[num_active_bins] = 0;
+    Thrust_Exclusive_Scan(bin_start_index);
+
+    UpdateExtendedStartIndex();
+}
+
+// For use in ray intersection tests, create an "extended" vector of start indices that also includes bins with no shape
+// AABB intersections.
+void ChBroadphase::UpdateExtendedStartIndex() {
+    const std::vector<uint>& bin_active = cd_data->bin_active;
+    const std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+    const uint num_bins = cd_data->num_bins;
+    const uint num_active_bins = cd_data->num_active_bins;
+
     bin_start_index_ext.resize(num_bins + 1);
 
+    if (num_active_bins == 0) {
+        std::fill(bin_start_index_ext.begin(), bin_start_index_ext.end(), 0);
+        return;
+    }
+
 #pragma omp parallel for
     for (int j = 0; j <= (signed)bin_active[0]; j++) {
         bin_start_index_ext[j] = bin_start_index[0];
@@ -343,4 +719,57 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 }
 
+// Find the candidate pairs involving large shapes (two-level grid). Each shape AABB is tested against the AABBs of all
+// large shapes, and the resulting pairs are appended to those found with the broadphase grid.
+void ChBroadphase::LargeShapeBroadphase() {
+    const std::vector<uint>& large_shapes = cd_data->large_shapes;
+    if (large_shapes.empty())
+        return;
+
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& large_shape_flags = cd_data->large_shape_flags;
+    std::vector<uint>& large_num_contact = cd_data->large_num_contact;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    large_num_contact.resize(num_shapes + 1);
+    large_num_contact[num_shapes] = 0;
+
+    // Count the number of AABB intersections with large shapes -> large_num_contact
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        f_Count_AABB_Large_Intersection(i, aabb_min, aabb_max, large_shapes, large_shape_flags, fam_data, obj_active,
+                                        obj_collide, obj_data_id, large_num_contact);
+    }
+
+    Thrust_Exclusive_Scan(large_num_contact);
+    uint num_large_collisions = large_num_contact.back();
+    if (num_large_collisions == 0)
+        return;
+
+    // Offset the start indices past the pairs found with the broadphase grid
+    uint offset = num_possible_collisions;
+    num_possible_collisions += num_large_collisions;
+    pair_shapeIDs.resize(num_possible_collisions);
+
+#pragma omp parallel for
+    for (int i = 0; i <= num_shapes; i++) {
+        large_num_contact[i] += offset;
+    }
+
+    // Store the list of shape pairs in potential collision with large shapes
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        f_Store_AABB_Large_Intersection(i, aabb_min, aabb_max, large_shapes, large_shape_flags, large_num_contact,
+                                        fam_data, obj_active, obj_collide, obj_data_id, pair_shapeIDs);
+    }
+}
+
 }  // end namespace chrono
@@ -27,13 +27,24 @@ namespace chrono {
 /// @{
 
 /// Class for performing broad-phase collision detection.
+/// Candidate shape pairs are found by binning the shape AABBs in a uniform grid. With a two-level grid (see
+/// GridType::TWO_LEVEL), large shapes (e.g., ground, walls, containers) spanning more than a given number of bins are
+/// not binned; their AABBs are instead tested directly against the AABBs of all other shapes.
+///
+/// In incremental mode, the grid and the sorted bin-shape data are retained from one step to the next (as long as all
+/// shapes remain in the grid domain). Only shapes whose AABB moved to different bins are re-binned, and candidate pairs
+/// are recomputed only in bins containing a shape whose AABB or state changed since the previous step. The candidate
+/// pairs are identical to those obtained by a full rebuild of the same grid.
+///
+/// In all modes, the candidate pairs are sorted by shape IDs, so that their order does not depend on the grid.
 class ChApi ChBroadphase {
   public:
     /// Method for computing grid resolution
     enum class GridType {
         FIXED_RESOLUTION,  ///< user-specified number of bins in each direction
         FIXED_BIN_SIZE,    ///< user-specified grid bin dimension
-        FIXED_DENSITY      ///< user-specified density of shapes per bin
+        FIXED_DENSITY,     ///< user-specified density of shapes per bin
+        TWO_LEVEL          ///< user-specified density of shapes per bin, with large shapes processed outside the grid
     };
 
     ChBroadphase();
@@ -44,6 +55,12 @@ class ChApi ChBroadphase {
 
   private:
     void OneLevelBroadphase();
+    void IncrementalBroadphase();
+    bool ReuseGrid();
+    void SaveState();
+    void UpdateBinShapeData(const std::vector<uint>& rebinned);
+    void LargeShapeBroadphase();
+    void UpdateExtendedStartIndex();
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -52,10 +69,32 @@ class ChApi ChBroadphase {
 
     std::shared_ptr<ChCollisionData> cd_data;
 
-    GridType grid_type;    ///< (input) method for setting grid resolution
-    vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
-    real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
-    real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
+    GridType grid_type;     ///< (input) method for setting grid resolution
+    vec3 grid_resolution;   ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
+    real3 bin_size;         ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
+    real grid_density;      ///< (input) collision grid density (used for GridType::FIXED_DENSITY and TWO_LEVEL)
+    uint large_shape_bins;  ///< (input) max. number of bins spanned by a grid shape (used for GridType::TWO_LEVEL)
+    bool incremental;       ///< (input) reuse broadphase data from the previous step
+
+    // Data retained from the previous step (incremental mode)
+    bool prev_valid;                            ///< true if the retained data can be used
+    uint prev_num_shapes;                       ///< number of shapes
+    GridType prev_grid_type;                    ///< grid type
+    uint prev_large_shape_bins;                 ///< max. number of bins spanned by a grid shape
+    vec3 prev_bins_per_axis;                    ///< grid resolution
+    real3 prev_min_bounding_point;              ///< grid LBR corner
+    real3 prev_max_bounding_point;              ///< grid RTF corner
+    std::vector<real3> prev_aabb_min;           ///< shape AABB lower corners (relative to grid origin)
+    std::vector<real3> prev_aabb_max;           ///< shape AABB upper corners (relative to grid origin)
+    std::vector<short2> prev_fam;               ///< shape collision families
+    std::vector<char> prev_state;               ///< shape state flags (see ShapeState)
+    std::vector<uint> prev_large_flags;         ///< shapes processed outside the grid
+    std::vector<uint> prev_bin_active;          ///< active bins
+    std::vector<uint> prev_bin_num_contact;     ///< start index of candidate pairs for each active bin
+    std::vector<long long> prev_pair_shapeIDs;  ///< candidate pairs found with the grid
+
+    std::vector<char> shape_changed;  ///< shapes with modified AABB or state since previous step
+    std::vector<char> bin_dirty;      ///< bins containing a modified shape (now or at previous step)
 
     friend class ChCollisionSystemMulticore;
     friend class ChCollisionSystemChronoMulticore;
@@ -31,6 +31,16 @@ namespace chrono {
 /// Readibility type definition.
 typedef int shape_type;
 
+/// Node of a bounding volume hierarchy over the faces of a triangle mesh collision shape.
+/// The nodes of a BVH are stored in depth-first order, so that the left child of an internal node immediately follows
+/// its parent. Node AABBs are expressed in the frame of the associated body.
+struct mesh_bvh_node {
+    real3 aabb_min;  ///< lower corner of node AABB
+    real3 aabb_max;  ///< upper corner of node AABB
+    int first;       ///< leaf: index of first face (in mesh_faces); internal node: index of right child
+    int count;       ///< leaf: number of faces; internal node: 0
+};
+
 /// Structure of arrays containing rigid collision shape information.
 struct shape_container {
     // All arrays of num_shapes length and indexed by the shape ID.
@@ -39,8 +49,8 @@ struct shape_container {
     std::vector<uint> id_rigid;     ///< ID of associated body
     std::vector<int> typ_rigid;     ///< shape type
     std::vector<int> local_rigid;   ///< local shape index in collision model of associated body
-    std::vector<int> start_rigid;   ///< start index in the appropriate container of dimensions
-    std::vector<int> length_rigid;  ///< usually 1, except for convex
+    std::vector<int> start_rigid;   ///< start index in the appropriate container of dimensions (BVH root for meshes)
+    std::vector<int> length_rigid;  ///< usually 1, except for convex (number of points) and meshes (number of faces)
 
     std::vector<quaternion> ObR_rigid;  ///< shape rotations
     std::vector<real3> ObA_rigid;       ///< shape positions
@@ -55,6 +65,10 @@ struct shape_container {
     std::vector<real4> rbox_like_rigid;  ///< dimensions and radius for rbox-like shapes
     std::vector<real3> convex_rigid;     ///< points for convex hull shapes
 
+    std::vector<real3> mesh_vertices;      ///< vertices of all triangle mesh shapes (in body frame)
+    std::vector<uvec3> mesh_faces;         ///< vertex indices (into mesh_vertices) of all triangle mesh faces
+    std::vector<mesh_bvh_node> mesh_bvh;   ///< BVH nodes of all triangle mesh shapes
+
     std::vector<real3> triangle_global;  ///< triangle vertices in global frame
 };
 
@@ -161,6 +175,7 @@ class ChApi ChCollisionData {
 
     std::vector<long long> pair_shapeIDs;     ///< shape IDs for each shape pair (encoded in a single long long)
     std::vector<long long> contact_shapeIDs;  ///< shape IDs for each contact (encoded in a single long long)
+    std::vector<int> contact_faceIDs;         ///< mesh face index for each contact (-1 if no triangle mesh involved)
 
     // Rigid-rigid geometric collision data
     std::vector<real3> norm_rigid_rigid;  ///< [num_rigid_contacts] normal for each rigid-rigid contact
@@ -212,6 +227,10 @@ class ChApi ChCollisionData {
     std::vector<uint> bin_start_index_ext;  ///< [num_bins+1]
     std::vector<uint> bin_num_contact;      ///< [num_active_bins+1]
 
+    std::vector<uint> large_shapes;       ///< shapes processed outside the broadphase grid (two-level broadphase)
+    std::vector<uint> large_shape_flags;  ///< [num_rigid_shapes] 1 for shapes processed outside the grid, 0 otherwise
+    std::vector<uint> large_num_contact;  ///< [num_rigid_shapes+1] number of candidate pairs with large shapes
+
     // Indexing variables
     // ------------------
 
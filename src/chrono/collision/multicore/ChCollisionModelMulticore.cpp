@@ -24,6 +24,7 @@
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChBodyAuxRef.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
 
 namespace chrono {
 
@@ -232,23 +233,40 @@ void ChCollisionModelMulticore::Populate() {
             case ChCollisionShape::Type::TRIANGLEMESH: {
                 auto shape_trimesh = std::static_pointer_cast<ChCollisionShapeTriangleMesh>(shape);
                 auto trimesh = shape_trimesh->GetMesh();
-
-                for (unsigned int i = 0; i < trimesh->GetNumTriangles(); i++) {
-                    ChTriangle tri = trimesh->GetTriangle(i);
-                    ChVector3d p1 = position + rotation.Rotate(tri.p1);
-                    ChVector3d p2 = position + rotation.Rotate(tri.p2);
-                    ChVector3d p3 = position + rotation.Rotate(tri.p3);
-                    auto shape_triangle = chrono_types::make_shared<ChCollisionShapeTriangle>(material, p1, p2, p3);
-
-                    auto ct_shape = chrono_types::make_shared<ctCollisionShape>();
-                    ct_shape->A = FromChVector(p1);
-                    ct_shape->B = FromChVector(p2);
-                    ct_shape->C = FromChVector(p3);
-                    ct_shape->R = quaternion(1, 0, 0, 0);
-
-                    m_shapes.push_back(shape_triangle);
-                    m_ct_shapes.push_back(ct_shape);
+                auto num_triangles = trimesh->GetNumTriangles();
+                if (num_triangles == 0)
+                    break;
+
+                // Store the mesh vertices (expressed relative to the body COG frame) and faces once per mesh.
+                // The mesh is represented by a single collision shape; candidate faces are found through a BVH.
+                uint vertex_offset = (uint)local_mesh_vertices.size();
+                uint face_offset = (uint)local_mesh_faces.size();
+                if (auto trimesh_connected = std::dynamic_pointer_cast<ChTriangleMeshConnected>(trimesh)) {
+                    for (const auto& v : trimesh_connected->GetCoordsVertices())
+                        local_mesh_vertices.push_back(FromChVector(position + rotation.Rotate(v)));
+                    for (const auto& f : trimesh_connected->GetIndicesVertexes()) {
+                        local_mesh_faces.push_back(
+                            U3(vertex_offset + f.x(), vertex_offset + f.y(), vertex_offset + f.z()));
+                    }
+                } else {
+                    for (unsigned int i = 0; i < num_triangles; i++) {
+                        ChTriangle tri = trimesh->GetTriangle(i);
+                        uint v = (uint)local_mesh_vertices.size();
+                        local_mesh_vertices.push_back(FromChVector(position + rotation.Rotate(tri.p1)));
+                        local_mesh_vertices.push_back(FromChVector(position + rotation.Rotate(tri.p2)));
+                        local_mesh_vertices.push_back(FromChVector(position + rotation.Rotate(tri.p3)));
+                        local_mesh_faces.push_back(U3(v, v + 1, v + 2));
+                    }
                 }
+
+                auto ct_shape = chrono_types::make_shared<ctCollisionShape>();
+                ct_shape->A = real3(0, 0, 0);
+                ct_shape->B = real3((chrono::real)num_triangles, (chrono::real)face_offset, 0);
+                ct_shape->C = real3(0, 0, 0);
+                ct_shape->R = quaternion(1, 0, 0, 0);
+
+                m_shapes.push_back(shape);
+                m_ct_shapes.push_back(ct_shape);
                 break;
             }
             default:
@@ -50,6 +50,9 @@ class ChApi ChCollisionModelMulticore : public ChCollisionModelImpl {
 
     std::vector<real3> local_convex_data;
 
+    std::vector<real3> local_mesh_vertices;  ///< vertices of triangle mesh shapes (released once added to the system)
+    std::vector<uvec3> local_mesh_faces;     ///< faces of triangle mesh shapes (released once added to the system)
+
     ChVector3d aabb_min;
     ChVector3d aabb_max;
 
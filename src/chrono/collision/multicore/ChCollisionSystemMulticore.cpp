@@ -24,13 +24,14 @@
 
 #include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
 #include "chrono/collision/multicore/ChRayTest.h"
+#include "chrono/collision/multicore/ChCollisionUtils.h"
 
 namespace chrono {
 
 CH_FACTORY_REGISTER(ChCollisionSystemMulticore)
 CH_UPCASTING(ChCollisionSystemMulticore, ChCollisionSystem)
 
-ChCollisionSystemMulticore::ChCollisionSystemMulticore() : use_aabb_active(false) {
+ChCollisionSystemMulticore::ChCollisionSystemMulticore() : use_aabb_active(false), m_num_threads(1) {
     // Create the shared data structure with own state data
     cd_data = chrono_types::make_shared<ChCollisionData>(true);
     cd_data->collision_envelope = ChCollisionModel::GetDefaultSuggestedEnvelope();
@@ -54,7 +55,7 @@ void ChCollisionSystemMulticore::SetBroadphaseGridResolution(const ChVector3i& n
 
 void ChCollisionSystemMulticore::SetBroadphaseGridSize(const ChVector3d& bin_size) {
     broadphase.bin_size = real3(bin_size.x(), bin_size.y(), bin_size.z());
-    broadphase.grid_type = ChBroadphase::GridType::FIXED_RESOLUTION;
+    broadphase.grid_type = ChBroadphase::GridType::FIXED_BIN_SIZE;
 }
 
 void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
@@ -62,6 +63,17 @@ void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemMulticore::SetBroadphaseGridTwoLevel(double density, int large_shape_bins) {
+    broadphase.grid_density = real(density);
+    broadphase.large_shape_bins = (uint)std::max(large_shape_bins, 1);
+    broadphase.grid_type = ChBroadphase::GridType::TWO_LEVEL;
+}
+
+void ChCollisionSystemMulticore::SetBroadphaseIncremental(bool val) {
+    broadphase.incremental = val;
+    broadphase.prev_valid = false;
+}
+
 void ChCollisionSystemMulticore::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
@@ -74,6 +86,7 @@ void ChCollisionSystemMulticore::EnableActiveBoundingBox(const ChVector3d& aabb_
 }
 
 void ChCollisionSystemMulticore::SetNumThreads(int nthreads) {
+    m_num_threads = std::max(1, nthreads);
 #ifdef _OPENMP
     omp_set_num_threads(nthreads);
 #endif
@@ -84,6 +97,9 @@ void ChCollisionSystemMulticore::SetNumThreads(int nthreads) {
 void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
     assert(!model->HasImplementation());
 
+    // Broadphase data retained from the previous step is no longer valid
+    broadphase.prev_valid = false;
+
     auto ct_model = chrono_types::make_shared<ChCollisionModelMulticore>(model.get());
     ct_model->Populate();
 
@@ -98,6 +114,11 @@ void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
     shape_data.convex_rigid.insert(shape_data.convex_rigid.end(), ct_model->local_convex_data.begin(),
                                    ct_model->local_convex_data.end());
 
+    // Insert the triangle mesh vertices into the global list, offsetting the vertex indices of the mesh faces
+    uint mesh_vertex_offset = (uint)shape_data.mesh_vertices.size();
+    shape_data.mesh_vertices.insert(shape_data.mesh_vertices.end(), ct_model->local_mesh_vertices.begin(),
+                                    ct_model->local_mesh_vertices.end());
+
     // Shape index in the collision model
     int local_shape_index = 0;
 
@@ -163,6 +184,21 @@ void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
                 shape_data.triangle_rigid.push_back(obB);
                 shape_data.triangle_rigid.push_back(obC);
                 break;
+            case ChCollisionShape::Type::TRIANGLEMESH: {
+                // Load the mesh faces and build their BVH. The shape data references the BVH root node.
+                int num_faces = (int)obB.x;
+                int face_start = (int)shape_data.mesh_faces.size();
+                auto local_faces = ct_model->local_mesh_faces.begin() + (int)obB.y;
+                for (int f = 0; f < num_faces; f++) {
+                    const uvec3& face = local_faces[f];
+                    shape_data.mesh_faces.push_back(U3(face.x + mesh_vertex_offset, face.y + mesh_vertex_offset,
+                                                       face.z + mesh_vertex_offset));
+                }
+                start = mc_utils::BuildMeshBVH(shape_data.mesh_vertices, shape_data.mesh_faces, face_start, num_faces,
+                                               shape_data.mesh_bvh);
+                length = num_faces;
+                break;
+            }
             default:
                 start = -1;
                 break;
@@ -181,6 +217,10 @@ void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
         local_shape_index++;
     }
 
+    // Release the model's copy of the triangle mesh data (now stored in the global lists)
+    ct_model->local_mesh_vertices = std::vector<real3>();
+    ct_model->local_mesh_faces = std::vector<uvec3>();
+
     ct_models.push_back(ct_model);
 }
 
@@ -519,6 +559,13 @@ void ChCollisionSystemMulticore::GenerateAABB() {
                 temp_min -= envelope;
                 temp_max += envelope;
 
+            } else if (type == ChCollisionShape::Type::TRIANGLEMESH) {
+                // Bounding box of the mesh root BVH node (expressed in the body frame)
+                const mesh_bvh_node& root = cd_data->shape_data.mesh_bvh[start];
+                real3 center = 0.5 * (root.aabb_max + root.aabb_min);
+                real3 hdims = 0.5 * (root.aabb_max - root.aabb_min) + envelope;
+                ComputeAABBBox(hdims, center, position, rotation, body_rot[id], temp_min, temp_max);
+
             } else if (type == ChCollisionShape::Type::TRIANGLE) {
                 real3 A, B, C;
 
@@ -570,13 +617,13 @@ std::vector<vec2> ChCollisionSystemMulticore::GetOverlappingPairs() {
 
 // -----------------------------------------------------------------------------
 
-bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const {
-    if (cd_data->num_active_bins == 0) {
-        result.hit = false;
-        return false;
-    }
-
-    ChRayTest tester(cd_data);
+// Perform a ray test with the given tester and load the result.
+static bool RayHitTest(ChRayTest& tester,
+                       const ChCollisionData& cd_data,
+                       const std::vector<std::shared_ptr<ChBody>>& bodies,
+                       const ChVector3d& from,
+                       const ChVector3d& to,
+                       ChCollisionSystem::ChRayhitResult& result) {
     ChRayTest::RayHitInfo info;
     if (tester.Check(FromChVector(from), FromChVector(to), info)) {
         // Hit point
@@ -586,10 +633,10 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
         result.dist_factor = info.t;
 
         // ID of the body carring the closest hit shape
-        uint bid = cd_data->shape_data.id_rigid[info.shapeID];
+        uint bid = cd_data.shape_data.id_rigid[info.shapeID];
 
         // Collision model of hit body
-        result.hitModel = m_system->GetBodies()[bid]->GetCollisionModel().get();
+        result.hitModel = bodies[bid]->GetCollisionModel().get();
 
         return true;
     }
@@ -598,6 +645,47 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     return false;
 }
 
+bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const {
+    if (cd_data->num_active_bins == 0 && cd_data->large_shapes.empty()) {
+        result.hit = false;
+        return false;
+    }
+
+    ChRayTest tester(cd_data);
+    return RayHitTest(tester, *cd_data, m_system->GetBodies(), from, to, result);
+}
+
+int ChCollisionSystemMulticore::RayHitBatch(const std::vector<ChVector3d>& from,
+                                           const std::vector<ChVector3d>& to,
+                                           std::vector<ChRayhitResult>& results) const {
+    assert(from.size() == to.size());
+    int num_rays = (int)from.size();
+    results.resize(num_rays);
+
+    if (cd_data->num_active_bins == 0 && cd_data->large_shapes.empty()) {
+        for (auto& result : results)
+            result.hit = false;
+        return 0;
+    }
+
+    const auto& bodies = m_system->GetBodies();
+    int num_hits = 0;
+    int nthreads = m_num_threads;
+
+#pragma omp parallel num_threads(nthreads) reduction(+ : num_hits) if (nthreads > 1)
+    {
+        // One tester per thread; contiguous chunks of (coherent) rays visit the same grid bins
+        ChRayTest tester(cd_data);
+#pragma omp for schedule(dynamic, 64)
+        for (int i = 0; i < num_rays; i++) {
+            if (RayHitTest(tester, *cd_data, bodies, from[i], to[i], results[i]))
+                num_hits++;
+        }
+    }
+
+    return num_hits;
+}
+
 bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from,
                                         const ChVector3d& to,
                                         ChCollisionModel* model,
@@ -826,6 +914,19 @@ void ChCollisionSystemMulticore::VisualizeShapes() {
                 vis_callback->DrawLine(ToChVector(C), ToChVector(A), ChColor(1, 0, 0));
                 break;
             }
+            case ChCollisionShape::Type::TRIANGLEMESH: {
+                const auto& vertices = cd_data->shape_data.mesh_vertices;
+                const auto& faces = cd_data->shape_data.mesh_faces;
+                mc_utils::QueryMeshBVH(cd_data->shape_data, start, real3(-C_REAL_MAX), real3(C_REAL_MAX), [&](int f) {
+                    real3 A = Rotate(vertices[faces[f].x], body_rot[id]) + pos_rigid[id];
+                    real3 B = Rotate(vertices[faces[f].y], body_rot[id]) + pos_rigid[id];
+                    real3 C = Rotate(vertices[faces[f].z], body_rot[id]) + pos_rigid[id];
+                    vis_callback->DrawLine(ToChVector(A), ToChVector(B), ChColor(1, 0, 0));
+                    vis_callback->DrawLine(ToChVector(B), ToChVector(C), ChColor(1, 0, 0));
+                    vis_callback->DrawLine(ToChVector(C), ToChVector(A), ChColor(1, 0, 0));
+                });
+                break;
+            }
         }
     }
 }
@@ -77,6 +77,19 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Set a two-level broadphase grid, with roughly `density` collision shapes per bin.
+    /// Shapes spanning more than `large_shape_bins` bins (such as ground, walls, or containers) are not inserted in the
+    /// grid and are instead tested against all other shapes. This avoids the cost of binning a few large shapes in a
+    /// fine grid required by a large number of small shapes.
+    void SetBroadphaseGridTwoLevel(double density, int large_shape_bins = 64);
+
+    /// Enable/disable incremental broadphase (default: false).
+    /// If enabled, the broadphase grid and the sorted bin-shape data are retained across steps and only the parts
+    /// affected by shapes whose AABB or state changed are updated. This is beneficial when most shapes are at rest or
+    /// move slowly relative to the bin size. The resulting candidate pairs are the same as with a full rebuild.
+    /// Incremental mode is not used in the presence of 3-DOF fluid particles.
+    void SetBroadphaseIncremental(bool val);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
@@ -136,6 +149,13 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform a batch of ray-hit tests with all collision models.
+    /// Rays are traversed through the broadphase grid (see ChRayTest) in contiguous chunks processed concurrently,
+    /// with one ray tester per thread, using the number of threads specified through SetNumThreads().
+    virtual int RayHitBatch(const std::vector<ChVector3d>& from,
+                            const std::vector<ChVector3d>& to,
+                            std::vector<ChRayhitResult>& results) const override;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -180,6 +200,8 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     real3 active_aabb_min;  ///< lower corner of active bounding box
     real3 active_aabb_max;  ///< upper corner of active bounding box
 
+    int m_num_threads;  ///< number of threads for batched ray-hit tests
+
     ChTimer m_timer_broad;
     ChTimer m_timer_narrow;
 };
@@ -170,6 +170,32 @@ ChApi void f_Store_AABB_AABB_Intersection(const uint index,
                                           const std::vector<uint>& body_id,
                                           std::vector<long long>& potential_contacts);
 
+/// Function to count the AABB intersections of a shape with the large shapes (processed outside the broadphase grid).
+/// A pair of large shapes is only counted for the shape with lower index.
+ChApi void f_Count_AABB_Large_Intersection(const uint index,
+                                           const std::vector<real3>& aabb_min_data,
+                                           const std::vector<real3>& aabb_max_data,
+                                           const std::vector<uint>& large_shapes,
+                                           const std::vector<uint>& large_shape_flags,
+                                           const std::vector<short2>& fam_data,
+                                           const std::vector<char>& body_active,
+                                           const std::vector<char>& body_collide,
+                                           const std::vector<uint>& body_id,
+                                           std::vector<uint>& num_contact);
+
+/// Function to store the AABB intersections of a shape with the large shapes.
+ChApi void f_Store_AABB_Large_Intersection(const uint index,
+                                           const std::vector<real3>& aabb_min_data,
+                                           const std::vector<real3>& aabb_max_data,
+                                           const std::vector<uint>& large_shapes,
+                                           const std::vector<uint>& large_shape_flags,
+                                           const std::vector<uint>& num_contact,
+                                           const std::vector<short2>& fam_data,
+                                           const std::vector<char>& body_active,
+                                           const std::vector<char>& body_collide,
+                                           const std::vector<uint>& body_id,
+                                           std::vector<long long>& potential_contacts);
+
 /// @}
 
 // =============================================================================
@@ -217,6 +243,62 @@ ChApi void f_TL_Write_AABB_Leaf_Intersection(const uint& index,
 
 // =============================================================================
 
+/// @name Utility functions for triangle mesh shapes
+/// @{
+
+/// Build a bounding volume hierarchy over the faces [face_start, face_start + num_faces) of a triangle mesh shape.
+/// Faces in this range are reordered in place so that each BVH leaf refers to a contiguous range of faces.
+/// The new BVH nodes are appended to 'nodes' and the function returns the index of the root node.
+ChApi int BuildMeshBVH(const std::vector<real3>& vertices,
+                       std::vector<uvec3>& faces,
+                       int face_start,
+                       int num_faces,
+                       std::vector<mesh_bvh_node>& nodes);
+
+/// Traverse the BVH with given root node and invoke the provided callback for each mesh face with an AABB overlapping
+/// the box (aabb_min, aabb_max). The query box must be expressed in the frame of the body carrying the mesh.
+/// The callback is invoked with the index of the candidate face in the list of mesh faces.
+template <typename Callback>
+inline void QueryMeshBVH(const shape_container& shape_data,
+                         int root,
+                         const real3& aabb_min,
+                         const real3& aabb_max,
+                         Callback&& callback) {
+    const mesh_bvh_node* nodes = shape_data.mesh_bvh.data();
+    const real3* vertices = shape_data.mesh_vertices.data();
+    const uvec3* faces = shape_data.mesh_faces.data();
+
+    // Nodes are split at the median, so that the tree depth is logarithmic in the number of faces
+    int stack[64];
+    int top = 0;
+    stack[top++] = root;
+
+    while (top > 0) {
+        int index = stack[--top];
+        const mesh_bvh_node& node = nodes[index];
+        if (!overlap(node.aabb_min, node.aabb_max, aabb_min, aabb_max))
+            continue;
+
+        if (node.count == 0) {
+            stack[top++] = node.first;
+            stack[top++] = index + 1;
+            continue;
+        }
+
+        for (int f = node.first; f < node.first + node.count; f++) {
+            const real3& A = vertices[faces[f].x];
+            const real3& B = vertices[faces[f].y];
+            const real3& C = vertices[faces[f].z];
+            if (overlap(Min(A, Min(B, C)), Max(A, Max(B, C)), aabb_min, aabb_max))
+                callback(f);
+        }
+    }
+}
+
+/// @}
+
+// =============================================================================
+
 /// @name Utility functions for MPR narrowphase
 /// @{
 
@@ -0,0 +1,110 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Construction of the bounding volume hierarchies used by triangle mesh shapes
+// in the Chrono multicore collision detection system.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/collision/multicore/ChCollisionUtils.h"
+
+namespace chrono {
+namespace mc_utils {
+
+// Maximum number of faces in a BVH leaf
+static const int bvh_leaf_size = 4;
+
+// Recursively build the BVH node for the faces order[begin..end) (indices relative to the first mesh face).
+// Nodes are split at the median face centroid along the axis of largest centroid extent.
+static int BuildMeshBVHNode(const std::vector<real3>& vertices,
+                            const std::vector<uvec3>& faces,
+                            const std::vector<real3>& centroids,
+                            std::vector<int>& order,
+                            int face_start,
+                            int begin,
+                            int end,
+                            std::vector<mesh_bvh_node>& nodes) {
+    int index = (int)nodes.size();
+    nodes.push_back(mesh_bvh_node());
+
+    real3 aabb_min(C_REAL_MAX);
+    real3 aabb_max(-C_REAL_MAX);
+    real3 cmin(C_REAL_MAX);
+    real3 cmax(-C_REAL_MAX);
+    for (int i = begin; i < end; i++) {
+        const uvec3& face = faces[face_start + order[i]];
+        aabb_min = Min(aabb_min, Min(vertices[face.x], Min(vertices[face.y], vertices[face.z])));
+        aabb_max = Max(aabb_max, Max(vertices[face.x], Max(vertices[face.y], vertices[face.z])));
+        cmin = Min(cmin, centroids[order[i]]);
+        cmax = Max(cmax, centroids[order[i]]);
+    }
+    nodes[index].aabb_min = aabb_min;
+    nodes[index].aabb_max = aabb_max;
+
+    if (end - begin <= bvh_leaf_size) {
+        nodes[index].first = face_start + begin;
+        nodes[index].count = end - begin;
+        return index;
+    }
+
+    real3 extent = cmax - cmin;
+    int axis = 0;
+    if (extent.y > extent[axis])
+        axis = 1;
+    if (extent.z > extent[axis])
+        axis = 2;
+
+    int mid = (begin + end) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end,
+                     [&centroids, axis](int a, int b) { return centroids[a][axis] < centroids[b][axis]; });
+
+    // The left child immediately follows its parent
+    BuildMeshBVHNode(vertices, faces, centroids, order, face_start, begin, mid, nodes);
+    int right = BuildMeshBVHNode(vertices, faces, centroids, order, face_start, mid, end, nodes);
+
+    nodes[index].first = right;
+    nodes[index].count = 0;
+    return index;
+}
+
+int BuildMeshBVH(const std::vector<real3>& vertices,
+                 std::vector<uvec3>& faces,
+                 int face_start,
+                 int num_faces,
+                 std::vector<mesh_bvh_node>& nodes) {
+    assert(num_faces > 0);
+    assert(face_start + num_faces <= (int)faces.size());
+
+    std::vector<real3> centroids(num_faces);
+    std::vector<int> order(num_faces);
+    for (int i = 0; i < num_faces; i++) {
+        const uvec3& face = faces[face_start + i];
+        centroids[i] = (vertices[face.x] + vertices[face.y] + vertices[face.z]) / real(3);
+        order[i] = i;
+    }
+
+    nodes.reserve(nodes.size() + 2 * (num_faces / bvh_leaf_size + 1));
+    int root = BuildMeshBVHNode(vertices, faces, centroids, order, face_start, 0, num_faces, nodes);
+
+    // Reorder the mesh faces so that each leaf refers to a contiguous range
+    std::vector<uvec3> sorted(num_faces);
+    for (int i = 0; i < num_faces; i++)
+        sorted[i] = faces[face_start + order[i]];
+    std::copy(sorted.begin(), sorted.end(), faces.begin() + face_start);
+
+    return root;
+}
+
+}  // end namespace mc_utils
+}  // end namespace chrono
@@ -216,6 +216,97 @@ void f_Store_AABB_AABB_Intersection(const uint index,
     }
 }
 
+// LARGE SHAPE FUNCTIONS==========================================================
+
+// Check if the specified shape and large shape are in potential collision.
+static inline bool check_large_pair(uint shapeA,
+                                    uint shapeB,
+                                    const std::vector<real3>& aabb_min_data,
+                                    const std::vector<real3>& aabb_max_data,
+                                    const std::vector<uint>& large_shape_flags,
+                                    const std::vector<short2>& fam_data,
+                                    const std::vector<char>& body_active,
+                                    const std::vector<char>& body_collide,
+                                    const std::vector<uint>& body_id) {
+    uint bodyA = body_id[shapeA];
+    uint bodyB = body_id[shapeB];
+
+    // Pairs of large shapes are only processed by the shape with lower index
+    if (large_shape_flags[shapeA] && shapeB <= shapeA)
+        return false;
+    if (bodyB == UINT_MAX)
+        return false;
+    if (bodyA == bodyB)
+        return false;
+    if (body_collide[bodyB] == 0)
+        return false;
+    if (!body_active[bodyA] && !body_active[bodyB])
+        return false;
+    if (!collide(fam_data[shapeA], fam_data[shapeB]))
+        return false;
+    return overlap(aabb_min_data[shapeA], aabb_max_data[shapeA], aabb_min_data[shapeB], aabb_max_data[shapeB]);
+}
+
+// Function to count AABB intersections with large shapes.
+void f_Count_AABB_Large_Intersection(const uint index,
+                                     const std::vector<real3>& aabb_min_data,
+                                     const std::vector<real3>& aabb_max_data,
+                                     const std::vector<uint>& large_shapes,
+                                     const std::vector<uint>& large_shape_flags,
+                                     const std::vector<short2>& fam_data,
+                                     const std::vector<char>& body_active,
+                                     const std::vector<char>& body_collide,
+                                     const std::vector<uint>& body_id,
+                                     std::vector<uint>& num_contact) {
+    uint bodyA = body_id[index];
+    if (bodyA == UINT_MAX || body_collide[bodyA] == 0) {
+        num_contact[index] = 0;
+        return;
+    }
+
+    uint count = 0;
+    for (uint shapeB : large_shapes) {
+        if (check_large_pair(index, shapeB, aabb_min_data, aabb_max_data, large_shape_flags, fam_data, body_active,
+                             body_collide, body_id))
+            count++;
+    }
+
+    num_contact[index] = count;
+}
+
+// Function to store AABB intersections with large shapes.
+void f_Store_AABB_Large_Intersection(const uint index,
+                                     const std::vector<real3>& aabb_min_data,
+                                     const std::vector<real3>& aabb_max_data,
+                                     const std::vector<uint>& large_shapes,
+                                     const std::vector<uint>& large_shape_flags,
+                                     const std::vector<uint>& num_contact,
+                                     const std::vector<short2>& fam_data,
+                                     const std::vector<char>& body_active,
+                                     const std::vector<char>& body_collide,
+                                     const std::vector<uint>& body_id,
+                                     std::vector<long long>& potential_contacts) {
+    uint offset = num_contact[index];
+    if (num_contact[index + 1] == offset)
+        return;
+
+    uint count = 0;
+    for (uint shapeB : large_shapes) {
+        if (!check_large_pair(index, shapeB, aabb_min_data, aabb_max_data, large_shape_flags, fam_data, body_active,
+                              body_collide, body_id))
+            continue;
+        uint shapeA = index;
+        if (shapeB < shapeA) {
+            uint t = shapeA;
+            shapeA = shapeB;
+            shapeB = t;
+        }
+        // the two indices of the shapes that make up the contact
+        potential_contacts[offset + count] = ((long long)shapeA << 32 | (long long)shapeB);
+        count++;
+    }
+}
+
 // TWO LEVEL FUNCTIONS==========================================================
 
 /*
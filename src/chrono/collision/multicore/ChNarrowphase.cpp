@@ -14,6 +14,8 @@
 
 #include <algorithm>
 #include <climits>
+#include <stdexcept>
+#include <string>
 
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
@@ -40,7 +42,8 @@ ChNarrowphase::ChNarrowphase()
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
-      cd_data(nullptr) {}
+      cd_data(nullptr),
+      expanded_mesh_pairs(false) {}
 
 void ChNarrowphase::ClearContacts() {
     // Return now if no potential collisions.
@@ -87,6 +90,118 @@ void ChNarrowphase::ProcessRigids() {
 
 // -----------------------------------------------------------------------------
 
+// Find the faces of the triangle mesh shape 'mesh' overlapping the box with given center and half-dimensions.
+// The query box is expressed in the frame of the body owning the mesh.
+template <typename Callback>
+static void QueryMeshFaces(const ChCollisionData* cd_data,
+                           int mesh,
+                           const real3& center,
+                           const real3& hdims,
+                           Callback&& callback) {
+    const shape_container& shape_data = cd_data->shape_data;
+    uint ID = shape_data.id_rigid[mesh];
+    const real3& pos = (*cd_data->state_data.pos_rigid)[ID];
+    const quaternion& rot = (*cd_data->state_data.rot_rigid)[ID];
+
+    real3 local_center = TransformParentToLocal(pos, rot, center);
+    real3 local_hdims = AbsRotate(Inv(rot), hdims);
+
+    QueryMeshBVH(shape_data, shape_data.start_rigid[mesh], local_center - local_hdims, local_center + local_hdims,
+                 callback);
+}
+
+// Find the faces of the triangle mesh shape 'mesh' overlapping the (enlarged) AABB of the shape 'other'.
+template <typename Callback>
+static void QueryMeshCandidates(const ChCollisionData* cd_data, int mesh, int other, Callback&& callback) {
+    real3 center = cd_data->global_origin + 0.5 * (cd_data->aabb_max[other] + cd_data->aabb_min[other]);
+    real3 hdims = 0.5 * (cd_data->aabb_max[other] - cd_data->aabb_min[other]) + cd_data->collision_envelope;
+
+    QueryMeshFaces(cd_data, mesh, center, hdims, callback);
+}
+
+void ChNarrowphase::ExpandMeshPairs() {
+    const shape_container& shape_data = cd_data->shape_data;
+    if (shape_data.mesh_bvh.empty()) {
+        expanded_mesh_pairs = false;
+        return;
+    }
+
+    const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const std::vector<shape_type>& obj_data_T = shape_data.typ_rigid;
+    int num_pairs = (int)num_potential_rigid_contacts;
+
+    // Count the candidate pairs generated by each broadphase pair
+    mesh_pair_counts.resize(num_pairs + 1);
+    int num_mesh_mesh = 0;
+
+#pragma omp parallel for reduction(+ : num_mesh_mesh)
+    for (int index = 0; index < num_pairs; index++) {
+        vec2 pair = I2(int(pair_shapeIDs[index] >> 32), int(pair_shapeIDs[index] & 0xffffffff));
+        bool meshA = obj_data_T[pair.x] == ChCollisionShape::Type::TRIANGLEMESH;
+        bool meshB = obj_data_T[pair.y] == ChCollisionShape::Type::TRIANGLEMESH;
+        if (!meshA && !meshB) {
+            mesh_pair_counts[index] = 1;
+        } else if (meshA && meshB) {
+            // Mesh-mesh collisions are not supported
+            mesh_pair_counts[index] = 0;
+            num_mesh_mesh++;
+        } else {
+            uint count = 0;
+            QueryMeshCandidates(cd_data.get(), meshA ? pair.x : pair.y, meshA ? pair.y : pair.x,
+                                [&count](int) { count++; });
+            mesh_pair_counts[index] = count;
+        }
+    }
+    mesh_pair_counts[num_pairs] = 0;
+
+    if (num_mesh_mesh > 0) {
+        throw std::runtime_error("ChNarrowphase: collision between two triangle mesh shapes is not supported (" +
+                                 std::to_string(num_mesh_mesh) + " overlapping mesh-mesh pairs).");
+    }
+
+    Thrust_Exclusive_Scan(mesh_pair_counts);
+    uint num_candidates = mesh_pair_counts[num_pairs];
+
+    // Generate the candidate pairs, replacing the mesh shape with each overlapping face
+    mesh_pair_shapeIDs.resize(num_candidates);
+    mesh_pair_faces.resize(num_candidates);
+
+#pragma omp parallel for
+    for (int index = 0; index < num_pairs; index++) {
+        uint offset = mesh_pair_counts[index];
+        if (mesh_pair_counts[index + 1] == offset)
+            continue;
+        vec2 pair = I2(int(pair_shapeIDs[index] >> 32), int(pair_shapeIDs[index] & 0xffffffff));
+        bool meshA = obj_data_T[pair.x] == ChCollisionShape::Type::TRIANGLEMESH;
+        bool meshB = obj_data_T[pair.y] == ChCollisionShape::Type::TRIANGLEMESH;
+        if (!meshA && !meshB) {
+            mesh_pair_shapeIDs[offset] = pair_shapeIDs[index];
+            mesh_pair_faces[offset] = -1;
+        } else {
+            QueryMeshCandidates(cd_data.get(), meshA ? pair.x : pair.y, meshA ? pair.y : pair.x, [&](int f) {
+                mesh_pair_shapeIDs[offset] = pair_shapeIDs[index];
+                mesh_pair_faces[offset] = f;
+                offset++;
+            });
+        }
+    }
+
+    expanded_mesh_pairs = true;
+    num_potential_rigid_contacts = num_candidates;
+}
+
+void ChNarrowphase::LoadMeshFace(int shape, int face, ConvexShapeTriangle& triangle) const {
+    const shape_container& shape_data = cd_data->shape_data;
+    uint ID = shape_data.id_rigid[shape];
+    const real3& pos = (*cd_data->state_data.pos_rigid)[ID];
+    const quaternion& rot = (*cd_data->state_data.rot_rigid)[ID];
+    const uvec3& f = shape_data.mesh_faces[face];
+
+    triangle.tri[0] = TransformLocalToParent(pos, rot, shape_data.mesh_vertices[f.x]);
+    triangle.tri[1] = TransformLocalToParent(pos, rot, shape_data.mesh_vertices[f.y]);
+    triangle.tri[2] = TransformLocalToParent(pos, rot, shape_data.mesh_vertices[f.z]);
+}
+
 int ChNarrowphase::PreprocessCount() {
     // Set the number of potential contact points for each collision pair
     contact_index.resize(num_potential_rigid_contacts + 1);
@@ -104,7 +219,7 @@ int ChNarrowphase::PreprocessCount() {
         // shape type (per shape)
         const shape_type* obj_data_T = cd_data->shape_data.typ_rigid.data();
         // encoded shape IDs (per collision pair)
-        const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+        const long long* pair_shapeIDs = CandidatePairs().data();
 
 #pragma omp parallel for
         for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
@@ -113,6 +228,12 @@ int ChNarrowphase::PreprocessCount() {
             shape_type type1 = obj_data_T[pair.x];
             shape_type type2 = obj_data_T[pair.y];
 
+            // A candidate pair involving a triangle mesh is processed as a pair involving one of its faces
+            if (type1 == ChCollisionShape::Type::TRIANGLEMESH)
+                type1 = ChCollisionShape::Type::TRIANGLE;
+            if (type2 == ChCollisionShape::Type::TRIANGLEMESH)
+                type2 = ChCollisionShape::Type::TRIANGLE;
+
             // Set the maximum number of possible contacts for this particular pair
             if (type1 == ChCollisionShape::Type::SPHERE || type2 == ChCollisionShape::Type::SPHERE) {
                 contact_index[index] = 1;
@@ -139,9 +260,18 @@ int ChNarrowphase::PreprocessCount() {
     // Expand vector of shape IDs into contact_shapeIDs:
     // Replicate pair_shapeIDs[i] contact_index[i] times, for each potential contact for the collision pair 'i'
     cd_data->contact_shapeIDs.resize(num_potentialContacts);
-    Thrust_Expand(contact_index.begin(), contact_index.end() - 1, cd_data->pair_shapeIDs.begin(),
+    Thrust_Expand(contact_index.begin(), contact_index.end() - 1, CandidatePairs().begin(),
                   cd_data->contact_shapeIDs.begin());
 
+    // Similarly expand the mesh face indices, which distinguish contacts with different faces of the same mesh shape
+    cd_data->contact_faceIDs.resize(num_potentialContacts);
+    if (expanded_mesh_pairs) {
+        Thrust_Expand(contact_index.begin(), contact_index.end() - 1, mesh_pair_faces.begin(),
+                      cd_data->contact_faceIDs.begin());
+    } else {
+        Thrust_Fill(cd_data->contact_faceIDs, -1);
+    }
+
     // Set start index for the potential contacts for each collision pair
     Thrust_Exclusive_Scan(contact_index);
     assert(num_potentialContacts == (int)contact_index.back());
@@ -199,9 +329,12 @@ void ChNarrowphase::Dispatch_Init(uint index,
                                   uint& ID_A,
                                   uint& ID_B,
                                   ConvexShape* shapeA,
-                                  ConvexShape* shapeB) {
+                                  ConvexShape* shapeB,
+                                  ConvexShapeTriangle* face,
+                                  const ConvexBase*& candidateA,
+                                  const ConvexBase*& candidateB) {
     const std::vector<uint>& obj_data_ID = cd_data->shape_data.id_rigid;
-    const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const std::vector<long long>& pair_shapeIDs = CandidatePairs();
 
     // Unpack the identifiers for the two shapes involved in this collision
     long long p = pair_shapeIDs[index];
@@ -216,6 +349,20 @@ void ChNarrowphase::Dispatch_Init(uint index,
     shapeA->data = &cd_data->shape_data;
     shapeB->data = &cd_data->shape_data;
 
+    candidateA = shapeA;
+    candidateB = shapeB;
+
+    // Substitute a triangle mesh shape with the candidate face
+    if (expanded_mesh_pairs && mesh_pair_faces[index] >= 0) {
+        if (shapeA->Type() == ChCollisionShape::Type::TRIANGLEMESH) {
+            LoadMeshFace(pair.x, mesh_pair_faces[index], *face);
+            candidateA = face;
+        } else {
+            LoadMeshFace(pair.y, mesh_pair_faces[index], *face);
+            candidateB = face;
+        }
+    }
+
     //// TODO: what is the best way to dispatch this?
     icoll = contact_index[index];
 }
@@ -240,16 +387,20 @@ void ChNarrowphase::DispatchMPR() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle face;
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, face)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
-        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        const ConvexBase* candA;
+        const ConvexBase* candB;
+
+        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB, &face, candA, candB);
 
-        if (MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
+        if (MPRCollision(candA, candB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             // The number of contacts reported by MPR is always 1.
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
@@ -267,16 +418,20 @@ void ChNarrowphase::DispatchPRIMS() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle face;
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, face)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
-        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        const ConvexBase* candA;
+        const ConvexBase* candB;
+
+        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB, &face, candA, candB);
 
-        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
+        if (PRIMSCollision(candA, candB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
                            &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
         }
@@ -293,21 +448,25 @@ void ChNarrowphase::DispatchHybridMPR() {
 
     ConvexShape shapeA;
     ConvexShape shapeB;
+    ConvexShapeTriangle face;
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
-#pragma omp parallel for private(shapeA, shapeB)
+#pragma omp parallel for private(shapeA, shapeB, face)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
-        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+        const ConvexBase* candA;
+        const ConvexBase* candB;
 
-        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
+        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB, &face, candA, candB);
+
+        if (PRIMSCollision(candA, candB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
                            &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
-        } else if (MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
+        } else if (MPRCollision(candA, candB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
         }
@@ -326,8 +485,12 @@ void ChNarrowphase::ProcessRigidRigid() {
     std::vector<real>& erad_data = cd_data->erad_rigid_rigid;
     std::vector<vec2>& bids_data = cd_data->bids_rigid_rigid;
     std::vector<long long>& contact_shapeIDs = cd_data->contact_shapeIDs;
+    std::vector<int>& contact_faceIDs = cd_data->contact_faceIDs;
     uint& num_rigid_contacts = cd_data->num_rigid_contacts;
 
+    // Replace broadphase pairs involving triangle meshes with the candidate mesh faces.
+    ExpandMeshPairs();
+
     // Set maximum possible number of contacts for each potential collision
     // (depending on the narrowphase algorithm and on the types of shapes in
     // potential collision) and calculate the total number of potential contacts.
@@ -366,9 +529,10 @@ void ChNarrowphase::ProcessRigidRigid() {
     thrust::remove_if(
         THRUST_PAR thrust::make_zip_iterator(thrust::make_tuple(norm_data.begin(), cpta_data.begin(), cptb_data.begin(),
                                                                 dpth_data.begin(), erad_data.begin(), bids_data.begin(),
-                                                                contact_shapeIDs.begin())),
+                                                                contact_shapeIDs.begin(), contact_faceIDs.begin())),
         thrust::make_zip_iterator(thrust::make_tuple(norm_data.end(), cpta_data.end(), cptb_data.end(), dpth_data.end(),
-                                                     erad_data.end(), bids_data.end(), contact_shapeIDs.end())),
+                                                     erad_data.end(), bids_data.end(), contact_shapeIDs.end(),
+                                                     contact_faceIDs.end())),
         contact_rigid_active.begin(), thrust::logical_not<bool>());
 
     // Resize all lists so that we don't access invalid contacts
@@ -379,6 +543,7 @@ void ChNarrowphase::ProcessRigidRigid() {
     erad_data.resize(num_rigid_contacts);
     bids_data.resize(num_rigid_contacts);
     contact_shapeIDs.resize(num_rigid_contacts);
+    contact_faceIDs.resize(num_rigid_contacts);
 }
 
 // -----------------------------------------------------------------------------
@@ -615,6 +780,30 @@ void ChNarrowphase::ProcessRigidFluid() {
                 real3 Bmax = pos_sphere + real3(radius + envelope) - global_origin;
                 ConvexShapeSphere* shapeB = new ConvexShapeSphere(pos_sphere, sphere_radius * .5);
 
+                // Collide the fluid sphere with the given rigid shape (or face of a rigid triangle mesh shape)
+                auto process = [&](const ConvexBase* shapeA, uint bodyA) {
+                    if (contact_counts[p] >= max_rigid_neighbors)
+                        return;
+                    real3 ptA, ptB, norm;
+                    real depth, erad = 0;
+                    int nC = 0;
+                    if (PRIMSCollision(shapeA, shapeB, 2 * envelope, &norm, &ptA, &ptB, &depth, &erad, nC)) {
+                        if (nC == 1) {
+                            neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
+                            norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = norm;
+                            cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = ptA;
+                            dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = depth;
+                            contact_counts[p]++;
+                        }
+                    } else if (MPRCollision(shapeA, shapeB, envelope,
+                                            norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]],
+                                            cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]], ptB,
+                                            dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]])) {
+                        neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
+                        contact_counts[p]++;
+                    }
+                };
+
                 for (uint j = rigid_start; j < rigid_end; j++) {
                     if (contact_counts[p] < max_rigid_neighbors) {
                         uint shape_id_a = cd_data->bin_aabb_number[j];
@@ -623,30 +812,21 @@ void ChNarrowphase::ProcessRigidFluid() {
                         // if the sphere and the rigid body appear in the same bin more than once, dont count
                         if (current_bin(Amin, Amax, Bmin, Bmax, inv_bin_size, bins_per_axis, bin_number) == true) {
                             if (overlap(Amin, Amax, Bmin, Bmax) && collide(family, fam_data[shape_id_a])) {
-                                ConvexShape* shapeA = new ConvexShape(shape_id_a, &cd_data->shape_data);
-                                real3 ptA, ptB, norm;
-                                real depth, erad = 0;
-                                int nC = 0;
-                                if (PRIMSCollision(shapeA, shapeB, 2 * envelope, &norm, &ptA, &ptB, &depth, &erad,
-                                                   nC)) {
-                                    if (nC == 1) {
-                                        uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
-                                        neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
-                                        norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = norm;
-                                        cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = ptA;
-                                        dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = depth;
-                                        contact_counts[p]++;
-                                    }
-                                } else if (MPRCollision(
-                                               shapeA, shapeB, envelope,
-                                               norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]],
-                                               cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]], ptB,
-                                               dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]])) {
-                                    uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
-                                    neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
-                                    contact_counts[p]++;
+                                uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
+                                if (cd_data->shape_data.typ_rigid[shape_id_a] == ChCollisionShape::Type::TRIANGLEMESH) {
+                                    // The support functions do not handle triangle meshes: collide with the mesh faces
+                                    // overlapping the AABB of the sphere instead
+                                    ConvexShapeTriangle face;
+                                    QueryMeshFaces(cd_data.get(), shape_id_a, pos_sphere, real3(radius + envelope),
+                                                   [&](int f) {
+                                                       LoadMeshFace(shape_id_a, f, face);
+                                                       process(&face, bodyA);
+                                                   });
+                                } else {
+                                    ConvexShape* shapeA = new ConvexShape(shape_id_a, &cd_data->shape_data);
+                                    process(shapeA, bodyA);
+                                    delete shapeA;
                                 }
-                                delete shapeA;
                             }
                         }
                     }
@@ -43,6 +43,12 @@ namespace chrono {
 /// rcyl     |                                              N        N
 /// trimesh  |                                                       N
 /// </pre>
+///
+/// Triangle mesh shapes are stored with a bounding volume hierarchy over their faces. A broadphase pair involving a
+/// triangle mesh is replaced by one candidate pair for each mesh face overlapping the AABB of the other shape, and each
+/// such face is then processed as a stand-alone triangle. The index of that face is reported with each resulting
+/// contact (see ChCollisionData::contact_faceIDs). Collisions between two triangle meshes are not supported; an
+/// exception is thrown if the AABBs of two triangle mesh shapes (on bodies which may collide) overlap.
 class ChApi ChNarrowphase {
   public:
     /// Narrowphase algorithm
@@ -124,6 +130,18 @@ class ChApi ChNarrowphase {
     /// Perform collision detection fluid-fluid.
     void ProcessFluid();
 
+    /// Replace the broadphase pairs involving a triangle mesh shape with candidate pairs (one per mesh face
+    /// overlapping the AABB of the other shape).
+    void ExpandMeshPairs();
+
+    /// Return the list of candidate shape pairs (broadphase pairs, with mesh pairs expanded).
+    const std::vector<long long>& CandidatePairs() const {
+        return expanded_mesh_pairs ? mesh_pair_shapeIDs : cd_data->pair_shapeIDs;
+    }
+
+    /// Load the specified face of a triangle mesh shape, expressed in the global frame.
+    void LoadMeshFace(int shape, int face, ConvexShapeTriangle& triangle) const;
+
     /// Perform collision detection involving rigid shapes (rigid-rigid and rigid-fluid).
     void ProcessRigids();
     void ProcessRigidRigid();
@@ -132,7 +150,15 @@ class ChApi ChNarrowphase {
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
-    void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
+    void Dispatch_Init(uint index,
+                       uint& icoll,
+                       uint& ID_A,
+                       uint& ID_B,
+                       ConvexShape* shapeA,
+                       ConvexShape* shapeB,
+                       ConvexShapeTriangle* face,
+                       const ConvexBase*& candidateA,
+                       const ConvexBase*& candidateB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
     std::shared_ptr<ChCollisionData> cd_data;
@@ -142,6 +168,11 @@ class ChApi ChNarrowphase {
     std::vector<char> contact_fluid_active;
     std::vector<uint> contact_index;
 
+    bool expanded_mesh_pairs;                   ///< true if candidate pairs include triangle mesh faces
+    std::vector<long long> mesh_pair_shapeIDs;  ///< encoded shape IDs of candidate pairs (after mesh expansion)
+    std::vector<int> mesh_pair_faces;           ///< mesh face index of each candidate pair (-1 if no mesh involved)
+    std::vector<uint> mesh_pair_counts;         ///< number of candidate pairs for each broadphase pair
+
     uint num_potential_rigid_contacts;
     uint num_potential_fluid_contacts;
     uint num_potential_rigid_fluid_contacts;
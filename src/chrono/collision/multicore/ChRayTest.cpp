@@ -12,6 +12,8 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/collision/multicore/ChRayTest.h"
 #include "chrono/collision/multicore/ChCollisionUtils.h"
 
@@ -427,7 +429,24 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     // Walk through each bin intersected by the ray (DDA).
     ConvexShape shape(-1, &cd_data->shape_data);
     real mindist2 = C_REAL_MAX;
+    real ray_len = Length(ray);
     bool hit = false;
+    tested_meshes.clear();
+
+    // Test ray against the shapes processed outside the broadphase grid (two-level broadphase)
+    for (uint index : cd_data->large_shapes) {
+        num_shape_tests++;
+        shape.index = index;
+        real3 shape_normal;
+        bool shape_hit = (shape.Type() == ChCollisionShape::Type::TRIANGLEMESH)
+                             ? CheckMesh(shape, start, end, shape_normal, mindist2)
+                             : CheckShape(shape, start, end, shape_normal, mindist2);
+        if (shape_hit) {
+            hit = true;
+            info.shapeID = shape.index;
+            info.normal = shape_normal;
+        }
+    }
 
     ////std::cout << "Ray start: [" << start.x << "," << start.y << "," << start.z << "]" << std::endl;
     ////std::cout << "Ray end:   [" << end.x << "," << end.y << "," << end.z << "]" << std::endl;
@@ -445,32 +464,110 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
             num_shape_tests++;
             shape.index = bin_aabb_number[j];
             ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
+            real3 shape_normal;
+            bool shape_hit;
+            if (shape.Type() == ChCollisionShape::Type::TRIANGLEMESH) {
+                // A mesh spans several bins; test it only once
+                if (std::find(tested_meshes.begin(), tested_meshes.end(), shape.index) != tested_meshes.end())
+                    continue;
+                tested_meshes.push_back(shape.index);
+                shape_hit = CheckMesh(shape, start, end, shape_normal, mindist2);
+            } else {
+                shape_hit = CheckShape(shape, start, end, shape_normal, mindist2);
+            }
+            if (shape_hit) {
                 hit = true;
+                info.shapeID = shape.index;  // Identifier of closest hit shape
+                info.normal = shape_normal;  // Normal at intersection with closest shape
+            }
         }
 
-        // If a shape in the current bin was hit, stop.
-        if (hit) {
-            info.shapeID = shape.index;         // Identifier of closest hit shape
-            info.dist = Sqrt(mindist2);         // Distance from ray origin
-            info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
-            info.point = start + info.t * ray;  // Intersection point
-            break;
-        }
-
-        // Move to the next cell (the one with lowest t_next)
+        // Find the ray parameter at exit from the current bin (the lowest t_next)
         static const int map[8] = {2, 1, 2, 1, 2, 2, 0, 0};
         int k = ((t_next[0] < t_next[1]) << 2) + ((t_next[0] < t_next[2]) << 1) + ((t_next[1] < t_next[2]));
         int axis = map[k];
+
+        // If a shape was hit before the ray exits the current bin, stop (shapes in the next bins can only be hit
+        // farther from the ray origin).
+        if (hit && Sqrt(mindist2) <= t_next[axis] * ray_len)
+            break;
+
+        // Move to the next cell
         bin[axis] += step[axis];
         if (bin[axis] == exit[axis])
             break;
         t_next[axis] += delta[axis];
     }
 
+    if (hit) {
+        info.dist = Sqrt(mindist2);         // Distance from ray origin
+        info.t = info.dist / ray_len;       // Ray parameter at intersection with closest shape
+        info.point = start + info.t * ray;  // Intersection point
+    }
+
     return hit;
 }
 
+// Test for intersection with the faces of a triangle mesh shape. The ray is expressed in the mesh frame and the mesh BVH
+// is traversed, pruning the nodes not intersected by the ray or intersected farther than the current 'mindist2'.
+bool ChRayTest::CheckMesh(const ConvexShape& shape,
+                          const real3& start,
+                          const real3& end,
+                          real3& normal,
+                          real& mindist2) {
+    const mesh_bvh_node* nodes = cd_data->shape_data.mesh_bvh.data();
+    const real3* vertices = cd_data->shape_data.mesh_vertices.data();
+    const uvec3* faces = cd_data->shape_data.mesh_faces.data();
+
+    // Express the ray in the mesh frame
+    real3 pos = shape.A();
+    quaternion rot = shape.R();
+    real3 start_M = RotateT(start - pos, rot);
+    real3 end_M = RotateT(end - pos, rot);
+    real ray_len2 = Length2(end_M - start_M);
+
+    real3 normal_M;
+    bool found = false;
+
+    int stack[64];
+    int top = 0;
+    stack[top++] = cd_data->shape_data.start_rigid[shape.index];
+
+    while (top > 0) {
+        int index = stack[--top];
+        const mesh_bvh_node& node = nodes[index];
+
+        // Prune the node if the ray misses its AABB or enters it beyond the closest intersection found so far
+        real3 center = 0.5 * (node.aabb_max + node.aabb_min);
+        real3 hdims = 0.5 * (node.aabb_max - node.aabb_min);
+        real t;
+        real3 loc;
+        real3 aabb_normal;
+        if (!aabb_ray(hdims, start_M - center, end_M - center, t, loc, aabb_normal) || t * t * ray_len2 > mindist2)
+            continue;
+
+        if (node.count == 0) {
+            stack[top++] = node.first;
+            stack[top++] = index + 1;
+            continue;
+        }
+
+        for (int f = node.first; f < node.first + node.count; f++) {
+            real3 face_normal;
+            if (triangle_ray(vertices[faces[f].x], vertices[faces[f].y], vertices[faces[f].z], start_M, end_M,
+                             face_normal, mindist2)) {
+                normal_M = face_normal;
+                found = true;
+            }
+        }
+    }
+
+    if (found)
+        normal = Rotate(normal_M, rot);
+
+    return found;
+}
+
 // Narrowphase dispatcher for ray intersection test.  It uses analytical formulaes for known primitive shapes with
 // fallback on a generic ray-convex intersection test.
 bool ChRayTest::CheckShape(const ConvexBase& shape,
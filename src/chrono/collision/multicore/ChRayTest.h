@@ -63,9 +63,18 @@ class ChApi ChRayTest {
                     real& mindist2            ///< [output] smallest squared distance to ray origin
     );
 
+    /// Ray intersection test with a triangle mesh shape (traversal of the mesh BVH).
+    bool CheckMesh(const ConvexShape& shape,  ///< candidate triangle mesh shape
+                   const real3& start,        ///< ray start point
+                   const real3& end,          ///< ray end point
+                   real3& normal,             ///< [output] normal to shape at intersectin point
+                   real& mindist2             ///< [output] smallest squared distance to ray origin
+    );
+
     std::shared_ptr<ChCollisionData> cd_data;  ///< shared collision detection data
     uint num_bin_tests;                        ///< number of bins visited during last ray test
     uint num_shape_tests;                      ///< number of shape checked during last ray test
+    std::vector<int> tested_meshes;            ///< triangle mesh shapes already checked during current ray test
 };
 
 /// @} collision_mc
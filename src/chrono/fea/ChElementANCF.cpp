@@ -0,0 +1,103 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+#include "chrono/fea/ChElementANCF.h"
+
+namespace chrono {
+namespace fea {
+
+// Combine the given value into a hash key.
+static void HashCombine(size_t& key, long long val) {
+    key ^= std::hash<long long>()(val) + 0x9e3779b9 + (key << 6) + (key >> 2);
+}
+
+bool ChElementANCF::MatricesMatch(const ChMatrixDynamic_col<>& A, const ChMatrixDynamic_col<>& B, double tolerance) {
+    if (A.rows() != B.rows() || A.cols() != B.cols())
+        return false;
+    if (A.size() == 0)
+        return true;
+    double scale = A.cwiseAbs().maxCoeff();
+    return (A - B).cwiseAbs().maxCoeff() <= tolerance * scale;
+}
+
+std::shared_ptr<const ChElementANCF::PreIntMatrices> ChElementANCF::SharePreIntMatrices(
+    std::shared_ptr<PreIntMatrices> matrices,
+    const std::type_info& type) const {
+    const auto& O1 = matrices->O1;
+
+    // Hash the element type, the matrix size, and a sample of the diagonal entries of O1.  The sampled entries are
+    // quantized relative to the largest entry of O1 so that round-off differences in the precomputed matrices (e.g.,
+    // for translated elements) do not change the key.
+    matrices->type_hash = type.hash_code();
+    size_t key = matrices->type_hash;
+    HashCombine(key, O1.rows());
+    double scale = O1.size() > 0 ? O1.cwiseAbs().maxCoeff() : 0;
+    if (scale > 0) {
+        HashCombine(key, std::llround(std::log2(scale) * 1024));
+        Eigen::Index stride = std::max<Eigen::Index>(1, O1.rows() / 16);
+        for (Eigen::Index i = 0; i < O1.rows(); i += stride)
+            HashCombine(key, std::llround(O1(i, i) / scale * 1048576));
+    }
+    matrices->key = key;
+
+    if (!m_shared_precompute)
+        return matrices;
+
+    // Registry of the precomputed matrices currently in use (not owned by the registry)
+    static std::mutex registry_mutex;
+    static std::unordered_multimap<size_t, std::weak_ptr<const PreIntMatrices>> registry;
+    static size_t registry_limit = 64;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+
+    // Look for a matching set of matrices, discarding entries no longer referenced by any element
+    auto range = registry.equal_range(key);
+    for (auto it = range.first; it != range.second;) {
+        auto existing = it->second.lock();
+        if (!existing) {
+            it = registry.erase(it);
+            continue;
+        }
+        if (existing->type_hash == matrices->type_hash &&
+            MatricesMatch(existing->O1, matrices->O1, m_shared_precompute_tolerance) &&
+            MatricesMatch(existing->K3Compact, matrices->K3Compact, m_shared_precompute_tolerance)) {
+            return existing;
+        }
+        ++it;
+    }
+
+    registry.emplace(key, matrices);
+
+    // Occasionally purge the entire registry of entries no longer referenced by any element
+    if (registry.size() > registry_limit) {
+        for (auto it = registry.begin(); it != registry.end();) {
+            if (it->second.expired())
+                it = registry.erase(it);
+            else
+                ++it;
+        }
+        registry_limit = std::max<size_t>(64, 2 * registry.size());
+    }
+
+    return matrices;
+}
+
+}  // end namespace fea
+}  // end namespace chrono
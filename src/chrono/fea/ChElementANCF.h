@@ -15,6 +15,12 @@
 #ifndef CH_ELEMENT_ANCF_H
 #define CH_ELEMENT_ANCF_H
 
+#include <algorithm>
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+#include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChQuadrature.h"
 
 namespace chrono {
@@ -26,15 +32,158 @@ namespace fea {
 /// Base class for ANCF elements.
 class ChApi ChElementANCF {
   public:
-    ChElementANCF() : m_full_dof(true), m_element_dof(0) {}
+    ChElementANCF()
+        : m_full_dof(true),
+          m_element_dof(0),
+          m_precompute_stamp(0),
+          m_shared_precompute(false),
+          m_shared_precompute_tolerance(1e-10) {}
     virtual ~ChElementANCF() {}
 
+    /// Return true if the generalized internal forces of this element can be evaluated in a batch with other elements.
+    /// Batched evaluation is supported for elements using the "Pre-Integration" internal force calculation method.
+    virtual bool IsBatchable() const { return false; }
+
+    /// Return a hash of the precomputed matrices used in batched evaluation of the internal forces.
+    /// Elements of the same type with identical precomputed matrices (e.g., elements with the same dimensions,
+    /// material, and reference shape up to a translation) return the same key.
+    virtual size_t GetBatchKey() const { return 0; }
+
+    /// Return true if this element can be processed in the same batch as the specified element.
+    virtual bool IsBatchCompatible(const ChElementANCF* other) const { return false; }
+
+    /// Compute the generalized internal forces for a batch of compatible elements (see IsBatchCompatible).
+    /// On return, column i of Fi contains the generalized internal force vector of the i-th element in the batch.
+    virtual void ComputeInternalForcesBatch(const std::vector<ChElementANCF*>& elements, ChMatrixDynamic_col<>& Fi) {}
+
+    /// Return a counter incremented every time the precomputed matrices of this element are regenerated.
+    unsigned int GetPrecomputeStamp() const { return m_precompute_stamp; }
+
+    /// Enable/disable sharing of the "Pre-Integration" precomputed matrices of this element (default: false).
+    /// If enabled, this element references the precomputed matrices of another element of the same type with sharing
+    /// enabled, if these matrices match (within the specified relative tolerance). This is typically the case for
+    /// elements with the same dimensions, material, and reference shape (up to a translation), as generated for
+    /// structured meshes. This setting must be specified before the element is initialized. Sharing can also be enabled
+    /// for all ANCF elements of a mesh (see ChMesh::EnableSharedPrecompute).
+    void EnableSharedPrecompute(bool val, double tolerance = 1e-10) {
+        m_shared_precompute = val;
+        m_shared_precompute_tolerance = tolerance;
+    }
+
+    /// Return true if sharing of the "Pre-Integration" precomputed matrices is enabled for this element.
+    bool IsSharedPrecomputeEnabled() const { return m_shared_precompute; }
+
+    /// Return the number of elements referencing the "Pre-Integration" precomputed matrices of this element.
+    /// Return 0 if the element does not use the "Pre-Integration" method or it was not initialized yet.
+    long GetPrecomputeUseCount() const { return m_preint ? m_preint.use_count() : 0; }
+
   protected:
-    int m_element_dof;           ///< actual number of degrees of freedom for the element
-    bool m_full_dof;             ///< true if all node variables are active (not fixed)
-    ChArray<int> m_mapping_dof;  ///< indices of active DOFs (set only is some are fixed)
+    /// Precomputed matrices for the "Pre-Integration" internal force and Jacobian calculation.
+    struct PreIntMatrices {
+        ChMatrixDynamic_col<> O1;         ///< matrix combined with the nodal coordinates for the internal forces
+        ChMatrixDynamic_col<> O2;         ///< matrix combined with the nodal coordinates for the Jacobian
+        ChMatrixDynamic_col<> K3Compact;  ///< matrix combined with the nodal coordinates for the internal forces
+        size_t type_hash;                 ///< hash code of the type of the owning element(s)
+        size_t key;                       ///< hash of the matrix O1 (used for lookup and for batching)
+    };
+
+    /// Finalize a newly generated set of "Pre-Integration" matrices for this element, of the specified type.
+    /// If sharing is enabled and a matching set is already in use by another element, return that one instead.
+    std::shared_ptr<const PreIntMatrices> SharePreIntMatrices(std::shared_ptr<PreIntMatrices> matrices,
+                                                              const std::type_info& type) const;
+
+    /// Check if two precomputed matrices are equal within the given tolerance, relative to the largest entry of A.
+    static bool MatricesMatch(const ChMatrixDynamic_col<>& A, const ChMatrixDynamic_col<>& B, double tolerance);
+
+    /// Check if the two specified elements of type E can be processed in the same "Pre-Integration" batch.
+    /// The matrices O1 of the two elements must match within the tolerance used for sharing precomputed matrices.
+    template <class E>
+    static bool IsBatchCompatiblePreInt(const E* element, const ChElementANCF* other);
+
+    /// Hash of the "Pre-Integration" matrix O1 for an element of type E (see SharePreIntMatrices).
+    template <class E>
+    static size_t GetBatchKeyPreInt(const E* element);
+
+    /// Compute the generalized internal forces for a batch of elements of type E using the "Pre-Integration" method.
+    /// The matrix O1, shared by all elements in the batch, multiplies the matrices PI1 of all elements (stored as
+    /// columns) in a single matrix-matrix product.
+    template <class E>
+    static void ComputeInternalForcesBatchPreInt(const std::vector<ChElementANCF*>& elements,
+                                                 ChMatrixDynamic_col<>& Fi);
+
+    int m_element_dof;                     ///< actual number of degrees of freedom for the element
+    bool m_full_dof;                       ///< true if all node variables are active (not fixed)
+    ChArray<int> m_mapping_dof;            ///< indices of active DOFs (set only is some are fixed)
+    unsigned int m_precompute_stamp;       ///< number of times the precomputed matrices were generated
+    bool m_shared_precompute;              ///< share the precomputed matrices with matching elements
+    double m_shared_precompute_tolerance;  ///< relative tolerance for matching precomputed matrices
+
+    std::shared_ptr<const PreIntMatrices> m_preint;  ///< (possibly shared) "Pre-Integration" precomputed matrices
 };
 
+// -----------------------------------------------------------------------------
+
+template <class E>
+bool ChElementANCF::IsBatchCompatiblePreInt(const E* element, const ChElementANCF* other) {
+    auto other_element = dynamic_cast<const E*>(other);
+    if (!other_element || !element->IsBatchable() || !other_element->IsBatchable())
+        return false;
+    if (!element->m_preint || !other_element->m_preint)
+        return false;
+    if (element->m_preint == other_element->m_preint)
+        return true;
+    double tolerance = std::min(element->m_shared_precompute_tolerance, other_element->m_shared_precompute_tolerance);
+    return MatricesMatch(element->m_preint->O1, other_element->m_preint->O1, tolerance);
+}
+
+template <class E>
+size_t ChElementANCF::GetBatchKeyPreInt(const E* element) {
+    return element->m_preint ? element->m_preint->key : 0;
+}
+
+template <class E>
+void ChElementANCF::ComputeInternalForcesBatchPreInt(const std::vector<ChElementANCF*>& elements,
+                                                     ChMatrixDynamic_col<>& Fi) {
+    constexpr int NSF = E::NSF;
+    int num_elements = (int)elements.size();
+
+    // Calculate PI1 for all elements in the batch and store it as columns of a single matrix
+    ChMatrixDynamic_col<> PI1(NSF * NSF, num_elements);
+    for (int i = 0; i < num_elements; i++) {
+        auto element = static_cast<E*>(elements[i]);
+
+        typename E::Matrix3xN ebar;
+        element->CalcCoordMatrix(ebar);
+        typename E::MatrixNxN PI1_matrix = 0.5 * ebar.transpose() * ebar;
+
+        if (element->m_damping_enabled) {
+            typename E::Matrix3xN ebardot;
+            element->CalcCoordDtMatrix(ebardot);
+            PI1_matrix += element->m_Alpha * ebardot.transpose() * ebar;
+        }
+
+        PI1.col(i) = Eigen::Map<ChVectorN<double, NSF * NSF>>(PI1_matrix.data(), PI1_matrix.size());
+    }
+
+    // Calculate the matrices K1 of all elements with a single matrix-matrix product
+    ChMatrixDynamic_col<> K1 = static_cast<E*>(elements[0])->m_preint->O1 * PI1;
+
+    // Combine K1 and K3 for each element (saved for the Jacobian calculation) and calculate the internal forces
+    Fi.resize(3 * NSF, num_elements);
+    for (int i = 0; i < num_elements; i++) {
+        auto element = static_cast<E*>(elements[i]);
+
+        typename E::Matrix3xN ebar;
+        element->CalcCoordMatrix(ebar);
+
+        Eigen::Map<const typename E::MatrixNxN> K1_matrix(K1.col(i).data());
+        element->m_K13Compact.noalias() = K1_matrix - element->m_preint->K3Compact;
+
+        typename E::MatrixNx3 QiCompactLiu = element->m_K13Compact * ebar.transpose();
+        Fi.col(i) = Eigen::Map<typename E::Vector3N>(QiCompactLiu.data(), QiCompactLiu.size());
+    }
+}
+
 /// @} fea_elements
 
 }  // end namespace fea
@@ -15,6 +15,8 @@
 #ifndef CHELEMENTBASE_H
 #define CHELEMENTBASE_H
 
+#include <limits>
+
 #include "chrono/physics/ChLoadable.h"
 #include "chrono/core/ChFrame.h"
 #include "chrono/solver/ChSystemDescriptor.h"
@@ -114,6 +116,10 @@ class ChApi ChElementBase {
     ///    Md += c*diag(M)    or   Md += c*HRZ(M)    or other lumping heuristics
     virtual void EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, double& error, const double c){};
 
+    /// Return an estimate of the critical (stable) time step of explicit integrators with lumped mass for this element.
+    /// The default implementation returns infinity, i.e. no stability limit is known.
+    virtual double EstimateCriticalTimeStep() { return std::numeric_limits<double>::infinity(); }
+
     /// Add the contribution of gravity loads, multiplied by a scaling factor c, as:
     ///   R += M * g * c
     /// Note that it is up to the element implementation to build a proper g vector that
@@ -132,6 +138,11 @@ class ChApi ChElementBase {
     /// coefficients Kfactor, Rfactor,and Mfactor, respectively.
     virtual void LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) = 0;
 
+    /// Return true if LoadKRMMatrices can be called concurrently for this and other elements.
+    /// Elements that temporarily modify the state of their nodes while computing the KRM matrices (e.g., for
+    /// numerical differentiation) must return false; these are processed sequentially by the mesh.
+    virtual bool IsKRMLoadThreadSafe() const { return true; }
+
     /// Add the internal forces, expressed as nodal forces, into the encapsulated ChVariables.
     /// Update the 'fb' part: qf+=forces*factor
     /// WILL BE DEPRECATED - see EleIntLoadResidual_F
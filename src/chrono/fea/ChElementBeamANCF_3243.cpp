@@ -85,7 +85,7 @@ void ChElementBeamANCF_3243::SetNodes(std::shared_ptr<ChNodeFEAxyzDDD> nodeA, st
     // Check to see if SetupInitial has already been called (i.e. at least one set of precomputed matrices has been
     // populated).  If so, the precomputed matrices will need to be re-generated.  If not, this will be handled once
     // SetupInitial is called.
-    if (m_SD.size() + m_O1.size() > 0) {
+    if (m_SD.size() > 0 || m_preint) {
         PrecomputeInternalForceMatricesWeights();
     }
 }
@@ -105,7 +105,7 @@ void ChElementBeamANCF_3243::SetDimensions(double lenX, double thicknessY, doubl
     // Check to see if SetupInitial has already been called (i.e. at least one set of precomputed matrices has been
     // populated).  If so, the precomputed matrices will need to be re-generated.  If not, this will be handled once
     // SetupInitial is called.
-    if (m_SD.size() + m_O1.size() > 0) {
+    if (m_SD.size() > 0 || m_preint) {
         PrecomputeInternalForceMatricesWeights();
     }
 }
@@ -119,7 +119,7 @@ void ChElementBeamANCF_3243::SetMaterial(std::shared_ptr<ChMaterialBeamANCF> bea
     // generated and thus need to be regenerated.  The Continuous Integration precomputed matrices do not include any
     // material properties.
     if (m_method == IntFrcMethod::PreInt) {
-        if (m_O1.size() > 0) {
+        if (m_preint) {
             PrecomputeInternalForceMatricesWeights();
         }
     }
@@ -143,7 +143,7 @@ void ChElementBeamANCF_3243::SetIntFrcCalcMethod(IntFrcMethod method) {
     // Check to see if SetupInitial has already been called (i.e. at least one set of precomputed matrices has been
     // populated).  If so, the precomputed matrices will need to be generated if they do not already exist or
     // regenerated if they have to ensure they are in sync with any other element changes.
-    if (m_SD.size() + m_O1.size() > 0) {
+    if (m_SD.size() > 0 || m_preint) {
         PrecomputeInternalForceMatricesWeights();
     }
 }
@@ -414,6 +414,21 @@ void ChElementBeamANCF_3243::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     }
 }
 
+// Batched evaluation of the generalized internal forces ("Pre-Integration" method only).
+
+size_t ChElementBeamANCF_3243::GetBatchKey() const {
+    return GetBatchKeyPreInt(this);
+}
+
+bool ChElementBeamANCF_3243::IsBatchCompatible(const ChElementANCF* other) const {
+    return IsBatchCompatiblePreInt(this, other);
+}
+
+void ChElementBeamANCF_3243::ComputeInternalForcesBatch(const std::vector<ChElementANCF*>& elements,
+                                                        ChMatrixDynamic_col<>& Fi) {
+    ComputeInternalForcesBatchPreInt<ChElementBeamANCF_3243>(elements, Fi);
+}
+
 // Calculate the global matrix H as a linear combination of K, R, and M:
 //   H = Mfactor * [M] + Kfactor * [K] + Rfactor * [R]
 
@@ -777,6 +792,7 @@ void ChElementBeamANCF_3243::PrecomputeInternalForceMatricesWeights() {
         PrecomputeInternalForceMatricesWeightsContInt();
     else
         PrecomputeInternalForceMatricesWeightsPreInt();
+    m_precompute_stamp++;
 }
 
 // Precalculate constant matrices for the internal force calculations when using the "Continuous Integration" style
@@ -864,14 +880,19 @@ void ChElementBeamANCF_3243::PrecomputeInternalForceMatricesWeightsPreInt() {
     unsigned int GQ_idx_xi = NP - 1;        // Gauss-Quadrature table index for xi
     unsigned int GQ_idx_eta_zeta = NT - 1;  // Gauss-Quadrature table index for eta and zeta
 
-    m_O1.resize(NSF * NSF, NSF * NSF);
-    m_O2.resize(NSF * NSF, NSF * NSF);
-    m_K3Compact.resize(NSF, NSF);
+    auto preint = chrono_types::make_shared<PreIntMatrices>();
+    ChMatrixDynamic_col<>& O1 = preint->O1;
+    ChMatrixDynamic_col<>& O2 = preint->O2;
+    ChMatrixDynamic_col<>& K3Compact = preint->K3Compact;
+
+    O1.resize(NSF * NSF, NSF * NSF);
+    O2.resize(NSF * NSF, NSF * NSF);
+    K3Compact.resize(NSF, NSF);
     m_K13Compact.resize(NSF, NSF);
 
     m_K13Compact.setZero();
-    m_K3Compact.setZero();
-    m_O1.setZero();
+    K3Compact.setZero();
+    O1.setZero();
 
     // =============================================================================
     // =============================================================================
@@ -918,15 +939,15 @@ void ChElementBeamANCF_3243::PrecomputeInternalForceMatricesWeightsPreInt() {
                 double GQWeight_det_J_0xi = -J_0xi.determinant() * GQ_weight;
 
                 // Shortcut for:
-                // m_K3Compact += GQWeight_det_J_0xi * 0.5 * (Sxi_D_0xi*D11*Sxi_D_0xi.transpose() + Sxi_D_0xi *
+                // K3Compact += GQWeight_det_J_0xi * 0.5 * (Sxi_D_0xi*D11*Sxi_D_0xi.transpose() + Sxi_D_0xi *
                 // D22*Sxi_D_0xi.transpose() + Sxi_D_0xi * D33*Sxi_D_0xi.transpose());
-                m_K3Compact += GQWeight_det_J_0xi * 0.5 *
-                               (D0(0) * Sxi_D_0xi.template block<NSF, 1>(0, 0) *
-                                    Sxi_D_0xi.template block<NSF, 1>(0, 0).transpose() +
-                                D0(1) * Sxi_D_0xi.template block<NSF, 1>(0, 1) *
-                                    Sxi_D_0xi.template block<NSF, 1>(0, 1).transpose() +
-                                D0(2) * Sxi_D_0xi.template block<NSF, 1>(0, 2) *
-                                    Sxi_D_0xi.template block<NSF, 1>(0, 2).transpose());
+                K3Compact += GQWeight_det_J_0xi * 0.5 *
+                             (D0(0) * Sxi_D_0xi.template block<NSF, 1>(0, 0) *
+                                  Sxi_D_0xi.template block<NSF, 1>(0, 0).transpose() +
+                              D0(1) * Sxi_D_0xi.template block<NSF, 1>(0, 1) *
+                                  Sxi_D_0xi.template block<NSF, 1>(0, 1).transpose() +
+                              D0(2) * Sxi_D_0xi.template block<NSF, 1>(0, 2) *
+                                  Sxi_D_0xi.template block<NSF, 1>(0, 2).transpose());
 
                 MatrixNxN scale;
                 for (unsigned int n = 0; n < 3; n++) {
@@ -938,8 +959,7 @@ void ChElementBeamANCF_3243::PrecomputeInternalForceMatricesWeightsPreInt() {
                             Sxi_D_0xi.template block<NSF, 1>(0, n) * Sxi_D_0xi.template block<NSF, 1>(0, c).transpose();
                         for (unsigned int f = 0; f < NSF; f++) {
                             for (unsigned int t = 0; t < NSF; t++) {
-                                m_O1.block<NSF, NSF>(NSF * t, NSF * f) +=
-                                    scale(t, f) * Sxi_D_0xi_n_Sxi_D_0xi_c_transpose;
+                                O1.block<NSF, NSF>(NSF * t, NSF * f) += scale(t, f) * Sxi_D_0xi_n_Sxi_D_0xi_c_transpose;
                             }
                         }
                     }
@@ -1027,9 +1047,9 @@ void ChElementBeamANCF_3243::PrecomputeInternalForceMatricesWeightsPreInt() {
         MatrixNx3c Sxi_D_0xi = Sxi_D * J_0xi.inverse();
         double GQWeight_det_J_0xi = -J_0xi.determinant() * GQ_weight;
 
-        m_K3Compact += GQWeight_det_J_0xi * 0.5 *
-                       (Sxi_D_0xi * D11 * Sxi_D_0xi.transpose() + Sxi_D_0xi * D22 * Sxi_D_0xi.transpose() +
-                        Sxi_D_0xi * D33 * Sxi_D_0xi.transpose());
+        K3Compact += GQWeight_det_J_0xi * 0.5 *
+                     (Sxi_D_0xi * D11 * Sxi_D_0xi.transpose() + Sxi_D_0xi * D22 * Sxi_D_0xi.transpose() +
+                      Sxi_D_0xi * D33 * Sxi_D_0xi.transpose());
 
         MatrixNxN scale;
         for (unsigned int n = 0; n < 3; n++) {
@@ -1041,7 +1061,7 @@ void ChElementBeamANCF_3243::PrecomputeInternalForceMatricesWeightsPreInt() {
                     Sxi_D_0xi.template block<NSF, 1>(0, n) * Sxi_D_0xi.template block<NSF, 1>(0, c).transpose();
                 for (unsigned int f = 0; f < NSF; f++) {
                     for (unsigned int t = 0; t < NSF; t++) {
-                        m_O1.block<NSF, NSF>(NSF * t, NSF * f) += scale(t, f) * Sxi_D_0xi_n_Sxi_D_0xi_c_transpose;
+                        O1.block<NSF, NSF>(NSF * t, NSF * f) += scale(t, f) * Sxi_D_0xi_n_Sxi_D_0xi_c_transpose;
                     }
                 }
             }
@@ -1051,9 +1071,12 @@ void ChElementBeamANCF_3243::PrecomputeInternalForceMatricesWeightsPreInt() {
     // Since O2 is just a reordered version of O1, wait until O1 is completely calculated and then generate O2 from it
     for (unsigned int f = 0; f < NSF; f++) {
         for (unsigned int t = 0; t < NSF; t++) {
-            m_O2.block<NSF, NSF>(NSF * t, NSF * f) = m_O1.block<NSF, NSF>(NSF * t, NSF * f).transpose();
+            O2.block<NSF, NSF>(NSF * t, NSF * f) = O1.block<NSF, NSF>(NSF * t, NSF * f).transpose();
         }
     }
+
+    // Share the precomputed matrices with other elements with identical reference geometry and material, if possible
+    m_preint = SharePreIntMatrices(preint, typeid(ChElementBeamANCF_3243));
 }
 
 // -----------------------------------------------------------------------------
@@ -1706,10 +1729,10 @@ void ChElementBeamANCF_3243::ComputeInternalForcesContIntPreInt(ChVectorDynamic<
 
     // Calculate the matrix K1 in mapped vector form and the resulting matrix will be in the correct form to combine
     // with K3
-    K1_vec.noalias() = m_O1 * PI1;
+    K1_vec.noalias() = m_preint->O1 * PI1;
 
     // Store the combined sum of K1 and K3 since it will be used again in the Jacobian calculation
-    m_K13Compact.noalias() = K1_matrix - m_K3Compact;
+    m_K13Compact.noalias() = K1_matrix - m_preint->K3Compact;
 
     // Multiply the combined K1 and K3 matrix by the nodal coordinates in compact form and then remap it into the
     // required vector order that is the generalized internal force vector
@@ -2898,7 +2921,7 @@ void ChElementBeamANCF_3243::ComputeInternalJacobianPreInt(ChMatrixRef& H,
 
     // Calculate the matrix containing the dense part of the Jacobian matrix in a reordered form. This is then reordered
     // from its [9 x NSF^2] form into its required [3*NSF x 3*NSF] form
-    ChMatrixNM_col<double, 9, NSF* NSF> K2 = -PI2 * m_O2;
+    ChMatrixNM_col<double, 9, NSF* NSF> K2 = -PI2 * m_preint->O2;
 
     for (unsigned int k = 0; k < NSF; k++) {
         for (unsigned int f = 0; f < NSF; f++) {
@@ -268,6 +268,10 @@ class ChApi ChElementBeamEuler : public ChElementBeam,
     /// This is needed so that it can be accessed by ChLoaderVolumeGravity
     virtual double GetDensity() override;
 
+    /// The numerical evaluation of the KR matrices perturbs the state of the (shared) nodes,
+    /// so it cannot run concurrently with other elements.
+    virtual bool IsKRMLoadThreadSafe() const override { return !use_numerical_diff_for_KR; }
+
     bool use_numerical_diff_for_KR = false;
 
   private:
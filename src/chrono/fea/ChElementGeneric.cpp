@@ -12,6 +12,10 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "chrono/fea/ChElementGeneric.h"
 #include "chrono/physics/ChLoadable.h"
 #include "chrono/physics/ChLoad.h"
@@ -83,6 +87,35 @@ void ChElementGeneric::EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, double& er
     }
 }
 
+double ChElementGeneric::EstimateCriticalTimeStep() {
+    ChMatrixDynamic<> K(GetNumCoordsPosLevel(), GetNumCoordsPosLevel());
+    ChMatrixDynamic<> R(GetNumCoordsPosLevel(), GetNumCoordsPosLevel());
+    ChMatrixDynamic<> M(GetNumCoordsPosLevel(), GetNumCoordsPosLevel());
+    ComputeKRMmatricesGlobal(K, 1.0, 0, 0);
+    ComputeKRMmatricesGlobal(R, 0, 1.0, 0);
+    ComputeMmatrixGlobal(M);
+
+    // Gershgorin bounds on the largest eigenvalues of Md^-1/2 * K * Md^-1/2 and Md^-1/2 * R * Md^-1/2
+    // (coordinates without mass are skipped)
+    ChVectorDynamic<> inv_sqrt_m(M.rows());
+    for (Eigen::Index i = 0; i < M.rows(); i++)
+        inv_sqrt_m(i) = M(i, i) > 0 ? 1 / std::sqrt(M(i, i)) : 0;
+
+    double lambda_max = 0;
+    double eta_max = 0;
+    for (Eigen::Index i = 0; i < K.rows(); i++) {
+        lambda_max = std::max(lambda_max, inv_sqrt_m(i) * K.row(i).cwiseAbs().dot(inv_sqrt_m));
+        eta_max = std::max(eta_max, inv_sqrt_m(i) * R.row(i).cwiseAbs().dot(inv_sqrt_m));
+    }
+
+    if (lambda_max <= 0)
+        return std::numeric_limits<double>::infinity();
+
+    // The critical time step of the central difference scheme is 2/omega_max*(sqrt(1+xi^2)-xi), with the damping
+    // ratio xi = eta/(2*omega); this is decreasing in both omega and eta, so the bounds above keep it conservative
+    return 4 / (std::sqrt(4 * lambda_max + eta_max * eta_max) + eta_max);
+}
+
 void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector3d& G_acc, const double c) {
     ChVectorDynamic<> Fg(GetNumCoordsPosLevel());
     ComputeGravityForces(Fg, G_acc);
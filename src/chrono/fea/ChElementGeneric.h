@@ -56,6 +56,12 @@ class ChApi ChElementGeneric : public ChElementBase {
     /// This default implementation is VERY INEFFICIENT.
     virtual void EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, double& error, const double c) override;
 
+    /// Return an estimate of the critical time step of explicit integrators with the lumped mass of this element.
+    /// The largest eigenvalue of the stiffness matrix scaled by the diagonal of the mass matrix is bounded from above
+    /// with the Gershgorin theorem, so that the estimate is conservative. Damping reduces the estimate accordingly.
+    /// This default implementation is INEFFICIENT.
+    virtual double EstimateCriticalTimeStep() override;
+
     /// Add the contribution of gravity loads, multiplied by a scaling factor c, as:
     ///   R += M * g * c
     /// This default implementation is VERY INEFFICIENT.
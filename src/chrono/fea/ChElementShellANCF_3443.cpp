@@ -97,7 +97,7 @@ void ChElementShellANCF_3443::SetNodes(std::shared_ptr<ChNodeFEAxyzDDD> nodeA,
     // Check to see if SetupInitial has already been called (i.e. at least one set of precomputed matrices has been
     // populated).  If so, the precomputed matrices will need to be re-generated.  If not, this will be handled once
     // SetupInitial is called.
-    if (m_SD.size() + m_O1.size() > 0) {
+    if (m_SD.size() > 0 || m_preint) {
         PrecomputeInternalForceMatricesWeights();
     }
 }
@@ -115,7 +115,7 @@ void ChElementShellANCF_3443::AddLayer(double thickness, double theta, std::shar
     // Check to see if SetupInitial has already been called (i.e. at least one set of precomputed matrices has been
     // populated).  If so, the precomputed matrices will need to be re-generated.  If not, this will be handled once
     // SetupInitial is called.
-    if (m_SD.size() + m_O1.size() > 0) {
+    if (m_SD.size() > 0 || m_preint) {
         PrecomputeInternalForceMatricesWeights();
     }
 }
@@ -133,7 +133,7 @@ void ChElementShellANCF_3443::SetDimensions(double lenX, double lenY) {
     // Check to see if SetupInitial has already been called (i.e. at least one set of precomputed matrices has been
     // populated).  If so, the precomputed matrices will need to be re-generated.  If not, this will be handled once
     // SetupInitial is called.
-    if (m_SD.size() + m_O1.size() > 0) {
+    if (m_SD.size() > 0 || m_preint) {
         PrecomputeInternalForceMatricesWeights();
     }
 }
@@ -147,7 +147,7 @@ void ChElementShellANCF_3443::SetMidsurfaceOffset(const double offset) {
     // Check to see if SetupInitial has already been called (i.e. at least one set of precomputed matrices has been
     // populated).  If so, the precomputed matrices will need to be re-generated.  If not, this will be handled once
     // SetupInitial is called.
-    if (m_SD.size() + m_O1.size() > 0) {
+    if (m_SD.size() > 0 || m_preint) {
         PrecomputeInternalForceMatricesWeights();
     }
 }
@@ -170,7 +170,7 @@ void ChElementShellANCF_3443::SetIntFrcCalcMethod(IntFrcMethod method) {
     // Check to see if SetupInitial has already been called (i.e. at least one set of precomputed matrices has been
     // populated).  If so, the precomputed matrices will need to be generated if they do not already exist or
     // regenerated if they have to ensure they are in sync with any other element changes.
-    if (m_SD.size() + m_O1.size() > 0) {
+    if (m_SD.size() > 0 || m_preint) {
         PrecomputeInternalForceMatricesWeights();
     }
 }
@@ -473,6 +473,21 @@ void ChElementShellANCF_3443::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     }
 }
 
+// Batched evaluation of the generalized internal forces ("Pre-Integration" method only).
+
+size_t ChElementShellANCF_3443::GetBatchKey() const {
+    return GetBatchKeyPreInt(this);
+}
+
+bool ChElementShellANCF_3443::IsBatchCompatible(const ChElementANCF* other) const {
+    return IsBatchCompatiblePreInt(this, other);
+}
+
+void ChElementShellANCF_3443::ComputeInternalForcesBatch(const std::vector<ChElementANCF*>& elements,
+                                                         ChMatrixDynamic_col<>& Fi) {
+    ComputeInternalForcesBatchPreInt<ChElementShellANCF_3443>(elements, Fi);
+}
+
 // Calculate the global matrix H as a linear combination of K, R, and M:
 //   H = Mfactor * [M] + Kfactor * [K] + Rfactor * [R]
 
@@ -891,6 +906,7 @@ void ChElementShellANCF_3443::PrecomputeInternalForceMatricesWeights() {
         PrecomputeInternalForceMatricesWeightsContInt();
     else
         PrecomputeInternalForceMatricesWeightsPreInt();
+    m_precompute_stamp++;
 }
 
 // Precalculate constant matrices for the internal force calculations when using the "Continuous Integration" style
@@ -949,14 +965,19 @@ void ChElementShellANCF_3443::PrecomputeInternalForceMatricesWeightsPreInt() {
     unsigned int GQ_idx_xi_eta = NP - 1;  // Gauss-Quadrature table index for xi and eta
     unsigned int GQ_idx_zeta = NT - 1;    // Gauss-Quadrature table index for zeta
 
-    m_O1.resize(NSF * NSF, NSF * NSF);
-    m_O2.resize(NSF * NSF, NSF * NSF);
-    m_K3Compact.resize(NSF, NSF);
+    auto preint = chrono_types::make_shared<PreIntMatrices>();
+    ChMatrixDynamic_col<>& O1 = preint->O1;
+    ChMatrixDynamic_col<>& O2 = preint->O2;
+    ChMatrixDynamic_col<>& K3Compact = preint->K3Compact;
+
+    O1.resize(NSF * NSF, NSF * NSF);
+    O2.resize(NSF * NSF, NSF * NSF);
+    K3Compact.resize(NSF, NSF);
     m_K13Compact.resize(NSF, NSF);
 
     m_K13Compact.setZero();
-    m_K3Compact.setZero();
-    m_O1.setZero();
+    K3Compact.setZero();
+    O1.setZero();
 
     for (size_t kl = 0; kl < m_numLayers; kl++) {
         double thickness = m_layers[kl].GetThickness();
@@ -1043,9 +1064,9 @@ void ChElementShellANCF_3443::PrecomputeInternalForceMatricesWeightsPreInt() {
                     MatrixNx3c Sxi_D_0xi = Sxi_D * J_0xi.inverse();
                     double GQWeight_det_J_0xi = -J_0xi.determinant() * GQ_weight;
 
-                    m_K3Compact += GQWeight_det_J_0xi * 0.5 *
-                                   (Sxi_D_0xi * D11 * Sxi_D_0xi.transpose() + Sxi_D_0xi * D22 * Sxi_D_0xi.transpose() +
-                                    Sxi_D_0xi * D33 * Sxi_D_0xi.transpose());
+                    K3Compact += GQWeight_det_J_0xi * 0.5 *
+                                 (Sxi_D_0xi * D11 * Sxi_D_0xi.transpose() + Sxi_D_0xi * D22 * Sxi_D_0xi.transpose() +
+                                  Sxi_D_0xi * D33 * Sxi_D_0xi.transpose());
 
                     MatrixNxN scale;
                     for (unsigned int n = 0; n < 3; n++) {
@@ -1058,7 +1079,7 @@ void ChElementShellANCF_3443::PrecomputeInternalForceMatricesWeightsPreInt() {
                                 Sxi_D_0xi.template block<NSF, 1>(0, c).transpose();
                             for (unsigned int f = 0; f < NSF; f++) {
                                 for (unsigned int t = 0; t < NSF; t++) {
-                                    m_O1.block<NSF, NSF>(NSF * t, NSF * f) +=
+                                    O1.block<NSF, NSF>(NSF * t, NSF * f) +=
                                         scale(t, f) * Sxi_D_0xi_n_Sxi_D_0xi_c_transpose;
                                 }
                             }
@@ -1072,9 +1093,12 @@ void ChElementShellANCF_3443::PrecomputeInternalForceMatricesWeightsPreInt() {
     // Since O2 is just a reordered version of O1, wait until O1 is completely calculated and then generate O2 from it
     for (unsigned int f = 0; f < NSF; f++) {
         for (unsigned int t = 0; t < NSF; t++) {
-            m_O2.block<NSF, NSF>(NSF * t, NSF * f) = m_O1.block<NSF, NSF>(NSF * t, NSF * f).transpose();
+            O2.block<NSF, NSF>(NSF * t, NSF * f) = O1.block<NSF, NSF>(NSF * t, NSF * f).transpose();
         }
     }
+
+    // Share the precomputed matrices with other elements with identical reference geometry and material, if possible
+    m_preint = SharePreIntMatrices(preint, typeid(ChElementShellANCF_3443));
 }
 
 // -----------------------------------------------------------------------------
@@ -1504,10 +1528,10 @@ void ChElementShellANCF_3443::ComputeInternalForcesContIntPreInt(ChVectorDynamic
 
     // Calculate the matrix K1 in mapped vector form and the resulting matrix will be in the correct form to combine
     // with K3
-    K1_vec.noalias() = m_O1 * PI1;
+    K1_vec.noalias() = m_preint->O1 * PI1;
 
     // Store the combined sum of K1 and K3 since it will be used again in the Jacobian calculation
-    m_K13Compact.noalias() = K1_matrix - m_K3Compact;
+    m_K13Compact.noalias() = K1_matrix - m_preint->K3Compact;
 
     // Multiply the combined K1 and K3 matrix by the nodal coordinates in compact form and then remap it into the
     // required vector order that is the generalized internal force vector
@@ -2424,7 +2448,7 @@ void ChElementShellANCF_3443::ComputeInternalJacobianPreInt(ChMatrixRef& H, doub
 
     // Calculate the matrix containing the dense part of the Jacobian matrix in a reordered form. This is then reordered
     // from its [9 x NSF^2] form into its required [3*NSF x 3*NSF] form
-    ChMatrixNM_col<double, 9, NSF* NSF> K2 = -PI2 * m_O2;
+    ChMatrixNM_col<double, 9, NSF* NSF> K2 = -PI2 * m_preint->O2;
 
     for (unsigned int k = 0; k < NSF; k++) {
         for (unsigned int f = 0; f < NSF; f++) {
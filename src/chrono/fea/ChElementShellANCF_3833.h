@@ -273,6 +273,23 @@ class ChApi ChElementShellANCF_3833 : public ChElementANCF,
     /// Compute the generalized force vector due to gravity using the efficient ANCF specific method
     virtual void ComputeGravityForces(ChVectorDynamic<>& Fg, const ChVector3d& G_acc) override;
 
+    // Interface to ChElementANCF base class
+    // -------------------------------------
+
+    /// Return true if the generalized internal forces can be evaluated in a batch with other elements.
+    /// This is the case if the "Pre-Integration" method is used for the internal force calculation.
+    virtual bool IsBatchable() const override { return m_method == IntFrcMethod::PreInt; }
+
+    /// Return a hash of the precomputed "Pre-Integration" matrices used in batched evaluation of the internal forces.
+    virtual size_t GetBatchKey() const override;
+
+    /// Return true if this element can be processed in the same batch as the specified element.
+    virtual bool IsBatchCompatible(const ChElementANCF* other) const override;
+
+    /// Compute the generalized internal forces for a batch of compatible elements.
+    virtual void ComputeInternalForcesBatch(const std::vector<ChElementANCF*>& elements,
+                                            ChMatrixDynamic_col<>& Fi) override;
+
     // Interface to ChElementShell base class
     // --------------------------------------
 
@@ -526,16 +543,12 @@ class ChApi ChElementShellANCF_3833 : public ChElementANCF,
                ///< Gauss quadrature points used for the "Continuous Integration" style method
     ChMatrixDynamic_col<> m_kGQ;  ///< Precomputed Gauss-Quadrature Weight & Element Jacobian scale factors used for the
                                   ///< "Continuous Integration" style method
-    ChMatrixDynamic_col<> m_O1;   ///< Precomputed Matrix combined with the nodal coordinates used for the
-                                  ///< "Pre-Integration" style method internal force calculation
-    ChMatrixDynamic_col<> m_O2;   ///< Precomputed Matrix combined with the nodal coordinates used for the
-                                  ///< "Pre-Integration" style method Jacobian calculation
-    ChMatrixDynamic_col<> m_K3Compact;  ///< Precomputed Matrix combined with the nodal coordinates used for the
-                                        ///< "Pre-Integration" style method internal force calculation
     ChMatrixDynamic_col<>
         m_K13Compact;  ///< Saved results from the generalized internal force calculation that are reused
                        ///< for the Jacobian calculations for the "Pre-Integration" style method
 
+    friend class ChElementANCF;
+
   public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
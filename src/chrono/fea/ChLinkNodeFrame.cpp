@@ -12,9 +12,11 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChIndexedNodes.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/fea/ChLinkNodeFrame.h"
+#include "chrono/fea/ChNodeFEAxyzrot.h"
 
 namespace chrono {
 namespace fea {
@@ -430,6 +432,119 @@ void ChLinkNodeFrame::IntLoadConstraint_C(const unsigned int off_L,  // offset i
     Qc(off_L + 2) += cres.z();
 }
 
+// Project the node and body states onto the constraint, using the lumped masses of the node and of the body (fixed
+// bodies and bodies of unknown type are treated as infinitely massive). The node position and velocity at the
+// attachment point are corrected with impulses weighted by the effective inverse mass of the constraint, i.e.
+//    W = Mn^-1 + Mb^-1 - [r]x * Jb^-1 * [r]x
+// where r is the attachment point relative to the body origin and Jb^-1 the inverse lumped inertia (absolute frame).
+bool ChLinkNodeFrame::IntProjectLumped(const unsigned int off_x,
+                                       ChState& x,
+                                       const unsigned int off_v,
+                                       ChStateDelta& v,
+                                       const unsigned int off_L,
+                                       ChVectorDynamic<>& L,
+                                       const ChVectorDynamic<>& Md,
+                                       const double dt,
+                                       const bool project_positions) {
+    if (!IsActive())
+        return true;
+
+    // State offsets of the node and of the body (if not fixed)
+    bool node_free = !m_node->IsFixed();
+    unsigned int node_off_x = m_node->NodeGetOffsetPosLevel();
+    unsigned int node_off_v = m_node->NodeGetOffsetVelLevel();
+
+    bool body_free = false;
+    unsigned int body_off_x = 0;
+    unsigned int body_off_v = 0;
+    if (auto body = dynamic_cast<ChBody*>(m_body.get())) {
+        body_free = !body->IsFixed();
+        body_off_x = body->GetOffset_x();
+        body_off_v = body->GetOffset_w();
+    } else if (auto node = dynamic_cast<ChNodeFEAxyzrot*>(m_body.get())) {
+        body_free = !node->IsFixed();
+        body_off_x = node->NodeGetOffsetPosLevel();
+        body_off_v = node->NodeGetOffsetVelLevel();
+    }
+
+    if (!node_free && !body_free)
+        return true;
+
+    // Current node and body states
+    ChVector3d pos_n = node_free ? ChVector3d(x.segment(node_off_x, 3)) : m_node->GetPos();
+    ChVector3d vel_n = node_free ? ChVector3d(v.segment(node_off_v, 3)) : m_node->GetPosDt();
+    ChVector3d pos_b = body_free ? ChVector3d(x.segment(body_off_x, 3)) : m_body->GetPos();
+    ChQuaterniond rot_b = body_free ? ChQuaterniond(x.segment(body_off_x + 3, 4)) : m_body->GetRot();
+    ChVector3d vel_b = body_free ? ChVector3d(v.segment(body_off_v, 3)) : m_body->GetPosDt();
+    ChVector3d wloc_b = body_free ? ChVector3d(v.segment(body_off_v + 3, 3)) : m_body->GetAngVelLocal();
+
+    // Inverse lumped masses
+    ChVector3d inv_m_n(0);
+    ChVector3d inv_m_b(0);
+    ChVector3d inv_J_b(0);
+    for (int i = 0; i < 3; i++) {
+        if (node_free)
+            inv_m_n[i] = 1 / Md(node_off_v + i);
+        if (body_free) {
+            inv_m_b[i] = 1 / Md(body_off_v + i);
+            inv_J_b[i] = 1 / Md(body_off_v + 3 + i);
+        }
+    }
+
+    // Effective inverse mass of the constraint
+    auto inverse_mass = [&](const ChMatrix33<>& R, const ChVector3d& r) {
+        ChStarMatrix33<> r_tilde(r);
+        ChMatrix33<> W = -r_tilde * R * inv_J_b.eigen().asDiagonal() * R.transpose() * r_tilde;
+        W.diagonal() += (inv_m_n + inv_m_b).eigen();
+        return W;
+    };
+
+    ChMatrix33<> R(rot_b);
+    ChVector3d r = R * m_csys.pos;
+
+    // Position projection
+    if (project_positions) {
+        ChVector3d C = pos_n - (pos_b + r);
+        ChVector3d delta = -(inverse_mass(R, r).inverse() * C.eigen());
+
+        pos_n += inv_m_n * delta;
+        pos_b -= inv_m_b * delta;
+        ChVector3d rotvec = -(inv_J_b * (R.transpose() * r.Cross(delta)));
+        rot_b = rot_b * QuatFromRotVec(rotvec);
+        rot_b.Normalize();
+
+        R = ChMatrix33<>(rot_b);
+        r = R * m_csys.pos;
+    }
+
+    // Velocity projection
+    ChVector3d u = vel_n - (vel_b + (R * wloc_b).Cross(r));
+    ChVector3d P = -(inverse_mass(R, r).inverse() * u.eigen());
+
+    vel_n += inv_m_n * P;
+    vel_b -= inv_m_b * P;
+    wloc_b -= inv_J_b * (R.transpose() * r.Cross(P));
+
+    // Reaction force on the node, expressed in the link frame
+    ChMatrix33<> Arw = R * ChMatrix33<>(m_csys.rot);
+    ChVector3d react = Arw.transpose() * (P / dt);
+    L.segment(off_L, 3) += react.eigen();
+
+    // Store corrected states
+    if (node_free) {
+        x.segment(node_off_x, 3) = pos_n.eigen();
+        v.segment(node_off_v, 3) = vel_n.eigen();
+    }
+    if (body_free) {
+        x.segment(body_off_x, 3) = pos_b.eigen();
+        x.segment(body_off_x + 3, 4) = rot_b.eigen();
+        v.segment(body_off_v, 3) = vel_b.eigen();
+        v.segment(body_off_v + 3, 3) = wloc_b.eigen();
+    }
+
+    return true;
+}
+
 void ChLinkNodeFrame::IntToDescriptor(const unsigned int off_v,
                                       const ChStateDelta& v,
                                       const ChVectorDynamic<>& R,
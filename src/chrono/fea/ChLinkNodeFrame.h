@@ -120,6 +120,16 @@ class ChApi ChLinkNodeFrame : public ChLinkBase {
                                      const double c,
                                      bool do_clamp,
                                      double recovery_clamp) override;
+    virtual bool CanProjectLumped() override { return true; }
+    virtual bool IntProjectLumped(const unsigned int off_x,
+                                  ChState& x,
+                                  const unsigned int off_v,
+                                  ChStateDelta& v,
+                                  const unsigned int off_L,
+                                  ChVectorDynamic<>& L,
+                                  const ChVectorDynamic<>& Md,
+                                  const double dt,
+                                  const bool project_positions) override;
     virtual void IntToDescriptor(const unsigned int off_v,
                                  const ChStateDelta& v,
                                  const ChVectorDynamic<>& R,
@@ -16,14 +16,17 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
 
+#include "chrono/fea/ChElementANCF.h"
 #include "chrono/fea/ChElementTetraCorot_4.h"
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
@@ -45,6 +48,15 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     automatic_gravity_load = other.automatic_gravity_load;
     num_points_gravity = other.num_points_gravity;
 
+    batched_internal_forces = other.batched_internal_forces;
+    batches_updated = false;
+
+    shared_precompute = other.shared_precompute;
+    shared_precompute_tolerance = other.shared_precompute_tolerance;
+
+    mass_scaling_step = other.mass_scaling_step;
+    num_mass_scaled = 0;
+
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
 }
@@ -64,9 +76,17 @@ void ChMesh::SetupInitial() {
     }
 
     for (unsigned int i = 0; i < velements.size(); i++) {
+        // enable sharing of precomputed matrices on ANCF elements, if requested for the entire mesh
+        if (shared_precompute) {
+            if (auto ancf_element = std::dynamic_pointer_cast<ChElementANCF>(velements[i]))
+                ancf_element->EnableSharedPrecompute(true, shared_precompute_tolerance);
+        }
+
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    batches_updated = false;
 }
 
 void ChMesh::Relax() {
@@ -107,6 +127,7 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    batches_updated = false;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -118,6 +139,7 @@ void ChMesh::ClearNodes() {
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
+    batches_updated = false;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -292,10 +314,26 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
 
     // elements internal forces
     timer_internal_forces.start();
-    //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+    if (batched_internal_forces) {
+        UpdateElementBatches();
+
+        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthreads)
+        for (int ib = 0; ib < element_batches.size(); ib++) {
+            LoadBatchInternalForces(element_batches[ib], R, c);
+        }
+
+        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+        for (int ie = 0; ie < single_elements.size(); ie++) {
+            single_elements[ie]->EleIntLoadResidual_F(R, c);
+        }
+    } else {
+        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+        for (int ie = 0; ie < velements.size(); ie++) {
+            velements[ie]->EleIntLoadResidual_F(R, c);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
@@ -331,6 +369,120 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
     }
 }
 
+// -----------------------------------------------------------------------------
+// Batched evaluation of element internal forces
+// -----------------------------------------------------------------------------
+
+// Maximum number of elements in a batch.
+// Elements in a batch are processed by a single thread; limiting the batch size allows parallel processing of large
+// groups of compatible elements while still reusing each precomputed matrix for several elements.
+static const size_t max_batch_size = 8;
+
+void ChMesh::EnableBatchedInternalForces(bool val) {
+    batched_internal_forces = val;
+    batches_updated = false;
+}
+
+unsigned int ChMesh::GetNumBatchedElements() {
+    if (!batched_internal_forces)
+        return 0;
+    UpdateElementBatches();
+    size_t num_batched = 0;
+    for (const auto& batch : element_batches)
+        num_batched += batch.elements.size();
+    return (unsigned int)num_batched;
+}
+
+void ChMesh::UpdateElementBatches() {
+    // Check if any element changed its precomputed matrices or calculation method since the batches were created
+    if (batches_updated) {
+        for (const auto& batch : element_batches) {
+            for (size_t i = 0; i < batch.elements.size(); i++) {
+                if (!batch.ancf_elements[i]->IsBatchable() ||
+                    batch.ancf_elements[i]->GetPrecomputeStamp() != batch.stamps[i]) {
+                    batches_updated = false;
+                    break;
+                }
+            }
+            if (!batches_updated)
+                break;
+        }
+    }
+
+    if (batches_updated)
+        return;
+
+    element_batches.clear();
+    single_elements.clear();
+
+    // Group batchable elements with identical precomputed matrices (candidates are first selected by key)
+    std::vector<std::vector<std::pair<ChElementBase*, ChElementANCF*>>> groups;
+    std::unordered_map<size_t, std::vector<size_t>> key_groups;
+    for (const auto& element : velements) {
+        auto ancf_element = dynamic_cast<ChElementANCF*>(element.get());
+        if (!ancf_element || !ancf_element->IsBatchable()) {
+            single_elements.push_back(element.get());
+            continue;
+        }
+
+        auto& candidates = key_groups[ancf_element->GetBatchKey()];
+        bool found = false;
+        for (auto ig : candidates) {
+            if (ancf_element->IsBatchCompatible(groups[ig].front().second)) {
+                groups[ig].push_back(std::make_pair(element.get(), ancf_element));
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            candidates.push_back(groups.size());
+            groups.push_back({std::make_pair(element.get(), ancf_element)});
+        }
+    }
+
+    // Split each group in batches of limited size; elements without any compatible element are processed individually
+    for (const auto& group : groups) {
+        if (group.size() == 1) {
+            single_elements.push_back(group.front().first);
+            continue;
+        }
+        size_t num_batches = (group.size() + max_batch_size - 1) / max_batch_size;
+        for (size_t ib = 0; ib < num_batches; ib++) {
+            ElementBatch batch;
+            for (size_t i = ib * group.size() / num_batches; i < (ib + 1) * group.size() / num_batches; i++) {
+                batch.elements.push_back(group[i].first);
+                batch.ancf_elements.push_back(group[i].second);
+                batch.stamps.push_back(group[i].second->GetPrecomputeStamp());
+            }
+            element_batches.push_back(batch);
+        }
+    }
+
+    batches_updated = true;
+}
+
+void ChMesh::LoadBatchInternalForces(const ElementBatch& batch, ChVectorDynamic<>& R, double c) {
+    ChMatrixDynamic_col<> Fi;
+    batch.ancf_elements.front()->ComputeInternalForcesBatch(batch.ancf_elements, Fi);
+
+    //// Attention: this is called from within a parallel OMP for loop.
+    //// Must use atomic increment when updating the global vector R.
+
+    for (size_t ie = 0; ie < batch.elements.size(); ie++) {
+        auto element = batch.elements[ie];
+        unsigned int stride = 0;
+        for (unsigned int in = 0; in < element->GetNumNodes(); in++) {
+            unsigned int node_dofs = element->GetNodeNumCoordsPosLevelActive(in);
+            if (!element->GetNode(in)->IsFixed()) {
+                for (unsigned int j = 0; j < node_dofs; j++)
+#pragma omp atomic
+                    R(element->GetNode(in)->NodeGetOffsetVelLevel() + j) += c * Fi(stride + j, ie);
+            }
+            stride += element->GetNodeNumCoordsPosLevel(in);
+        }
+    }
+}
+
 void ChMesh::ComputeMassProperties(double& mass,           // ChMesh object mass
                                    ChVector3d& com,        // ChMesh center of gravity
                                    ChMatrix33<>& inertia)  // ChMesh inertia tensor
@@ -432,11 +584,57 @@ void ChMesh::IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md,
     }
 
     // internal masses
+    if (mass_scaling_step <= 0) {
+        for (unsigned int ie = 0; ie < velements.size(); ie++) {
+            velements[ie]->EleIntLoadLumpedMass_Md(Md, err, c);
+        }
+        return;
+    }
+
+    // internal masses, scaled for elements with a critical time step smaller than the target
+    std::vector<double> steps;
+    ComputeElementCriticalTimeSteps(steps);
+    num_mass_scaled = 0;
     for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadLumpedMass_Md(Md, err, c);
+        double factor = 1;
+        if (steps[ie] > 0 && steps[ie] < mass_scaling_step) {
+            factor = (mass_scaling_step / steps[ie]) * (mass_scaling_step / steps[ie]);
+            num_mass_scaled++;
+        }
+        velements[ie]->EleIntLoadLumpedMass_Md(Md, err, c * factor);
     }
 }
 
+void ChMesh::ComputeElementCriticalTimeSteps(std::vector<double>& steps) {
+    int nthreads = GetSystem() ? GetSystem()->nthreads_chrono : 1;
+
+    steps.resize(velements.size());
+
+    // Elements with non thread-safe KRM evaluation are processed sequentially afterwards.
+    serial_elements.resize(velements.size());
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+    for (int ie = 0; ie < velements.size(); ie++) {
+        serial_elements[ie] = !velements[ie]->IsKRMLoadThreadSafe();
+        if (!serial_elements[ie])
+            steps[ie] = velements[ie]->EstimateCriticalTimeStep();
+    }
+    for (int ie = 0; ie < velements.size(); ie++) {
+        if (serial_elements[ie])
+            steps[ie] = velements[ie]->EstimateCriticalTimeStep();
+    }
+}
+
+double ChMesh::EstimateCriticalTimeStep() {
+    std::vector<double> steps;
+    ComputeElementCriticalTimeSteps(steps);
+
+    double step = std::numeric_limits<double>::infinity();
+    for (auto element_step : steps)
+        step = std::min(step, mass_scaling_step > 0 ? std::max(element_step, mass_scaling_step) : element_step);
+
+    return step;
+}
+
 void ChMesh::IntToDescriptor(const unsigned int off_v,
                              const ChStateDelta& v,
                              const ChVectorDynamic<>& R,
@@ -476,9 +674,21 @@ void ChMesh::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
     int nthreads = GetSystem()->nthreads_chrono;
 
     timer_KRMload.start();
-#pragma omp parallel for num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+
+    // Each element loads its own KRM block, so no synchronization is needed.
+    // Elements with non thread-safe KRM evaluation are processed sequentially afterwards.
+    serial_elements.resize(velements.size());
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+    for (int ie = 0; ie < velements.size(); ie++) {
+        serial_elements[ie] = !velements[ie]->IsKRMLoadThreadSafe();
+        if (!serial_elements[ie])
+            velements[ie]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    }
+    for (int ie = 0; ie < velements.size(); ie++) {
+        if (serial_elements[ie])
+            velements[ie]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    }
+
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
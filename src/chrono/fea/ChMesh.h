@@ -32,6 +32,8 @@ class ChAssembly;
 
 namespace fea {
 
+class ChElementANCF;
+
 /// @addtogroup chrono_fea
 /// @{
 
@@ -43,6 +45,12 @@ class ChApi ChMesh : public ChIndexedNodes {
           n_dofs_w(0),
           automatic_gravity_load(true),
           num_points_gravity(1),
+          batched_internal_forces(false),
+          batches_updated(false),
+          shared_precompute(false),
+          shared_precompute_tolerance(1e-10),
+          mass_scaling_step(0),
+          num_mass_scaled(0),
           ncalls_internal_forces(0),
           ncalls_KRMload(0) {}
     ChMesh(const ChMesh& other);
@@ -84,6 +92,41 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Override default in ChPhysicsItem.
     virtual bool IsCollisionEnabled() const override { return true; }
 
+    /// Enable batched evaluation of element internal forces (default: false).
+    /// If enabled, ANCF elements using the "Pre-Integration" internal force calculation method are grouped in batches
+    /// of elements of the same type with matching precomputed matrices (e.g., elements with the same dimensions,
+    /// material, and reference shape up to a translation). The internal forces of all elements in a batch are then
+    /// evaluated with a single matrix-matrix product. All other elements are processed individually.
+    /// Precomputed matrices are matched within the tolerance used for sharing them between elements (see
+    /// ChElementANCF::EnableSharedPrecompute). Enabling sharing on batched elements also reduces memory traffic.
+    void EnableBatchedInternalForces(bool val);
+
+    /// Get the number of elements processed in batches (see EnableBatchedInternalForces).
+    unsigned int GetNumBatchedElements();
+
+    /// Enable sharing of the "Pre-Integration" precomputed matrices between all matching ANCF elements of this mesh.
+    /// If enabled, sharing is turned on (with the specified relative tolerance) for every ANCF element of the mesh
+    /// when the mesh is initialized, overriding the per-element setting (see ChElementANCF::EnableSharedPrecompute).
+    /// Identical elements are then detected automatically, typically in structured meshes. If disabled (default), the
+    /// per-element settings are used. This setting must be specified before the mesh is initialized.
+    void EnableSharedPrecompute(bool val, double tolerance = 1e-10) {
+        shared_precompute = val;
+        shared_precompute_tolerance = tolerance;
+    }
+
+    /// Set the target time step for mass scaling with explicit integrators (default: 0, i.e. no mass scaling).
+    /// If positive, the lumped mass of each element with an estimated critical time step (see
+    /// ChElementBase::EstimateCriticalTimeStep) smaller than the target is scaled so that its critical time step
+    /// matches the target. Only the lumped mass used by explicit integrators is affected.
+    void SetMassScaling(double target_step) { mass_scaling_step = target_step; }
+
+    /// Get the number of elements with scaled mass at the last evaluation of the lumped mass (see SetMassScaling).
+    unsigned int GetNumMassScaledElements() const { return num_mass_scaled; }
+
+    /// Return the smallest estimated critical time step of the mesh elements for explicit integrators with lumped
+    /// mass, accounting for mass scaling (if enabled). Elements are processed in parallel.
+    double EstimateCriticalTimeStep();
+
     /// Reset counters for internal force and Jacobian evaluations.
     void ResetCounters() {
         ncalls_internal_forces = 0;
@@ -276,6 +319,22 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Batch of elements whose internal forces are evaluated together.
+    struct ElementBatch {
+        std::vector<ChElementANCF*> ancf_elements;  ///< elements in batch (ANCF interface)
+        std::vector<ChElementBase*> elements;       ///< elements in batch (generic interface)
+        std::vector<unsigned int> stamps;           ///< element precompute stamps when the batch was created
+    };
+
+    /// Group elements in batches for internal force evaluation (if not up to date).
+    void UpdateElementBatches();
+
+    /// Evaluate the internal forces of the elements in the given batch and load them in the residual R.
+    void LoadBatchInternalForces(const ElementBatch& batch, ChVectorDynamic<>& R, double c);
+
+    /// Estimate the critical time step of all elements (without mass scaling).
+    void ComputeElementCriticalTimeSteps(std::vector<double>& steps);
+
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
@@ -288,6 +347,19 @@ class ChApi ChMesh : public ChIndexedNodes {
     bool automatic_gravity_load;
     int num_points_gravity;
 
+    bool batched_internal_forces;                 ///< evaluate internal forces of compatible elements in batches
+    bool batches_updated;                         ///< element batches up to date
+    std::vector<ElementBatch> element_batches;    ///< batches of compatible elements
+    std::vector<ChElementBase*> single_elements;  ///< elements not included in any batch
+
+    bool shared_precompute;              ///< enable sharing of precomputed matrices for all ANCF elements
+    double shared_precompute_tolerance;  ///< relative tolerance for matching precomputed matrices
+
+    double mass_scaling_step;      ///< target time step for mass scaling (no mass scaling if not positive)
+    unsigned int num_mass_scaled;  ///< number of elements with scaled lumped mass
+
+    std::vector<char> serial_elements;  ///< flags for elements processed sequentially (not thread-safe)
+
     ChTimer timer_internal_forces;
     ChTimer timer_KRMload;
     unsigned int ncalls_internal_forces;
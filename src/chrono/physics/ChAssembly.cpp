@@ -40,7 +40,8 @@ ChAssembly::ChAssembly()
       m_num_coords_vel(0),
       m_num_constr(0),
       m_num_constr_bil(0),
-      m_num_constr_uni(0) {}
+      m_num_constr_uni(0),
+      m_parallel_loops(false) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     m_num_bodies_active = other.m_num_bodies_active;
@@ -57,6 +58,7 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     m_num_constr = other.m_num_constr;
     m_num_constr_bil = other.m_num_constr_bil;
     m_num_constr_uni = other.m_num_constr_uni;
+    m_parallel_loops = other.m_parallel_loops;
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, shaftlist, linklist, meshlist,  otherphysicslist)
@@ -94,6 +96,7 @@ void swap(ChAssembly& first, ChAssembly& second) {
     swap(first.m_num_constr, second.m_num_constr);
     swap(first.m_num_constr_bil, second.m_num_constr_bil);
     swap(first.m_num_constr_uni, second.m_num_constr_uni);
+    swap(first.m_parallel_loops, second.m_parallel_loops);
 
     //// RADU
     //// TODO: deal with all other member variables...
@@ -499,6 +502,12 @@ void ChAssembly::SyncCollisionModels() {
 // -----------------------------------------------------------------------------
 // UPDATING ROUTINES
 
+int ChAssembly::GetNumLoopThreads() const {
+    if (!m_parallel_loops || !system)
+        return 1;
+    return system->nthreads_chrono;
+}
+
 void ChAssembly::SetupInitial() {
     for (auto& body : bodylist) {
         body->SetupInitial();
@@ -648,12 +657,15 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (auto& body : bodylist) {
-        body->Update(ChTime, update_assets);
+    int nthreads = GetNumLoopThreads();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        bodylist[ib]->Update(ChTime, update_assets);
     }
-    for (auto& shaft : shaftlist) {
-        shaft->Update(ChTime, update_assets);
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        shaftlist[is]->Update(ChTime, update_assets);
     }
     for (auto& mesh : meshlist) {
         mesh->Update(ChTime, update_assets);
@@ -663,8 +675,9 @@ void ChAssembly::Update(bool update_assets) {
     }
     // The state of links depends on the bodylist,shaftlist,meshlist,otherphysicslist,
     // thus the update of linklist must be at the end.
-    for (auto& link : linklist) {
-        link->Update(ChTime, update_assets);
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        linklist[il]->Update(ChTime, update_assets);
     }
 }
 
@@ -693,18 +706,29 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
                                 double& T) {
     int displ_x = off_x - this->offset_x;
     int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumLoopThreads();
 
-    for (auto& body : bodylist) {
+    // Note: the time returned by individual items is discarded (use a thread-local variable to avoid a data race)
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
+        double T_item;
         if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T_item);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
+        double T_item;
         if (shaft->IsActive())
-            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
+            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T_item);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
+        double T_item;
         if (link->IsActive())
-            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
+            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T_item);
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
@@ -732,14 +756,19 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
 
     int displ_x = off_x - this->offset_x;
     int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumLoopThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
         else
             body->Update(T, full_update);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
                                    full_update);
@@ -759,7 +788,9 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     // must be behind of bodylist,shaftlist,meshlist,otherphysicslist; otherwise, the Update() of ChLink() would
     // use the old (un-updated) status of bodylist,shaftlist,meshlist, resulting in a delay of Update() of ChLink()
     // for one time step, then the simulation might diverge!
-    for (auto& link : linklist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
         else
@@ -876,18 +907,25 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
                                    const ChStateDelta& Dv) {
     int displ_x = off_x - this->offset_x;
     int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumLoopThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
     }
@@ -940,15 +978,21 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
                                    const double c)          ///< a scaling factor
 {
     int displ_v = off - this->offset_w;
+    int nthreads = GetNumLoopThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
+    // Links may apply forces on their connected bodies (e.g., spring-dampers), so they are processed serially
     for (auto& link : linklist) {
         if (link->IsActive())
             link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
@@ -1098,6 +1142,74 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
     }
 }
 
+bool ChAssembly::CanProjectLumped() {
+    for (auto& body : bodylist) {
+        if (body->IsActive() && !body->CanProjectLumped())
+            return false;
+    }
+    for (auto& shaft : shaftlist) {
+        if (shaft->IsActive() && !shaft->CanProjectLumped())
+            return false;
+    }
+    for (auto& link : linklist) {
+        if (link->IsActive() && !link->CanProjectLumped())
+            return false;
+    }
+    for (auto& mesh : meshlist) {
+        if (!mesh->CanProjectLumped())
+            return false;
+    }
+    for (auto& item : otherphysicslist) {
+        if (item->IsActive() && !item->CanProjectLumped())
+            return false;
+    }
+
+    return true;
+}
+
+bool ChAssembly::IntProjectLumped(const unsigned int off_x,
+                                  ChState& x,
+                                  const unsigned int off_v,
+                                  ChStateDelta& v,
+                                  const unsigned int off_L,
+                                  ChVectorDynamic<>& L,
+                                  const ChVectorDynamic<>& Md,
+                                  const double dt,
+                                  const bool project_positions) {
+    int displ_x = off_x - this->offset_x;
+    int displ_v = off_v - this->offset_w;
+    int displ_L = off_L - this->offset_L;
+
+    bool success = true;
+
+    for (auto& body : bodylist) {
+        if (body->IsActive())
+            success &= body->IntProjectLumped(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v,
+                                              displ_L + body->GetOffset_L(), L, Md, dt, project_positions);
+    }
+    for (auto& shaft : shaftlist) {
+        if (shaft->IsActive())
+            success &= shaft->IntProjectLumped(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v,
+                                               displ_L + shaft->GetOffset_L(), L, Md, dt, project_positions);
+    }
+    for (auto& link : linklist) {
+        if (link->IsActive())
+            success &= link->IntProjectLumped(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v,
+                                              displ_L + link->GetOffset_L(), L, Md, dt, project_positions);
+    }
+    for (auto& mesh : meshlist) {
+        success &= mesh->IntProjectLumped(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v,
+                                          displ_L + mesh->GetOffset_L(), L, Md, dt, project_positions);
+    }
+    for (auto& item : otherphysicslist) {
+        if (item->IsActive())
+            success &= item->IntProjectLumped(displ_x + item->GetOffset_x(), x, displ_v + item->GetOffset_w(), v,
+                                              displ_L + item->GetOffset_L(), L, Md, dt, project_positions);
+    }
+
+    return success;
+}
+
 void ChAssembly::IntToDescriptor(const unsigned int off_v,
                                  const ChStateDelta& v,
                                  const ChVectorDynamic<>& R,
@@ -1401,14 +1513,17 @@ void ChAssembly::ConstraintsFbLoadForces(double factor) {
 }
 
 void ChAssembly::LoadConstraintJacobians() {
+    int nthreads = GetNumLoopThreads();
+
     for (auto& body : bodylist) {
         body->LoadConstraintJacobians();
     }
     for (auto& shaft : shaftlist) {
         shaft->LoadConstraintJacobians();
     }
-    for (auto& link : linklist) {
-        link->LoadConstraintJacobians();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        linklist[il]->LoadConstraintJacobians();
     }
     for (auto& mesh : meshlist) {
         mesh->LoadConstraintJacobians();
@@ -1455,14 +1570,19 @@ void ChAssembly::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    for (auto& body : bodylist) {
-        body->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    int nthreads = GetNumLoopThreads();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        bodylist[ib]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
-    for (auto& shaft : shaftlist) {
-        shaft->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        shaftlist[is]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
-    for (auto& link : linklist) {
-        link->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        linklist[il]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
     for (auto& mesh : meshlist) {
         mesh->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
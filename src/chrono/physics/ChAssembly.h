@@ -133,6 +133,19 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Search an item (body, link or other ChPhysics items) by name.
     std::shared_ptr<ChPhysicsItem> Search(const std::string& name) const;
 
+    // MULTITHREADING
+
+    /// Enable/disable parallel processing of the bodies, shafts, and links in this assembly (default: false).
+    /// If enabled, the per-item loops in Update, state gather/scatter/increment, and in the loading of forces,
+    /// constraint Jacobians, and KRM matrices are executed with OpenMP, using the number of Chrono threads set through
+    /// ChSystem::SetNumThreads. State offsets are still computed serially in Setup, so results do not depend on the
+    /// number of threads. Meshes and other physics items are always processed serially (meshes are internally
+    /// parallel). Enable this only if the updates of all bodies, shafts, and links are thread-safe.
+    void EnableParallelLoops(bool val) { m_parallel_loops = val; }
+
+    /// Return true if parallel processing of bodies, shafts, and links is enabled.
+    bool IsParallelLoopsEnabled() const { return m_parallel_loops; }
+
     // STATISTICS
 
     /// Get the total number of bodies added to the assembly, including fixed and sleeping bodies.
@@ -268,6 +281,16 @@ class ChApi ChAssembly : public ChPhysicsItem {
                                      bool do_clamp,
                                      double recovery_clamp) override;
     virtual void IntLoadConstraint_Ct(const unsigned int off, ChVectorDynamic<>& Qc, const double c) override;
+    virtual bool CanProjectLumped() override;
+    virtual bool IntProjectLumped(const unsigned int off_x,
+                                  ChState& x,
+                                  const unsigned int off_v,
+                                  ChStateDelta& v,
+                                  const unsigned int off_L,
+                                  ChVectorDynamic<>& L,
+                                  const ChVectorDynamic<>& Md,
+                                  const double dt,
+                                  const bool project_positions) override;
     virtual void IntToDescriptor(const unsigned int off_v,
                                  const ChStateDelta& v,
                                  const ChVectorDynamic<>& R,
@@ -323,6 +346,9 @@ class ChApi ChAssembly : public ChPhysicsItem {
   protected:
     virtual void SetupInitial() override;
 
+    /// Return the number of threads for the per-item loops (1 if parallel loops are disabled).
+    int GetNumLoopThreads() const;
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChShaft>> shaftlist;               ///< list of 1-D shafts
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
@@ -347,6 +373,8 @@ class ChApi ChAssembly : public ChPhysicsItem {
     unsigned int m_num_constr_bil;  ///< number of scalar bilateral constraints
     unsigned int m_num_constr_uni;  ///< number of scalar unilateral constraints
 
+    bool m_parallel_loops;  ///< process bodies, shafts, and links in parallel
+
     friend class ChSystem;
     friend class ChSystemMulticore;
 };
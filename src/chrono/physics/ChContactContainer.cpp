@@ -24,6 +24,11 @@ ChContactContainer::ChContactContainer(const ChContactContainer& other) : ChPhys
     report_contact_callback = other.report_contact_callback;
 }
 
+void ChContactContainer::AddContacts(const std::vector<ChCollisionInfo>& cinfo_list) {
+    for (const auto& cinfo : cinfo_list)
+        AddContact(cinfo);
+}
+
 void ChContactContainer::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChContactContainer>();
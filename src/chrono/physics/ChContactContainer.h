@@ -22,10 +22,12 @@
 
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChContactable.h"
+#include "chrono/physics/ChContactList.h"
 #include "chrono/physics/ChContactMaterial.h"
 
 namespace chrono {
@@ -60,6 +62,12 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) = 0;
 
+    /// Add a batch of contacts between collision shapes, storing them into this container in the given order.
+    /// The collision info objects are assumed to contain valid pointers to the colliding shapes. This is equivalent to
+    /// calling AddContact() for each of them, but allows collision systems to generate contacts concurrently and then
+    /// pass them to the container in bulk.
+    virtual void AddContacts(const std::vector<ChCollisionInfo>& cinfo_list);
+
     /// The collision system will call EndAddContact() after adding all contacts (for example with AddContact() or
     /// similar).
     virtual void EndAddContact() {}
@@ -147,7 +155,7 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// of contacts) to cache information used for reporting through GetContactableForce and
     /// GetContactableTorque.
     template <class Tcont>
-    void SumAllContactForces(std::list<Tcont*>& contactlist,
+    void SumAllContactForces(ChContactList<Tcont>& contactlist,
                              std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
         for (auto contact = contactlist.begin(); contact != contactlist.end(); ++contact) {
             // Extract information for current contact (expressed in global frame)
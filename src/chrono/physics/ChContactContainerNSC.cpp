@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
@@ -32,7 +34,10 @@ ChContactContainerNSC::ChContactContainerNSC()
       n_added_666_6(0),
       n_added_666_333(0),
       n_added_666_666(0),
-      n_added_6_6_rolling(0) {}
+      n_added_6_6_rolling(0),
+      m_persistent(false),
+      m_persistent_tol(0.01),
+      m_num_persistent(0) {}
 
 ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {
     n_added_6_6 = 0;
@@ -46,6 +51,10 @@ ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other)
     n_added_666_333 = 0;
     n_added_666_666 = 0;
     n_added_6_6_rolling = 0;
+    SetPooledStorage(other.IsPooledStorage());
+    m_persistent = other.m_persistent;
+    m_persistent_tol = other.m_persistent_tol;
+    m_num_persistent = 0;
 }
 
 ChContactContainerNSC::~ChContactContainerNSC() {
@@ -57,120 +66,195 @@ void ChContactContainerNSC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
+template <class Tcont>
+void _RemoveAllContacts(ChContactList<Tcont>& contactlist, int& n_added) {
+    contactlist.Clear();
     n_added = 0;
 }
 
 void ChContactContainerNSC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
-    _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+    _RemoveAllContacts(contactlist_6_6, n_added_6_6);
+    _RemoveAllContacts(contactlist_6_3, n_added_6_3);
+    _RemoveAllContacts(contactlist_3_3, n_added_3_3);
+    _RemoveAllContacts(contactlist_333_3, n_added_333_3);
+    _RemoveAllContacts(contactlist_333_6, n_added_333_6);
+    _RemoveAllContacts(contactlist_333_333, n_added_333_333);
+    _RemoveAllContacts(contactlist_666_3, n_added_666_3);
+    _RemoveAllContacts(contactlist_666_6, n_added_666_6);
+    _RemoveAllContacts(contactlist_666_333, n_added_666_333);
+    _RemoveAllContacts(contactlist_666_666, n_added_666_666);
+    _RemoveAllContacts(contactlist_6_6_rolling, n_added_6_6_rolling);
+    m_persistent_contacts.clear();
+    m_num_persistent = 0;
+}
+
+void ChContactContainerNSC::SetPooledStorage(bool val) {
+    RemoveAllContacts();
+    contactlist_6_6.SetPooled(val);
+    contactlist_6_3.SetPooled(val);
+    contactlist_3_3.SetPooled(val);
+    contactlist_333_3.SetPooled(val);
+    contactlist_333_6.SetPooled(val);
+    contactlist_333_333.SetPooled(val);
+    contactlist_666_3.SetPooled(val);
+    contactlist_666_6.SetPooled(val);
+    contactlist_666_333.SetPooled(val);
+    contactlist_666_666.SetPooled(val);
+    contactlist_6_6_rolling.SetPooled(val);
+}
+
+void ChContactContainerNSC::EnablePersistentContacts(bool val) {
+    m_persistent = val;
+    m_persistent_contacts.clear();
+    m_num_persistent = 0;
+}
+
+// Record the current contacts with non-zero reaction, for matching at the next collision detection pass.
+template <class Tcont>
+void ChContactContainerNSC::StorePersistentContacts(ChContactList<Tcont>& contactlist) {
+    for (auto contact : contactlist) {
+        ChVector3d force = contact->GetContactForce();
+        if (force.IsNull())
+            continue;
+        auto objA = contact->GetObjA();
+        auto objB = contact->GetObjB();
+        PersistentContact pc;
+        pc.objA = objA;
+        pc.objB = objB;
+        pc.ptA = objA->GetCollisionModelFrame().TransformPointParentToLocal(contact->GetContactP1());
+        pc.ptB = objB->GetCollisionModelFrame().TransformPointParentToLocal(contact->GetContactP2());
+        pc.force = contact->GetContactPlane() * force;
+        pc.consumed = false;
+        m_persistent_contacts.push_back(pc);
+    }
+}
+
+static bool _PersistentContactLess(ChContactable* objA1,
+                                   ChContactable* objB1,
+                                   ChContactable* objA2,
+                                   ChContactable* objB2) {
+    return std::less<ChContactable*>()(objA1, objA2) || (objA1 == objA2 && std::less<ChContactable*>()(objB1, objB2));
+}
+
+void ChContactContainerNSC::StorePersistentContacts() {
+    m_persistent_contacts.clear();
+    StorePersistentContacts(contactlist_6_6);
+    StorePersistentContacts(contactlist_6_3);
+    StorePersistentContacts(contactlist_3_3);
+    StorePersistentContacts(contactlist_333_3);
+    StorePersistentContacts(contactlist_333_6);
+    StorePersistentContacts(contactlist_333_333);
+    StorePersistentContacts(contactlist_666_3);
+    StorePersistentContacts(contactlist_666_6);
+    StorePersistentContacts(contactlist_666_333);
+    StorePersistentContacts(contactlist_666_666);
+    StorePersistentContacts(contactlist_6_6_rolling);
+    std::sort(m_persistent_contacts.begin(), m_persistent_contacts.end(),
+              [](const PersistentContact& a, const PersistentContact& b) {
+                  return _PersistentContactLess(a.objA, a.objB, b.objA, b.objB);
+              });
+}
+
+bool ChContactContainerNSC::FindPersistentContact(ChContactable* objA,
+                                                  ChContactable* objB,
+                                                  const ChVector3d& pA,
+                                                  const ChVector3d& pB,
+                                                  ChVector3d& force) {
+    auto first = std::lower_bound(m_persistent_contacts.begin(), m_persistent_contacts.end(), 0,
+                                  [objA, objB](const PersistentContact& pc, int) {
+                                      return _PersistentContactLess(pc.objA, pc.objB, objA, objB);
+                                  });
+
+    // Select the closest unmatched previous contact between the same two objects, if within tolerance
+    ChVector3d ptA = objA->GetCollisionModelFrame().TransformPointParentToLocal(pA);
+    ChVector3d ptB = objB->GetCollisionModelFrame().TransformPointParentToLocal(pB);
+    double min_dist2 = m_persistent_tol * m_persistent_tol;
+    auto match = m_persistent_contacts.end();
+    for (auto pc = first; pc != m_persistent_contacts.end() && pc->objA == objA && pc->objB == objB; ++pc) {
+        if (pc->consumed)
+            continue;
+        double dist2 = std::min((pc->ptA - ptA).Length2(), (pc->ptB - ptB).Length2());
+        if (dist2 < min_dist2) {
+            min_dist2 = dist2;
+            match = pc;
+        }
+    }
+    if (match == m_persistent_contacts.end())
+        return false;
+
+    // each previous contact initializes at most one new contact
+    match->consumed = true;
+    force = match->force;
+    m_num_persistent++;
+    return true;
+}
+
+template <class Tcont>
+void ChContactContainerNSC::WarmStartContact(Tcont* contact) {
+    if (!m_persistent)
+        return;
+
+    ChVector3d force;
+    if (FindPersistentContact(contact->GetObjA(), contact->GetObjB(), contact->GetContactP1(), contact->GetContactP2(),
+                              force))
+        contact->SetContactForce(contact->GetContactPlane().transpose() * force);
 }
 
 void ChContactContainerNSC::BeginAddContact() {
-    lastcontact_6_6 = contactlist_6_6.begin();
+    m_num_persistent = 0;
+
+    contactlist_6_6.Rewind();
     n_added_6_6 = 0;
 
-    lastcontact_6_3 = contactlist_6_3.begin();
+    contactlist_6_3.Rewind();
     n_added_6_3 = 0;
 
-    lastcontact_3_3 = contactlist_3_3.begin();
+    contactlist_3_3.Rewind();
     n_added_3_3 = 0;
 
-    lastcontact_333_3 = contactlist_333_3.begin();
+    contactlist_333_3.Rewind();
     n_added_333_3 = 0;
 
-    lastcontact_333_6 = contactlist_333_6.begin();
+    contactlist_333_6.Rewind();
     n_added_333_6 = 0;
 
-    lastcontact_333_333 = contactlist_333_333.begin();
+    contactlist_333_333.Rewind();
     n_added_333_333 = 0;
 
-    lastcontact_666_3 = contactlist_666_3.begin();
+    contactlist_666_3.Rewind();
     n_added_666_3 = 0;
 
-    lastcontact_666_6 = contactlist_666_6.begin();
+    contactlist_666_6.Rewind();
     n_added_666_6 = 0;
 
-    lastcontact_666_333 = contactlist_666_333.begin();
+    contactlist_666_333.Rewind();
     n_added_666_333 = 0;
 
-    lastcontact_666_666 = contactlist_666_666.begin();
+    contactlist_666_666.Rewind();
     n_added_666_666 = 0;
 
-    lastcontact_6_6_rolling = contactlist_6_6_rolling.begin();
+    contactlist_6_6_rolling.Rewind();
     n_added_6_6_rolling = 0;
 }
 
 void ChContactContainerNSC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
-    }
-
-    while (lastcontact_6_6_rolling != contactlist_6_6_rolling.end()) {
-        delete (*lastcontact_6_6_rolling);
-        lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
-    }
-}
-
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
-                           Titer& lastcontact,                        // last contact acquired
+    // release contacts that were not reused (kept for later reuse with pooled storage)
+    contactlist_6_6.Trim();
+    contactlist_6_3.Trim();
+    contactlist_3_3.Trim();
+    contactlist_333_3.Trim();
+    contactlist_333_6.Trim();
+    contactlist_333_333.Trim();
+    contactlist_666_3.Trim();
+    contactlist_666_6.Trim();
+    contactlist_666_333.Trim();
+    contactlist_666_666.Trim();
+
+    contactlist_6_6_rolling.Trim();
+}
+
+template <class Tcont, class Ta, class Tb>
+Tcont* _OptimalContactInsert(ChContactList<Tcont>& contactlist,        // contact list
                            int& n_added,                              // number of contacts inserted
                            ChContactContainerNSC* container,          // contact container
                            Ta* objA,                                  // collidable object A
@@ -178,17 +262,17 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact
                            const ChCollisionInfo& cinfo,              // collision information
                            const ChContactMaterialCompositeNSC& cmat  // composite material
 ) {
-    if (lastcontact != contactlist.end()) {
+    Tcont* mc = contactlist.Reuse();
+    if (mc) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
-        lastcontact++;
+        mc->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        mc = contactlist.Emplace(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
     }
     n_added++;
+
+    return mc;
 }
 
 void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo,
@@ -217,7 +301,8 @@ void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo,
     InsertContact(cinfo, cmat);
 }
 
-void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo) {
+// Check if a contact must be created for the collision pair (with valid pointers to the colliding shapes).
+bool ChContactContainerNSC::IsContactAdmissible(const ChCollisionInfo& cinfo) {
     assert(cinfo.modelA->GetContactable());
     assert(cinfo.modelB->GetContactable());
 
@@ -226,14 +311,21 @@ void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo) {
 
     // Do nothing if any of the contactables is not contact-active
     if (!contactableA->IsContactActive() && !contactableB->IsContactActive())
-        return;
+        return false;
 
     // Check that the two collision models are compatible with complementarity contact.
     if (cinfo.shapeA->GetContactMethod() != ChContactMethod::NSC ||
         cinfo.shapeB->GetContactMethod() != ChContactMethod::NSC) {
-        return;
+        return false;
     }
 
+    return true;
+}
+
+void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo) {
+    if (!IsContactAdmissible(cinfo))
+        return;
+
     // Create the composite material
     ChContactMaterialCompositeNSC cmat(GetSystem()->composition_strategy.get(),
                                        std::static_pointer_cast<ChContactMaterialNSC>(cinfo.shapeA->GetMaterial()),
@@ -247,6 +339,37 @@ void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo) {
     InsertContact(cinfo, cmat);
 }
 
+void ChContactContainerNSC::AddContacts(const std::vector<ChCollisionInfo>& cinfo_list) {
+    int num_pairs = (int)cinfo_list.size();
+    int nthreads = GetSystem()->nthreads_chrono;
+
+    // Filter the collision pairs (each pair only writes its own entry)
+    m_batch_valid.resize(num_pairs);
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int i = 0; i < num_pairs; i++) {
+        m_batch_valid[i] = IsContactAdmissible(cinfo_list[i]);
+    }
+
+    // Create the composite materials and insert the contacts in order (the material composition strategy, the user
+    // callback, and the contact lists are not assumed to be thread-safe)
+    for (int i = 0; i < num_pairs; i++) {
+        if (!m_batch_valid[i])
+            continue;
+
+        const auto& cinfo = cinfo_list[i];
+        ChContactMaterialCompositeNSC cmat(GetSystem()->composition_strategy.get(),
+                                           std::static_pointer_cast<ChContactMaterialNSC>(cinfo.shapeA->GetMaterial()),
+                                           std::static_pointer_cast<ChContactMaterialNSC>(cinfo.shapeB->GetMaterial()));
+
+        if (GetAddContactCallback()) {
+            GetAddContactCallback()->OnAddContact(cinfo, &cmat);
+        }
+
+        InsertContact(cinfo, cmat);
+    }
+}
+
 void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat) {
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
@@ -268,25 +391,25 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_3_3, n_added_3_3, this, objA, objB, cinfo, cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
+                                                       cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_333_3, n_added_333_3, this, objB, objA,
+                                                       swapped_cinfo, cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_666_3, n_added_666_3, this, objB, objA,
+                                                       swapped_cinfo, cmat));
             }
         } break;
 
@@ -295,28 +418,29 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_6_3, n_added_6_3, this, objA, objB, cinfo, cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6    ***NOTE: for body-body one could have rolling friction: ***
                 if (cmat.rolling_friction || cmat.spinning_friction) {
-                    _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this,
-                                          objA, objB, cinfo, cmat);
+                    WarmStartContact(_OptimalContactInsert(contactlist_6_6_rolling, n_added_6_6_rolling, this, objA,
+                                                           objB, cinfo, cmat));
                 } else {
-                    _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                    WarmStartContact(_OptimalContactInsert(contactlist_6_6, n_added_6_6, this, objA, objB, cinfo,
+                                                           cmat));
                 }
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_333_6, n_added_333_6, this, objB, objA,
+                                                       swapped_cinfo, cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_666_6, n_added_666_6, this, objB, objA,
+                                                       swapped_cinfo, cmat));
             }
         } break;
 
@@ -325,24 +449,24 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
-                                      cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_333_3, n_added_333_3, this, objA, objB, cinfo,
+                                                       cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
-                                      cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_333_6, n_added_333_6, this, objA, objB, cinfo,
+                                                       cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
-                                      cinfo, cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_333_333, n_added_333_333, this, objA, objB, cinfo,
+                                                       cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_666_333, n_added_666_333, this, objB, objA,
+                                                       swapped_cinfo, cmat));
             }
         } break;
 
@@ -351,23 +475,23 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
-                                      cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_666_3, n_added_666_3, this, objA, objB, cinfo,
+                                                       cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
-                                      cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_666_6, n_added_666_6, this, objA, objB, cinfo,
+                                                       cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
-                                      cinfo, cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_666_333, n_added_666_333, this, objA, objB, cinfo,
+                                                       cmat));
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
-                                      cinfo, cmat);
+                WarmStartContact(_OptimalContactInsert(contactlist_666_666, n_added_666_666, this, objA, objB, cinfo,
+                                                       cmat));
             }
         } break;
 
@@ -410,8 +534,8 @@ ChVector3d ChContactContainerNSC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactList<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -424,8 +548,9 @@ void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::Repo
 }
 
 template <class Tcont>
-void _ReportAllContactsRolling(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsRolling(ChContactList<Tcont>& contactlist,
+                               ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -453,8 +578,9 @@ void ChContactContainerNSC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 }
 
 template <class Tcont>
-void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsNSC(ChContactList<Tcont>& contactlist,
+                           ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -468,9 +594,9 @@ void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC
 }
 
 template <class Tcont>
-void _ReportAllContactsRollingNSC(std::list<Tcont*>& contactlist,
+void _ReportAllContactsRollingNSC(ChContactList<Tcont>& contactlist,
                                   ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -501,11 +627,11 @@ void ChContactContainerNSC::ReportAllContactsNSC(std::shared_ptr<ReportContactCa
 
 template <class Tcont>
 void _IntStateGatherReactions(unsigned int& coffset,
-                              std::list<Tcont*>& contactlist,
+                              ChContactList<Tcont>& contactlist,
                               const unsigned int off_L,
                               ChVectorDynamic<>& L,
                               const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateGatherReactions(off_L + coffset, L);
         coffset += stride;
@@ -530,11 +656,11 @@ void ChContactContainerNSC::IntStateGatherReactions(const unsigned int off_L, Ch
 
 template <class Tcont>
 void _IntStateScatterReactions(unsigned int& coffset,
-                               std::list<Tcont*>& contactlist,
+                               ChContactList<Tcont>& contactlist,
                                const unsigned int off_L,
                                const ChVectorDynamic<>& L,
                                const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateScatterReactions(off_L + coffset, L);
         coffset += stride;
@@ -555,18 +681,23 @@ void ChContactContainerNSC::IntStateScatterReactions(const unsigned int off_L, c
     _IntStateScatterReactions(coffset, contactlist_666_333, off_L, L, 3);
     _IntStateScatterReactions(coffset, contactlist_666_666, off_L, L, 3);
     _IntStateScatterReactions(coffset, contactlist_6_6_rolling, off_L, L, 6);
+
+    // record the contacts for warm starting at the next collision detection pass (while all contactable objects are
+    // known to be valid)
+    if (m_persistent)
+        StorePersistentContacts();
 }
 
 template <class Tcont>
 void _IntLoadResidual_CqL(unsigned int& coffset,           // offset of the contacts
-                          std::list<Tcont*>& contactlist,  // list of contacts
+                          ChContactList<Tcont>& contactlist,  // list of contacts
                           const unsigned int off_L,        // offset in L multipliers
                           ChVectorDynamic<>& R,            // result: the R residual, R += c*Cq'*L
                           const ChVectorDynamic<>& L,      // the L vector
                           const double c,                  // a scaling factor
                           const int stride                 // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
         coffset += stride;
@@ -594,7 +725,7 @@ void ChContactContainerNSC::IntLoadResidual_CqL(const unsigned int off_L,
 
 template <class Tcont>
 void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
-                          std::list<Tcont*>& contactlist,  // contact list
+                          ChContactList<Tcont>& contactlist,  // contact list
                           const unsigned int off,          // offset in Qc residual
                           ChVectorDynamic<>& Qc,           // result: the Qc residual, Qc += c*C
                           const double c,                  // a scaling factor
@@ -602,7 +733,7 @@ void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
                           double recovery_clamp,           // value for min/max clamping of c*C
                           const int stride                 // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
         coffset += stride;
@@ -631,7 +762,7 @@ void ChContactContainerNSC::IntLoadConstraint_C(const unsigned int off,
 
 template <class Tcont>
 void _IntToDescriptor(unsigned int& coffset,
-                      std::list<Tcont*>& contactlist,
+                      ChContactList<Tcont>& contactlist,
                       const unsigned int off_v,
                       const ChStateDelta& v,
                       const ChVectorDynamic<>& R,
@@ -639,7 +770,7 @@ void _IntToDescriptor(unsigned int& coffset,
                       const ChVectorDynamic<>& L,
                       const ChVectorDynamic<>& Qc,
                       const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntToDescriptor(off_L + coffset, L, Qc);
         coffset += stride;
@@ -669,13 +800,13 @@ void ChContactContainerNSC::IntToDescriptor(const unsigned int off_v,
 
 template <class Tcont>
 void _IntFromDescriptor(unsigned int& coffset,
-                        std::list<Tcont*>& contactlist,
+                        ChContactList<Tcont>& contactlist,
                         const unsigned int off_v,
                         ChStateDelta& v,
                         const unsigned int off_L,
                         ChVectorDynamic<>& L,
                         const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntFromDescriptor(off_L + coffset, L);
         coffset += stride;
@@ -704,8 +835,8 @@ void ChContactContainerNSC::IntFromDescriptor(const unsigned int off_v,
 // SOLVER INTERFACES
 
 template <class Tcont>
-void _InjectConstraints(std::list<Tcont*>& contactlist, ChSystemDescriptor& descriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectConstraints(ChContactList<Tcont>& contactlist, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->InjectConstraints(descriptor);
         ++itercontact;
@@ -727,8 +858,8 @@ void ChContactContainerNSC::InjectConstraints(ChSystemDescriptor& descriptor) {
 }
 
 template <class Tcont>
-void _ConstraintsBiReset(std::list<Tcont*>& contactlist) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiReset(ChContactList<Tcont>& contactlist) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiReset();
         ++itercontact;
@@ -750,8 +881,8 @@ void ChContactContainerNSC::ConstraintsBiReset() {
 }
 
 template <class Tcont>
-void _ConstraintsBiLoad_C(std::list<Tcont*>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiLoad_C(ChContactList<Tcont>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
         ++itercontact;
@@ -777,9 +908,9 @@ void ChContactContainerNSC::LoadConstraintJacobians() {
 }
 
 template <class Tcont>
-void _ConstraintsFetch_react(std::list<Tcont*>& contactlist, double factor) {
+void _ConstraintsFetch_react(ChContactList<Tcont>& contactlist, double factor) {
     // From constraints to react vector:
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsFetch_react(factor);
         ++itercontact;
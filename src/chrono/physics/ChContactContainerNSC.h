@@ -15,9 +15,8 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
-
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChContactList.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
 #include "chrono/physics/ChContactable.h"
@@ -25,7 +24,7 @@
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
+/// Implemented using lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
 /// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
 /// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
 class ChApi ChContactContainerNSC : public ChContactContainer {
@@ -60,9 +59,39 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
+    /// Enable/disable pooled storage of contact objects (default: false).
+    /// If enabled, contacts of each type are constructed in large contiguous memory blocks and are recycled (never
+    /// deallocated) between steps, which avoids heap allocations and improves cache locality for large numbers of
+    /// contacts, at the cost of retaining memory for the maximum number of contacts encountered so far.
+    /// Changing the storage mode removes all existing contacts.
+    void SetPooledStorage(bool val);
+
+    /// Return true if pooled storage of contact objects is enabled.
+    bool IsPooledStorage() const { return contactlist_6_6.IsPooled(); }
+
+    /// Enable/disable warm starting of contact reactions from persistent contact identities (default: false).
+    /// If enabled, each new contact is matched against the contacts found at the previous collision detection pass
+    /// between the same two contactable objects, by comparing the contact points expressed in the local frames of the
+    /// two objects. The reaction force of a matched contact is used as initial guess for the new contact, which
+    /// benefits iterative solvers with warm start enabled (see ChIterativeSolver::EnableWarmStart), in particular for
+    /// resting contacts (e.g., stacks). A match overrides any reaction cache provided by the collision system.
+    void EnablePersistentContacts(bool val);
+
+    /// Return true if warm starting from persistent contact identities is enabled.
+    bool IsPersistentContactsEnabled() const { return m_persistent; }
+
+    /// Set the distance tolerance for matching a new contact to a contact of the previous step (default: 0.01).
+    /// Two contacts match if either their points on object A or their points on object B, expressed in the local frame
+    /// of the corresponding object, are closer than this tolerance.
+    void SetPersistentContactTolerance(double tol) { m_persistent_tol = tol; }
+
+    /// Return the number of contacts initialized from a matching contact of the previous step, during the last
+    /// collision detection pass.
+    unsigned int GetNumPersistentContacts() const { return m_num_persistent; }
+
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
     /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
+    /// the contact lists and tries to reuse previous contact objects until possible, to avoid too much
     /// allocation/deallocation.
     virtual void BeginAddContact() override;
 
@@ -78,8 +107,15 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
+    /// Add a batch of contacts between pairs of collision shapes, storing them into this container.
+    /// The result is the same as calling AddContact() for each collision info object, in order. The collision pairs
+    /// are filtered concurrently, using the number of Chrono threads of the system. The composite contact materials are
+    /// then created, the AddContactCallback (if any) invoked, and the contacts inserted sequentially.
+    virtual void AddContacts(const std::vector<ChCollisionInfo>& cinfo_list) override;
+
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any), unless
+    /// pooled storage is enabled.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -182,18 +218,18 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
+    ChContactList<ChContactNSC_6_6> contactlist_6_6;
+    ChContactList<ChContactNSC_6_3> contactlist_6_3;
+    ChContactList<ChContactNSC_3_3> contactlist_3_3;
+    ChContactList<ChContactNSC_333_3> contactlist_333_3;
+    ChContactList<ChContactNSC_333_6> contactlist_333_6;
+    ChContactList<ChContactNSC_333_333> contactlist_333_333;
+    ChContactList<ChContactNSC_666_3> contactlist_666_3;
+    ChContactList<ChContactNSC_666_6> contactlist_666_6;
+    ChContactList<ChContactNSC_666_333> contactlist_666_333;
+    ChContactList<ChContactNSC_666_666> contactlist_666_666;
+
+    ChContactList<ChContactNSCrolling_6_6> contactlist_6_6_rolling;
 
     int n_added_6_6;
     int n_added_6_3;
@@ -207,24 +243,52 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     int n_added_666_666;
     int n_added_6_6_rolling;
 
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
+    bool m_persistent;              ///< warm start from persistent contacts?
+    double m_persistent_tol;        ///< tolerance for matching contact points
+    unsigned int m_num_persistent;  ///< number of matched contacts in last pass
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
   private:
+    /// Data of a contact from the previous step, used for warm starting with persistent contacts.
+    struct PersistentContact {
+        ChContactable* objA;  ///< first contactable object
+        ChContactable* objB;  ///< second contactable object
+        ChVector3d ptA;       ///< contact point on A, in the collision model frame of A
+        ChVector3d ptB;       ///< contact point on B, in the collision model frame of B
+        ChVector3d force;     ///< contact reaction force, in absolute frame
+        bool consumed;        ///< already matched to a new contact?
+    };
+
+    /// Check if a contact must be created for the collision pair (with valid pointers to the colliding shapes).
+    static bool IsContactAdmissible(const ChCollisionInfo& cinfo);
+
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat);
 
+    /// Record the current contacts with non-zero reaction, for matching at the next collision detection pass.
+    void StorePersistentContacts();
+
+    /// Record the contacts in the given list with non-zero reaction.
+    template <class Tcont>
+    void StorePersistentContacts(ChContactList<Tcont>& contactlist);
+
+    /// Initialize the reaction of a newly inserted contact from the matching contact of the previous step, if any.
+    template <class Tcont>
+    void WarmStartContact(Tcont* contact);
+
+    /// Find the unmatched contact of the previous step closest to a new contact between the given objects, with the
+    /// given contact points (in absolute frame). If found, mark it as matched, load its reaction force (in absolute
+    /// frame) in 'force', and return true.
+    bool FindPersistentContact(ChContactable* objA,
+                               ChContactable* objB,
+                               const ChVector3d& pA,
+                               const ChVector3d& pB,
+                               ChVector3d& force);
+
+    std::vector<PersistentContact> m_persistent_contacts;  ///< contacts of previous step, sorted by object pair
+
+    std::vector<char> m_batch_valid;  ///< flags for admissible pairs of a contact batch
+
     double min_bounce_speed;  ///< minimum speed for rebounce after impacts. Lower speeds are clamped to 0
 
     friend class ChSystemNSC;
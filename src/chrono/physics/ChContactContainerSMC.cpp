@@ -14,6 +14,7 @@
 
 #include "chrono/physics/ChContactContainerSMC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
@@ -30,7 +31,9 @@ ChContactContainerSMC::ChContactContainerSMC()
       n_added_666_3(0),
       n_added_666_6(0),
       n_added_666_333(0),
-      n_added_666_666(0) {}
+      n_added_666_666(0),
+      m_nthreads(1),
+      m_parallel_forces(false) {}
 
 ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other) : ChContactContainer(other) {
     n_added_3_3 = 0;
@@ -43,6 +46,9 @@ ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other)
     n_added_666_6 = 0;
     n_added_666_333 = 0;
     n_added_666_666 = 0;
+    m_nthreads = 1;
+    m_parallel_forces = false;
+    SetPooledStorage(other.IsPooledStorage());
 }
 
 ChContactContainerSMC::~ChContactContainerSMC() {
@@ -54,136 +60,142 @@ void ChContactContainerSMC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
+template <class Tcont>
+void _RemoveAllContacts(ChContactList<Tcont>& contactlist, int& n_added) {
+    contactlist.Clear();
     n_added = 0;
 }
 
 void ChContactContainerSMC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
+    _RemoveAllContacts(contactlist_3_3, n_added_3_3);
+    _RemoveAllContacts(contactlist_6_3, n_added_6_3);
+    _RemoveAllContacts(contactlist_6_6, n_added_6_6);
+    _RemoveAllContacts(contactlist_333_3, n_added_333_3);
+    _RemoveAllContacts(contactlist_333_6, n_added_333_6);
+    _RemoveAllContacts(contactlist_333_333, n_added_333_333);
+    _RemoveAllContacts(contactlist_666_3, n_added_666_3);
+    _RemoveAllContacts(contactlist_666_6, n_added_666_6);
+    _RemoveAllContacts(contactlist_666_333, n_added_666_333);
+    _RemoveAllContacts(contactlist_666_666, n_added_666_666);
     //**TODO*** cont. roll.
 }
 
+void ChContactContainerSMC::SetPooledStorage(bool val) {
+    RemoveAllContacts();
+    contactlist_3_3.SetPooled(val);
+    contactlist_6_3.SetPooled(val);
+    contactlist_6_6.SetPooled(val);
+    contactlist_333_3.SetPooled(val);
+    contactlist_333_6.SetPooled(val);
+    contactlist_333_333.SetPooled(val);
+    contactlist_666_3.SetPooled(val);
+    contactlist_666_6.SetPooled(val);
+    contactlist_666_333.SetPooled(val);
+    contactlist_666_666.SetPooled(val);
+}
+
 void ChContactContainerSMC::BeginAddContact() {
-    lastcontact_3_3 = contactlist_3_3.begin();
+    // Contact forces are calculated in EndAddContact (in parallel) if using multiple threads and if the contact force
+    // algorithm can be invoked concurrently
+    m_nthreads = GetSystem() ? GetSystem()->nthreads_chrono : 1;
+    m_parallel_forces = m_nthreads > 1 && static_cast<ChSystemSMC*>(GetSystem())
+                                              ->GetContactForceTorqueAlgorithm()
+                                              .IsThreadSafe();
+
+    contactlist_3_3.Rewind();
     n_added_3_3 = 0;
 
-    lastcontact_6_3 = contactlist_6_3.begin();
+    contactlist_6_3.Rewind();
     n_added_6_3 = 0;
 
-    lastcontact_6_6 = contactlist_6_6.begin();
+    contactlist_6_6.Rewind();
     n_added_6_6 = 0;
 
-    lastcontact_333_3 = contactlist_333_3.begin();
+    contactlist_333_3.Rewind();
     n_added_333_3 = 0;
 
-    lastcontact_333_6 = contactlist_333_6.begin();
+    contactlist_333_6.Rewind();
     n_added_333_6 = 0;
 
-    lastcontact_333_333 = contactlist_333_333.begin();
+    contactlist_333_333.Rewind();
     n_added_333_333 = 0;
 
-    lastcontact_666_3 = contactlist_666_3.begin();
+    contactlist_666_3.Rewind();
     n_added_666_3 = 0;
 
-    lastcontact_666_6 = contactlist_666_6.begin();
+    contactlist_666_6.Rewind();
     n_added_666_6 = 0;
 
-    lastcontact_666_333 = contactlist_666_333.begin();
+    contactlist_666_333.Rewind();
     n_added_666_333 = 0;
 
-    lastcontact_666_666 = contactlist_666_666.begin();
+    contactlist_666_666.Rewind();
     n_added_666_666 = 0;
 
-    // lastcontact_roll = contactlist_roll.begin();
+    // contactlist_roll.Rewind();
     // n_added_roll = 0;
 }
 
-void ChContactContainerSMC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
+template <class Tcont>
+void _CalculateContactForces(ChContactList<Tcont>& contactlist, int nthreads) {
+    int ncontacts = (int)contactlist.size();
+
+    // Each contact only modifies its own data (force, torque, and Jacobians)
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ic = 0; ic < ncontacts; ic++) {
+        contactlist[ic]->CalculateForce();
     }
+}
 
-    // while (lastcontact_roll != contactlist_roll.end()) {
-    //    delete (*lastcontact_roll);
-    //    lastcontact_roll = contactlist_roll.erase(lastcontact_roll);
-    //}
+void ChContactContainerSMC::EndAddContact() {
+    // release contacts that were not reused (kept for later reuse with pooled storage)
+    contactlist_3_3.Trim();
+    contactlist_6_3.Trim();
+    contactlist_6_6.Trim();
+    contactlist_333_3.Trim();
+    contactlist_333_6.Trim();
+    contactlist_333_333.Trim();
+    contactlist_666_3.Trim();
+    contactlist_666_6.Trim();
+    contactlist_666_333.Trim();
+    contactlist_666_666.Trim();
+
+    // contactlist_roll.Trim();
+
+    // calculate forces of contacts added since BeginAddContact (if deferred)
+    if (m_parallel_forces) {
+        _CalculateContactForces(contactlist_3_3, m_nthreads);
+        _CalculateContactForces(contactlist_6_3, m_nthreads);
+        _CalculateContactForces(contactlist_6_6, m_nthreads);
+        _CalculateContactForces(contactlist_333_3, m_nthreads);
+        _CalculateContactForces(contactlist_333_6, m_nthreads);
+        _CalculateContactForces(contactlist_333_333, m_nthreads);
+        _CalculateContactForces(contactlist_666_3, m_nthreads);
+        _CalculateContactForces(contactlist_666_6, m_nthreads);
+        _CalculateContactForces(contactlist_666_333, m_nthreads);
+        _CalculateContactForces(contactlist_666_666, m_nthreads);
+    }
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
-                           Titer& lastcontact,                        // last contact acquired
-                           int& n_added,                              // number of contacts inserted
-                           ChContactContainerSMC* container,          // contact container
-                           Ta* objA,                                  // collidable object A
-                           Tb* objB,                                  // collidable object B
-                           const ChCollisionInfo& cinfo,              // collision information
-                           const ChContactMaterialCompositeSMC& cmat  // composite material
+template <class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(ChContactList<Tcont>& contactlist,         // contact list
+                           int& n_added,                               // number of contacts inserted
+                           ChContactContainerSMC* container,           // contact container
+                           Ta* objA,                                   // collidable object A
+                           Tb* objB,                                   // collidable object B
+                           const ChCollisionInfo& cinfo,               // collision information
+                           const ChContactMaterialCompositeSMC& cmat,  // composite material
+                           bool calculate_force                        // calculate contact force now?
 ) {
-    if (lastcontact != contactlist.end()) {
+    if (Tcont* mc = contactlist.Reuse()) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
-        lastcontact++;
+        if (calculate_force)
+            mc->Reset(objA, objB, cinfo, cmat);
+        else
+            mc->ResetGeometry(objA, objB, cinfo, cmat);
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        contactlist.Emplace(container, objA, objB, cinfo, cmat, calculate_force);
     }
     n_added++;
 }
@@ -218,27 +230,35 @@ void ChContactContainerSMC::AddContact(const ChCollisionInfo& cinfo,
     InsertContact(cinfo, cmat);
 }
 
-void ChContactContainerSMC::AddContact(const ChCollisionInfo& cinfo) {
+// Check if a contact must be created for the collision pair (with valid pointers to the colliding shapes).
+bool ChContactContainerSMC::IsContactAdmissible(const ChCollisionInfo& cinfo) {
     assert(cinfo.modelA->GetContactable());
     assert(cinfo.modelB->GetContactable());
 
     // Do nothing if the shapes are separated
     if (cinfo.distance >= 0)
-        return;
+        return false;
 
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
 
     // Do nothing if any of the contactables is not contact-active
     if (!contactableA->IsContactActive() && !contactableB->IsContactActive())
-        return;
+        return false;
 
     // Check that the two collision models are compatible with penalty contact.
     if (cinfo.shapeA->GetContactMethod() != ChContactMethod::SMC ||
         cinfo.shapeB->GetContactMethod() != ChContactMethod::SMC) {
-        return;
+        return false;
     }
 
+    return true;
+}
+
+void ChContactContainerSMC::AddContact(const ChCollisionInfo& cinfo) {
+    if (!IsContactAdmissible(cinfo))
+        return;
+
     // Create the composite material
     ChContactMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
                                        std::static_pointer_cast<ChContactMaterialSMC>(cinfo.shapeA->GetMaterial()),
@@ -252,10 +272,44 @@ void ChContactContainerSMC::AddContact(const ChCollisionInfo& cinfo) {
     InsertContact(cinfo, cmat);
 }
 
+void ChContactContainerSMC::AddContacts(const std::vector<ChCollisionInfo>& cinfo_list) {
+    int num_pairs = (int)cinfo_list.size();
+    int nthreads = m_nthreads;
+
+    // Filter the collision pairs (each pair only writes its own entry)
+    m_batch_valid.resize(num_pairs);
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int i = 0; i < num_pairs; i++) {
+        m_batch_valid[i] = IsContactAdmissible(cinfo_list[i]);
+    }
+
+    // Create the composite materials and insert the contacts in order (the material composition strategy, the user
+    // callback, and the contact lists are not assumed to be thread-safe)
+    for (int i = 0; i < num_pairs; i++) {
+        if (!m_batch_valid[i])
+            continue;
+
+        const auto& cinfo = cinfo_list[i];
+        ChContactMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
+                                           std::static_pointer_cast<ChContactMaterialSMC>(cinfo.shapeA->GetMaterial()),
+                                           std::static_pointer_cast<ChContactMaterialSMC>(cinfo.shapeB->GetMaterial()));
+
+        if (GetAddContactCallback()) {
+            GetAddContactCallback()->OnAddContact(cinfo, &cmat);
+        }
+
+        InsertContact(cinfo, cmat);
+    }
+}
+
 void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeSMC& cmat) {
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
 
+    // with parallel force evaluation, contact forces are calculated in EndAddContact
+    bool calculate_force = !m_parallel_forces;
+
     // CREATE THE CONTACTS
     //
     // Switch among the various cases of contacts: i.e. between a 6-dof variable and another 6-dof variable,
@@ -273,25 +327,25 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, n_added_3_3, this, objA, objB, cinfo, cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
+                                      cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, n_added_333_3, this, objB, objA,
+                                      swapped_cinfo, cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, n_added_666_3, this, objB, objA,
+                                      swapped_cinfo, cmat, calculate_force);
             }
         } break;
 
@@ -300,23 +354,23 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, n_added_6_3, this, objA, objB, cinfo, cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_6, n_added_6_6, this, objA, objB, cinfo, cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, n_added_333_6, this, objB, objA,
+                                      swapped_cinfo, cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, n_added_666_6, this, objB, objA,
+                                      swapped_cinfo, cmat, calculate_force);
             }
         } break;
 
@@ -325,24 +379,24 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_3, n_added_333_3, this, objA, objB, cinfo,
+                                      cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_6, n_added_333_6, this, objA, objB, cinfo,
+                                      cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, n_added_333_333, this, objA, objB,
+                                      cinfo, cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, n_added_666_333, this, objB, objA,
+                                      swapped_cinfo, cmat, calculate_force);
             }
         } break;
 
@@ -351,23 +405,23 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_3, n_added_666_3, this, objA, objB, cinfo,
+                                      cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_6, n_added_666_6, this, objA, objB, cinfo,
+                                      cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, n_added_666_333, this, objA, objB,
+                                      cinfo, cmat, calculate_force);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, n_added_666_666, this, objA, objB,
+                                      cinfo, cmat, calculate_force);
             }
         } break;
 
@@ -409,8 +463,8 @@ ChVector3d ChContactContainerSMC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactList<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -439,52 +493,104 @@ void ChContactContainerSMC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 // STATE INTERFACE
 
 template <class Tcont>
-void _IntLoadResidual_F(std::list<Tcont*>& contactlist, ChVectorDynamic<>& R, const double c) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _IntLoadResidual_F(ChContactList<Tcont>& contactlist, ChVectorDynamic<>& R, const double c) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_F(R, c);
         ++itercontact;
     }
 }
 
+// Load the forces of a subset of the contacts in the list into the given thread-local residual.
+// Must be called from within an OpenMP parallel region.
+template <class Tcont>
+void _IntLoadResidual_F_parallel(ChContactList<Tcont>& contactlist, ChVectorDynamic<>& R, const double c) {
+    int ncontacts = (int)contactlist.size();
+#pragma omp for schedule(static) nowait
+    for (int ic = 0; ic < ncontacts; ic++) {
+        contactlist[ic]->ContIntLoadResidual_F(R, c);
+    }
+}
+
 void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
-    _IntLoadResidual_F(contactlist_3_3, R, c);
-    _IntLoadResidual_F(contactlist_6_3, R, c);
-    _IntLoadResidual_F(contactlist_6_6, R, c);
-    _IntLoadResidual_F(contactlist_333_3, R, c);
-    _IntLoadResidual_F(contactlist_333_6, R, c);
-    _IntLoadResidual_F(contactlist_333_333, R, c);
-    _IntLoadResidual_F(contactlist_666_3, R, c);
-    _IntLoadResidual_F(contactlist_666_6, R, c);
-    _IntLoadResidual_F(contactlist_666_333, R, c);
-    _IntLoadResidual_F(contactlist_666_666, R, c);
+    int nthreads = GetSystem() ? GetSystem()->nthreads_chrono : 1;
+
+    if (nthreads == 1 || GetNumContacts() == 0) {
+        _IntLoadResidual_F(contactlist_3_3, R, c);
+        _IntLoadResidual_F(contactlist_6_3, R, c);
+        _IntLoadResidual_F(contactlist_6_6, R, c);
+        _IntLoadResidual_F(contactlist_333_3, R, c);
+        _IntLoadResidual_F(contactlist_333_6, R, c);
+        _IntLoadResidual_F(contactlist_333_333, R, c);
+        _IntLoadResidual_F(contactlist_666_3, R, c);
+        _IntLoadResidual_F(contactlist_666_6, R, c);
+        _IntLoadResidual_F(contactlist_666_333, R, c);
+        _IntLoadResidual_F(contactlist_666_666, R, c);
+        return;
+    }
+
+    // Different contacts may act on the same objects: accumulate the contact forces in thread-local residual vectors
+    // (each thread processes a subset of the contacts in each list), then add them to R
+    m_thread_R.resize(nthreads);
+    int n = (int)R.size();
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        auto& R_thread = m_thread_R[ChOMP::GetThreadNum()];
+        R_thread.setZero(n);
+
+        _IntLoadResidual_F_parallel(contactlist_3_3, R_thread, c);
+        _IntLoadResidual_F_parallel(contactlist_6_3, R_thread, c);
+        _IntLoadResidual_F_parallel(contactlist_6_6, R_thread, c);
+        _IntLoadResidual_F_parallel(contactlist_333_3, R_thread, c);
+        _IntLoadResidual_F_parallel(contactlist_333_6, R_thread, c);
+        _IntLoadResidual_F_parallel(contactlist_333_333, R_thread, c);
+        _IntLoadResidual_F_parallel(contactlist_666_3, R_thread, c);
+        _IntLoadResidual_F_parallel(contactlist_666_6, R_thread, c);
+        _IntLoadResidual_F_parallel(contactlist_666_333, R_thread, c);
+        _IntLoadResidual_F_parallel(contactlist_666_666, R_thread, c);
+
+#pragma omp barrier
+
+        // each thread sums a range of residual entries (over all threads in the team)
+        int nthreads_team = ChOMP::GetNumThreads();
+#pragma omp for schedule(static)
+        for (int i = 0; i < n; i++) {
+            for (int it = 0; it < nthreads_team; it++)
+                R(i) += m_thread_R[it](i);
+        }
+    }
 }
 
 template <class Tcont>
-void _KRMmatricesLoad(std::list<Tcont*> contactlist, double Kfactor, double Rfactor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContKRMmatricesLoad(Kfactor, Rfactor);
-        ++itercontact;
+void _KRMmatricesLoad(ChContactList<Tcont>& contactlist, double Kfactor, double Rfactor, int nthreads) {
+    int ncontacts = (int)contactlist.size();
+
+    // Each contact only loads its own KRM block
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ic = 0; ic < ncontacts; ic++) {
+        contactlist[ic]->ContKRMmatricesLoad(Kfactor, Rfactor);
     }
 }
 
 void ChContactContainerSMC::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor);
+    int nthreads = GetSystem() ? GetSystem()->nthreads_chrono : 1;
+
+    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor, nthreads);
 }
 
 template <class Tcont>
-void _InjectKRMmatrices(std::list<Tcont*> contactlist, ChSystemDescriptor& descriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectKRMmatrices(ChContactList<Tcont>& contactlist, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContInjectKRMmatrices(descriptor);
         ++itercontact;
@@ -17,16 +17,15 @@
 
 #include <algorithm>
 #include <cmath>
-#include <list>
-
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChContactList.h"
 #include "chrono/physics/ChContactSMC.h"
 #include "chrono/physics/ChContactable.h"
 
 namespace chrono {
 
 /// Class representing a container of many smooth (penalty) contacts.
-/// Implemented using linked lists of ChContactSMC objects (that is, contacts between two ChContactable objects).
+/// Implemented using lists of ChContactSMC objects (that is, contacts between two ChContactable objects).
 class ChApi ChContactContainerSMC : public ChContactContainer {
   public:
     typedef ChContactSMC<ChContactable_1vars<3>, ChContactable_1vars<3> > ChContactSMC_3_3;
@@ -41,16 +40,16 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     typedef ChContactSMC<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<6, 6, 6> > ChContactSMC_666_666;
 
   protected:
-    std::list<ChContactSMC_3_3*> contactlist_3_3;
-    std::list<ChContactSMC_6_3*> contactlist_6_3;
-    std::list<ChContactSMC_6_6*> contactlist_6_6;
-    std::list<ChContactSMC_333_3*> contactlist_333_3;
-    std::list<ChContactSMC_333_6*> contactlist_333_6;
-    std::list<ChContactSMC_333_333*> contactlist_333_333;
-    std::list<ChContactSMC_666_3*> contactlist_666_3;
-    std::list<ChContactSMC_666_6*> contactlist_666_6;
-    std::list<ChContactSMC_666_333*> contactlist_666_333;
-    std::list<ChContactSMC_666_666*> contactlist_666_666;
+    ChContactList<ChContactSMC_3_3> contactlist_3_3;
+    ChContactList<ChContactSMC_6_3> contactlist_6_3;
+    ChContactList<ChContactSMC_6_6> contactlist_6_6;
+    ChContactList<ChContactSMC_333_3> contactlist_333_3;
+    ChContactList<ChContactSMC_333_6> contactlist_333_6;
+    ChContactList<ChContactSMC_333_333> contactlist_333_333;
+    ChContactList<ChContactSMC_666_3> contactlist_666_3;
+    ChContactList<ChContactSMC_666_6> contactlist_666_6;
+    ChContactList<ChContactSMC_666_333> contactlist_666_333;
+    ChContactList<ChContactSMC_666_666> contactlist_666_666;
 
     int n_added_3_3;
     int n_added_6_3;
@@ -63,16 +62,8 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     int n_added_666_333;
     int n_added_666_666;
 
-    std::list<ChContactSMC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactSMC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactSMC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactSMC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactSMC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactSMC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactSMC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactSMC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactSMC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactSMC_666_666*>::iterator lastcontact_666_666;
+    int m_nthreads;          ///< number of threads for contact force evaluation (set in BeginAddContact)
+    bool m_parallel_forces;  ///< contact forces evaluated in parallel in EndAddContact (set in BeginAddContact)
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
@@ -93,9 +84,19 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
+    /// Enable/disable pooled storage of contact objects (default: false).
+    /// If enabled, contacts of each type are constructed in large contiguous memory blocks and are recycled (never
+    /// deallocated) between steps, which avoids heap allocations and improves cache locality for large numbers of
+    /// contacts, at the cost of retaining memory for the maximum number of contacts encountered so far.
+    /// Changing the storage mode removes all existing contacts.
+    void SetPooledStorage(bool val);
+
+    /// Return true if pooled storage of contact objects is enabled.
+    bool IsPooledStorage() const { return contactlist_6_6.IsPooled(); }
+
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
     /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
+    /// the contact lists and tries to reuse previous contact objects until possible, to avoid too much
     /// allocation/deallocation.
     virtual void BeginAddContact() override;
 
@@ -111,8 +112,18 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
+    /// Add a batch of contacts between pairs of collision shapes, storing them into this container.
+    /// The result is the same as calling AddContact() for each collision info object, in order. The collision pairs
+    /// are filtered concurrently, using the number of Chrono threads of the system. The composite contact materials are
+    /// then created, the AddContactCallback (if any) invoked, and the contacts inserted sequentially.
+    virtual void AddContacts(const std::vector<ChCollisionInfo>& cinfo_list) override;
+
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any), unless
+    /// pooled storage is enabled.
+    /// If the system uses more than one Chrono thread (see ChSystem::SetNumThreads) and the contact force algorithm is
+    /// thread-safe (see ChSystemSMC::ChContactForceTorqueSMC::IsThreadSafe), the calculation of contact forces (and of
+    /// contact Jacobians for stiff contacts) is deferred from AddContact to this function and performed in parallel.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -135,6 +146,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     // STATE FUNCTIONS
 
+    /// Add the contact forces to the residual R += c*F.
+    /// With multiple Chrono threads, the contact forces are accumulated in thread-local residual vectors which are
+    /// then summed into R.
     virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
     virtual void LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) override;
     virtual void InjectKRMMatrices(ChSystemDescriptor& descriptor) override;
@@ -152,7 +166,13 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   private:
+    /// Check if a contact must be created for the collision pair (with valid pointers to the colliding shapes).
+    static bool IsContactAdmissible(const ChCollisionInfo& cinfo);
+
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeSMC& cmat);
+
+    std::vector<char> m_batch_valid;  ///< flags for admissible pairs of a contact batch
+    std::vector<ChVectorDynamic<>> m_thread_R;                     ///< thread-local residual vectors
 };
 
 CH_CLASS_VERSION(ChContactContainerSMC, 0)
@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_CONTACT_LIST_H
+#define CH_CONTACT_LIST_H
+
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace chrono {
+
+/// Storage for the contacts of a given type, used by the NSC and SMC contact containers.
+/// Active contacts are kept in a contiguous array of pointers and traversed in insertion order. Contact objects are
+/// recycled from one collision detection pass to the next (see Rewind, Reuse, and Trim).
+/// Contact objects can either be individually allocated on the heap (default) or constructed in large contiguous
+/// memory blocks (pooled storage). With pooled storage, contact objects are never released before a call to Clear(),
+/// so that no memory allocation occurs once the number of contacts has reached its maximum, and contacts are laid out
+/// in memory in the same order they are traversed.
+template <class Tcont>
+class ChContactList {
+  public:
+    typedef typename std::vector<Tcont*>::iterator iterator;
+    typedef typename std::vector<Tcont*>::const_iterator const_iterator;
+
+    ChContactList() : m_num_active(0), m_pooled(false), m_block_used(0) {}
+    ~ChContactList() { Clear(); }
+
+    ChContactList(const ChContactList&) = delete;
+    ChContactList& operator=(const ChContactList&) = delete;
+
+    /// Enable/disable pooled storage of contact objects (default: false).
+    /// Changing the storage mode deletes all existing contacts.
+    void SetPooled(bool val) {
+        if (val == m_pooled)
+            return;
+        Clear();
+        m_pooled = val;
+    }
+
+    /// Return true if contact objects are allocated in contiguous memory blocks.
+    bool IsPooled() const { return m_pooled; }
+
+    /// Return the number of active contacts.
+    size_t size() const { return m_num_active; }
+
+    /// Return true if there are no active contacts.
+    bool empty() const { return m_num_active == 0; }
+
+    /// Return the i-th active contact.
+    Tcont* operator[](size_t i) const { return m_contacts[i]; }
+
+    iterator begin() { return m_contacts.begin(); }
+    iterator end() { return m_contacts.begin() + m_num_active; }
+    const_iterator begin() const { return m_contacts.begin(); }
+    const_iterator end() const { return m_contacts.begin() + m_num_active; }
+
+    /// Deactivate all contacts, making the existing contact objects available for reuse.
+    void Rewind() { m_num_active = 0; }
+
+    /// Activate and return the next existing contact object, if any. Otherwise, return nullptr.
+    /// The caller is responsible for reinitializing the returned contact.
+    Tcont* Reuse() {
+        if (m_num_active < m_contacts.size())
+            return m_contacts[m_num_active++];
+        return nullptr;
+    }
+
+    /// Construct a new contact object (with the given constructor arguments) and append it to the active contacts.
+    template <typename... Args>
+    Tcont* Emplace(Args&&... args) {
+        Tcont* contact =
+            m_pooled ? new (AllocateSlot()) Tcont(std::forward<Args>(args)...) : new Tcont(std::forward<Args>(args)...);
+        m_contacts.push_back(contact);
+        std::swap(m_contacts[m_num_active], m_contacts.back());
+        m_num_active++;
+        return contact;
+    }
+
+    /// Release the contact objects that were not reused since the last call to Rewind().
+    /// With pooled storage, these objects are kept for later reuse.
+    void Trim() {
+        if (m_pooled)
+            return;
+        for (size_t i = m_num_active; i < m_contacts.size(); i++)
+            delete m_contacts[i];
+        m_contacts.resize(m_num_active);
+    }
+
+    /// Delete all contact objects and release all memory.
+    void Clear() {
+        for (auto contact : m_contacts) {
+            if (m_pooled)
+                contact->~Tcont();
+            else
+                delete contact;
+        }
+        m_contacts.clear();
+        m_blocks.clear();
+        m_block_used = 0;
+        m_num_active = 0;
+    }
+
+  private:
+    static const size_t m_block_size = 256;  ///< number of contact objects per memory block
+
+    /// Uninitialized storage for one contact object.
+    struct alignas(Tcont) Slot {
+        unsigned char data[sizeof(Tcont)];
+    };
+
+    /// Return uninitialized storage for a new contact object, allocating a new block if needed.
+    void* AllocateSlot() {
+        if (m_blocks.empty() || m_block_used == m_block_size) {
+            m_blocks.emplace_back(new Slot[m_block_size]);
+            m_block_used = 0;
+        }
+        return &m_blocks.back()[m_block_used++];
+    }
+
+    std::vector<Tcont*> m_contacts;                 ///< contact objects (active ones first)
+    size_t m_num_active;                            ///< number of active contacts
+    bool m_pooled;                                  ///< contact objects allocated in contiguous blocks?
+    std::vector<std::unique_ptr<Slot[]>> m_blocks;  ///< memory blocks for pooled storage
+    size_t m_block_used;                            ///< number of used slots in last block
+};
+
+}  // end namespace chrono
+
+#endif
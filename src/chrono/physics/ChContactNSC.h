@@ -128,6 +128,9 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector3d GetContactForce() const override { return react_force; }
 
+    /// Set the contact force, in contact coordinate system (e.g., as initial guess for warm starting the solver).
+    void SetContactForce(const ChVector3d& force) { react_force = force; }
+
     /// Get the contact friction coefficient
     virtual double GetFriction() { return Nx.GetFrictionCoefficient(); }
 
@@ -221,6 +221,9 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
 
         return {force, VNULL};  // zero torque anyway
     }
+
+    /// The default algorithm does not modify any shared data and can be used concurrently.
+    virtual bool IsThreadSafe() const override { return true; }
 };
 
 /// Class for smooth (penalty-based) contact between two generic contactable objects.
@@ -242,17 +245,23 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     ChVector3d m_torque;       ///< contact torque on objB
     ChContactJacobian* m_Jac;  ///< contact Jacobian data
 
+    ChContactMaterialCompositeSMC m_mat;  ///< composite material for contact pair
+
   public:
     ChContactSMC() : m_Jac(NULL) {}
 
-    ChContactSMC(ChContactContainer* contact_container,    ///< contact container
-                 Ta* obj_A,                                ///< contactable object A
-                 Tb* obj_B,                                ///< contactable object B
-                 const ChCollisionInfo& cinfo,             ///< data for the collision pair
-                 const ChContactMaterialCompositeSMC& mat  ///< composite material
+    ChContactSMC(ChContactContainer* contact_container,     ///< contact container
+                 Ta* obj_A,                                 ///< contactable object A
+                 Tb* obj_B,                                 ///< contactable object B
+                 const ChCollisionInfo& cinfo,              ///< data for the collision pair
+                 const ChContactMaterialCompositeSMC& mat,  ///< composite material
+                 bool calculate_force = true                ///< if false, defer force calculation
                  )
         : ChContactTuple<Ta, Tb>(contact_container, obj_A, obj_B), m_Jac(NULL) {
-        Reset(obj_A, obj_B, cinfo, mat);
+        if (calculate_force)
+            Reset(obj_A, obj_B, cinfo, mat);
+        else
+            ResetGeometry(obj_A, obj_B, cinfo, mat);
     }
 
     ~ChContactSMC() { delete m_Jac; }
@@ -282,6 +291,17 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
                Tb* obj_B,                                ///< contactable object B
                const ChCollisionInfo& cinfo,             ///< data for the collision pair
                const ChContactMaterialCompositeSMC& mat  ///< composite material
+    ) {
+        ResetGeometry(obj_A, obj_B, cinfo, mat);
+        CalculateForce();
+    }
+
+    /// Reinitialize the contact geometry and composite material, without calculating the contact force.
+    /// A subsequent call to CalculateForce is required before this contact can be used.
+    void ResetGeometry(Ta* obj_A,                                ///< contactable object A
+                       Tb* obj_B,                                ///< contactable object B
+                       const ChCollisionInfo& cinfo,             ///< data for the collision pair
+                       const ChContactMaterialCompositeSMC& mat  ///< composite material
     ) {
         // Reset geometric information
         this->Reset_cinfo(obj_A, obj_B, cinfo);
@@ -289,13 +309,20 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
+        m_mat = mat;
+    }
+
+    /// Calculate the contact force and, for stiff contacts, the contact Jacobian matrices.
+    /// This function only modifies data owned by this contact and can therefore be called concurrently for different
+    /// contacts (provided the contact force-torque algorithm is thread-safe).
+    void CalculateForce() {
         // Calculate contact force.
         auto wrench =
             CalculateForceTorque(-this->norm_dist,                            // overlap (here, always positive)
                                  this->normal,                                // normal contact direction
                                  this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
                                  this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
+                                 m_mat                                        // composite material for contact pair
             );
         m_force = wrench.force;
         m_torque = wrench.torque;
@@ -303,7 +330,7 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Set up and compute Jacobian matrices.
         if (static_cast<ChSystemSMC*>(this->container->GetSystem())->IsContactStiff()) {
             CreateJacobians();
-            CalculateJacobians(mat);
+            CalculateJacobians(m_mat);
         }
     }
 
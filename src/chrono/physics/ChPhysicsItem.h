@@ -303,6 +303,27 @@ class ChApi ChPhysicsItem : public ChObj {
                                       const double c           ///< a scaling factor
     ) {}
 
+    /// Return true if all constraints of this item can be enforced by IntProjectLumped.
+    /// Default: true only if the item has no constraints.
+    virtual bool CanProjectLumped() { return GetNumConstraints() == 0; }
+
+    /// Enforce the constraints of this item by projection of the given state, assuming the lumped mass Md.
+    /// Positions (if requested) and velocities are corrected with mass-weighted impulses, and the impulses divided by
+    /// dt are added to L at the given offset. Used by lumped explicit integrators.
+    /// Return false if the item has constraints that do not support projection (default, unless no constraints).
+    virtual bool IntProjectLumped(const unsigned int off_x,     ///< offset in x state vector
+                                  ChState& x,                   ///< state vector, position part
+                                  const unsigned int off_v,     ///< offset in v state vector
+                                  ChStateDelta& v,              ///< state vector, speed part
+                                  const unsigned int off_L,     ///< offset in L multipliers
+                                  ChVectorDynamic<>& L,         ///< result: L += constraint reactions
+                                  const ChVectorDynamic<>& Md,  ///< diagonal of the lumped mass matrix
+                                  const double dt,              ///< time step used to convert impulses
+                                  const bool project_positions  ///< if true, also correct positions
+    ) {
+        return GetNumConstraints() == 0;
+    }
+
     /// Prepare variables and constraints to accommodate a solution:
     virtual void IntToDescriptor(
         const unsigned int off_v,    ///< offset for \e v and \e R
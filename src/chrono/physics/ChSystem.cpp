@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <limits>
 #include <fstream>
 
 #include "chrono/collision/bullet/ChCollisionSystemBullet.h"
@@ -29,6 +30,7 @@
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/solver/ChSolverPSOR.h"
 #include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/solver/ChSolverPSORColored.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChMatrix.h"
@@ -54,6 +56,7 @@ ChSystem::ChSystem()
       m_RTF(0),
       step(0.04),
       use_sleeping(false),
+      solver_owned(false),
       max_penetration_recovery_speed(0.6),
       stepcount(0),
       setupcount(0),
@@ -161,6 +164,10 @@ void ChSystem::RemoveBody(std::shared_ptr<ChBody> body) {
         body->RemoveCollisionModelsFromSystem(collision_system.get());
     assembly.RemoveBody(body);
     body->SetSystem(nullptr);
+
+    // existing contacts (and cached contact data) may refer to the removed object
+    if (contact_container)
+        contact_container->RemoveAllContacts();
 }
 
 void ChSystem::RemoveShaft(std::shared_ptr<ChShaft> shaft) {
@@ -182,6 +189,10 @@ void ChSystem::RemoveMesh(std::shared_ptr<fea::ChMesh> mesh) {
         mesh->RemoveCollisionModelsFromSystem(collision_system.get());
     assembly.RemoveMesh(mesh);
     mesh->SetSystem(nullptr);
+
+    // existing contacts (and cached contact data) may refer to the removed object
+    if (contact_container)
+        contact_container->RemoveAllContacts();
 }
 
 void ChSystem::RemoveOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
@@ -189,6 +200,10 @@ void ChSystem::RemoveOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
         item->RemoveCollisionModelsFromSystem(collision_system.get());
     assembly.RemoveOtherPhysicsItem(item);
     item->SetSystem(nullptr);
+
+    // existing contacts (and cached contact data) may refer to the removed object
+    if (contact_container)
+        contact_container->RemoveAllContacts();
 }
 
 // Add arbitrary physics item to the underlying assembly.
@@ -251,7 +266,14 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
     if (type == ChSolver::Type::CUSTOM)
         return;
 
+    // Carry over the assembly and product options of the current descriptor
+    bool cached_assembly = descriptor && descriptor->IsCachedAssemblyEnabled();
+    bool compiled_products = descriptor && descriptor->IsCompiledProductsEnabled();
+
     descriptor = chrono_types::make_shared<ChSystemDescriptor>();
+    descriptor->SetNumThreads(nthreads_chrono);
+    descriptor->EnableCachedAssembly(cached_assembly);
+    descriptor->EnableCompiledProducts(compiled_products);
 
     switch (type) {
         case ChSolver::Type::PSOR:
@@ -260,6 +282,9 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         case ChSolver::Type::PSSOR:
             solver = chrono_types::make_shared<ChSolverPSSOR>();
             break;
+        case ChSolver::Type::PSOR_COLORED:
+            solver = chrono_types::make_shared<ChSolverPSORColored>(nthreads_chrono);
+            break;
         case ChSolver::Type::PJACOBI:
             solver = chrono_types::make_shared<ChSolverPJacobi>();
             break;
@@ -287,8 +312,10 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         default:
             std::cout << "Unknown solver type. No solver was set." << std::endl;
             std::cout << "Use SetSolver()." << std::endl;
-            break;
+            return;
     }
+
+    solver_owned = true;
 }
 
 void ChSystem::EnableSolverMatrixWrite(bool val, const std::string& out_dir) {
@@ -314,11 +341,13 @@ void ChSystem::UnregisterCustomCollisionCallback(std::shared_ptr<CustomCollision
 void ChSystem::SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescriptor) {
     assert(newdescriptor);
     descriptor = newdescriptor;
+    descriptor->SetNumThreads(nthreads_chrono);
 }
 
 void ChSystem::SetSolver(std::shared_ptr<ChSolver> newsolver) {
     assert(newsolver);
     solver = newsolver;
+    solver_owned = false;
 }
 
 void ChSystem::SetCollisionSystemType(ChCollisionSystem::Type type) {
@@ -377,6 +406,13 @@ void ChSystem::SetNumThreads(int num_threads_chrono, int num_threads_collision,
 
     if (collision_system)
         collision_system->SetNumThreads(nthreads_collision);
+
+    if (descriptor)
+        descriptor->SetNumThreads(nthreads_chrono);
+
+    // only update a solver created by SetSolverType (a user-provided solver keeps its own settings)
+    if (solver_owned && solver->GetType() == ChSolver::Type::PSOR_COLORED)
+        std::static_pointer_cast<ChSolverPSORColored>(solver)->SetNumThreads(nthreads_chrono);
 }
 
 // -----------------------------------------------------------------------------
@@ -458,6 +494,9 @@ void ChSystem::SetTimestepperType(ChTimestepper::Type type) {
         case ChTimestepper::Type::NEWMARK:
             timestepper = chrono_types::make_shared<ChTimestepperNewmark>(this);
             break;
+        case ChTimestepper::Type::CENTRAL_DIFFERENCE:
+            timestepper = chrono_types::make_shared<ChTimestepperCentralDifference>(this);
+            break;
         default:
             throw std::invalid_argument("SetTimestepperType: timestepper not supported");
     }
@@ -866,6 +905,9 @@ void ChSystem::LoadConstraintJacobians() {
 
     // Use also on contact container:
     contact_container->LoadConstraintJacobians();
+
+    // Data gathered by the compiled descriptor products is now out of date
+    descriptor->InvalidateCompiledProducts();
 }
 
 void ChSystem::ConstraintsFetch_react(double factor) {
@@ -1045,6 +1087,14 @@ bool ChSystem::StateSolveCorrection(
         // For ChVariable objects without a ChKRMBlock, just use the 'a' coefficient
         descriptor->SetMassFactor(c_a);
 
+        timer_jacobian.stop();
+    } else if (m_num_constr > 0) {
+        timer_jacobian.start();
+
+        // The solver reuses a Newton matrix evaluated at a previous state (see the Jacobian update method of implicit
+        // timesteppers). Only refresh the constraint Jacobians, which also enter the residuals (IntLoadResidual_CqL).
+        LoadConstraintJacobians();
+
         timer_jacobian.stop();
     }
 
@@ -1224,6 +1274,42 @@ void ChSystem::LoadConstraint_Ct(ChVectorDynamic<>& Qc, const double c) {
     contact_container->IntLoadConstraint_Ct(displ_L + contact_container->GetOffset_L(), Qc, c);
 }
 
+bool ChSystem::CanProjectLumped() {
+    return assembly.CanProjectLumped() && contact_container->CanProjectLumped();
+}
+
+bool ChSystem::StateProjectLumped(ChState& x,
+                                  ChStateDelta& v,
+                                  ChVectorDynamic<>& L,
+                                  const ChVectorDynamic<>& Md,
+                                  const double dt,
+                                  const bool project_positions) {
+    unsigned int off_x = 0;
+    unsigned int off_v = 0;
+    unsigned int off_L = 0;
+
+    // Operate on assembly sub-objects (bodies, links, etc.)
+    bool success = assembly.IntProjectLumped(off_x, x, off_v, v, off_L, L, Md, dt, project_positions);
+
+    // Use also on contact container:
+    unsigned int displ_x = off_x - assembly.offset_x;
+    unsigned int displ_v = off_v - assembly.offset_w;
+    unsigned int displ_L = off_L - assembly.offset_L;
+    success &= contact_container->IntProjectLumped(displ_x + contact_container->GetOffset_x(), x,
+                                                   displ_v + contact_container->GetOffset_w(), v,
+                                                   displ_L + contact_container->GetOffset_L(), L, Md, dt,
+                                                   project_positions);
+
+    return success;
+}
+
+double ChSystem::EstimateCriticalTimeStep() {
+    double dt = std::numeric_limits<double>::infinity();
+    for (const auto& mesh : assembly.GetMeshes())
+        dt = std::min(dt, mesh->EstimateCriticalTimeStep());
+    return dt;
+}
+
 // -----------------------------------------------------------------------------
 //   COLLISION OPERATIONS
 // -----------------------------------------------------------------------------
@@ -1592,7 +1678,16 @@ bool ChSystem::AdvanceDynamics() {
     ManageSleepingBodies();
 
     // Prepare lists of variables and constraints.
-    DescriptorPrepareInject(*descriptor);
+    // The explicit central difference integrator does not use the system descriptor if all constraints (if any) are
+    // enforced by projection, in which case the descriptor is not updated.
+    bool use_descriptor = true;
+    if (timestepper->GetType() == ChTimestepper::Type::CENTRAL_DIFFERENCE) {
+        auto integrator = std::static_pointer_cast<ChTimestepperCentralDifference>(timestepper);
+        bool projected = integrator->IsConstraintProjectionEnabled() && CanProjectLumped();
+        use_descriptor = GetNumConstraints() > 0 && !projected;
+    }
+    if (use_descriptor)
+        DescriptorPrepareInject(*descriptor);
 
     // No need to update counts and offsets, as already done by the above call (in ChSystemDescriptor::EndInsertion)
     ////descriptor->UpdateCountsAndOffsets();
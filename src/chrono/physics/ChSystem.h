@@ -256,8 +256,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in SCM deformable terrain calculations, in the evaluation of SMC contact forces,
+    ///                           in the PSOR_COLORED solver (if set with SetSolverType), and in the processing of
+    ///                           bodies, shafts, and links (if enabled, see EnableParallelLoops).
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -276,6 +278,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     unsigned int GetNumThreadsCollision() const { return nthreads_collision; }
     unsigned int GetNumThreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable/disable parallel processing of bodies, shafts, and links in the underlying assembly (default: false).
+    /// See ChAssembly::EnableParallelLoops.
+    void EnableParallelLoops(bool val) { assembly.EnableParallelLoops(val); }
+
     // DATABASE HANDLING
 
     /// Get the underlying assembly containing all physics items.
@@ -762,6 +768,27 @@ class ChApi ChSystem : public ChIntegrableIIorder {
                                    const double c          ///< a scaling factor
                                    ) override;
 
+    /// Return true if all constraints (including contacts) can be enforced by projection (see StateProjectLumped).
+    virtual bool CanProjectLumped() override;
+
+    /// Enforce the constraints by projection of the given state, assuming the diagonal (lumped) mass matrix Md.
+    /// Velocities (and positions, if requested) are corrected with mass-weighted impulses, and the corresponding
+    /// reactions are added to L. Return false if some of the constraints do not support projection.
+    virtual bool StateProjectLumped(ChState& x,                   ///< state, position part (corrected in place)
+                                    ChStateDelta& v,              ///< state, speed part (corrected in place)
+                                    ChVectorDynamic<>& L,         ///< result: L += constraint reactions
+                                    const ChVectorDynamic<>& Md,  ///< diagonal of the lumped mass matrix
+                                    const double dt,              ///< time step used to convert impulses
+                                    const bool project_positions  ///< if true, also correct positions
+                                    ) override;
+
+    /// Return an estimate of the critical (stable) step size of explicit integrators with lumped mass.
+    /// This is the smallest critical time step of the elements of all FEA meshes in the system (see
+    /// ChMesh::EstimateCriticalTimeStep). Rigid bodies, links, force elements (e.g., springs) and contact stiffness are
+    /// not considered; if these limit the stable step size, a smaller step must be chosen by the user.
+    /// Return infinity if no estimate is available.
+    virtual double EstimateCriticalTimeStep() override;
+
   protected:
     /// Pushes all ChConstraints and ChVariables contained in links, bodies, etc. into the system descriptor.
     virtual void DescriptorPrepareInject(ChSystemDescriptor& sys_descriptor);
@@ -816,6 +843,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< system descriptor
     std::shared_ptr<ChSolver> solver;                ///< solver for DVI or DAE problem
+    bool solver_owned;                               ///< true if the solver was created through SetSolverType
 
     double max_penetration_recovery_speed;  ///< limit for speed of penetration recovery (positive)
 
@@ -29,7 +29,7 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSystemNSC)
 
-ChSystemNSC::ChSystemNSC() : ChSystem() {
+ChSystemNSC::ChSystemNSC(bool pooled_contacts) : ChSystem() {
     // Set the system descriptor
     descriptor = chrono_types::make_shared<ChSystemDescriptor>();
 
@@ -37,7 +37,9 @@ ChSystemNSC::ChSystemNSC() : ChSystem() {
     SetSolverType(ChSolver::Type::PSOR);
 
     // Set default contact container
-    contact_container = chrono_types::make_shared<ChContactContainerNSC>();
+    auto container = chrono_types::make_shared<ChContactContainerNSC>();
+    container->SetPooledStorage(pooled_contacts);
+    contact_container = container;
     contact_container->SetSystem(this);
 
     // Set default collision envelope and margin.
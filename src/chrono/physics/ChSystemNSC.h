@@ -29,7 +29,9 @@ namespace chrono {
 class ChApi ChSystemNSC : public ChSystem {
   public:
     /// Create a physical system.
-    ChSystemNSC();
+    /// If 'pooled_contacts' is true, the default contact container uses pooled storage of contact objects (see
+    /// ChContactContainerNSC::SetPooledStorage).
+    explicit ChSystemNSC(bool pooled_contacts = false);
 
     /// Copy constructor
     ChSystemNSC(const ChSystemNSC& other);
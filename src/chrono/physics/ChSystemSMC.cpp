@@ -30,7 +30,7 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSystemSMC)
 
-ChSystemSMC::ChSystemSMC()
+ChSystemSMC::ChSystemSMC(bool pooled_contacts)
     : ChSystem(),
       m_use_mat_props(true),
       m_contact_model(Hertz),
@@ -45,7 +45,9 @@ ChSystemSMC::ChSystemSMC()
     SetSolverType(ChSolver::Type::PSOR);
 
     // Set default contact container
-    contact_container = chrono_types::make_shared<ChContactContainerSMC>();
+    auto container = chrono_types::make_shared<ChContactContainerSMC>();
+    container->SetPooledStorage(pooled_contacts);
+    contact_container = container;
     contact_container->SetSystem(this);
 
     // For default SMC there is no need to create contacts 'in advance'
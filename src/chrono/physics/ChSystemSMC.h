@@ -52,7 +52,9 @@ class ChApi ChSystemSMC : public ChSystem {
     };
 
     /// Constructor for ChSystemSMC.
-    ChSystemSMC();
+    /// If 'pooled_contacts' is true, the default contact container uses pooled storage of contact objects (see
+    /// ChContactContainerSMC::SetPooledStorage).
+    explicit ChSystemSMC(bool pooled_contacts = false);
 
     /// Copy constructor
     ChSystemSMC(const ChSystemSMC& other);
@@ -138,6 +140,11 @@ class ChApi ChSystemSMC : public ChSystem {
             ChContactable* objA,                       ///< pointer to contactable obj1
             ChContactable* objB                        ///< pointer to contactable obj2
         ) const = 0;
+
+        /// Return true if CalculateForceTorque can be called concurrently for different contacts.
+        /// Only if the algorithm is thread-safe are contact forces evaluated in parallel when the system uses more
+        /// than one Chrono thread (see ChSystem::SetNumThreads); otherwise, they are evaluated sequentially.
+        virtual bool IsThreadSafe() const { return false; }
     };
 
     /// Change the default SMC contact force calculation (and torque, too, if needed).
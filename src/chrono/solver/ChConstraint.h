@@ -19,8 +19,12 @@
 #include "chrono/core/ChClassFactory.h"
 #include "chrono/core/ChMatrix.h"
 
+#include <vector>
+
 namespace chrono {
 
+class ChVariables;
+
 /// Base class for representing constraints (bilateral or unilateral).
 /// These constraints are used with variational inequality or DAE solvers for problems including equalities,
 /// inequalities, nonlinearities, etc.
@@ -226,6 +230,12 @@ class ChApi ChConstraint {
                                              unsigned int start_row,
                                              unsigned int start_col) const = 0;
 
+    /// Append the variables referenced by this constraint to the given list.
+    /// Used by solvers which need the connectivity of the constraint graph (e.g., ChSolverPSORColored).
+    /// Return false if the referenced variables are not known, in which case the list is not modified. This is the
+    /// default implementation; all constraint classes in Chrono override it.
+    virtual bool AppendVariables(std::vector<ChVariables*>& vars) const { return false; }
+
     /// Set offset in global q vector (set automatically by ChSystemDescriptor)
     void SetOffset(unsigned int off) { offset = off; }
 
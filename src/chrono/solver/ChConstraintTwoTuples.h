@@ -120,6 +120,13 @@ class ChConstraintTwoTuples : public ChConstraint {
         tuple_a.PasteJacobianTransposedInto(mat, start_row, start_col);
         tuple_b.PasteJacobianTransposedInto(mat, start_row, start_col);
     }
+
+    /// Append the variable objects referenced by the two tuples to the given list.
+    virtual bool AppendVariables(std::vector<ChVariables*>& vars) const override {
+        tuple_a.AppendVariables(vars);
+        tuple_b.AppendVariables(vars);
+        return true;
+    }
 };
 
 }  // end namespace chrono
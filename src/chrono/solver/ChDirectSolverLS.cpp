@@ -12,6 +12,7 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <cstdint>
 #include <iomanip>
 
 #include "chrono/core/ChSparsityPatternLearner.h"
@@ -33,11 +34,21 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_analyze_call(0),
+      m_reuse_symbolic(false),
+      m_analyzed(false),
+      m_pattern_fingerprint(0) {}
+
+void ChDirectSolverLS::ReuseSymbolicFactorization(bool val) {
+    m_reuse_symbolic = val;
+    m_analyzed = false;
+}
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
     m_timer_setup_solvercall.reset();
+    m_timer_setup_analyze.reset();
     m_timer_solve_assembly.reset();
     m_timer_solve_solvercall.reset();
 }
@@ -63,6 +74,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     if (verbose) {
         std::cout << "Solver setup" << std::endl;
         std::cout << "  call number:    " << m_setup_call << std::endl;
+        std::cout << "  reuse analysis? " << m_reuse_symbolic << std::endl;
         std::cout << "  use learner?    " << m_use_learner << std::endl;
         std::cout << "  pattern locked? " << m_lock << std::endl;
         std::cout << "  CALL learner:   " << call_learner << std::endl;
@@ -93,7 +105,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 
     // Let the concrete solver perform the facorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = m_reuse_symbolic ? FactorizeMatrixReuse() : FactorizeMatrix();
     m_timer_setup_solvercall.stop();
 
     if (write_matrix)
@@ -103,7 +115,8 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         std::cout << " Solver setup [" << m_setup_call << "] n = " << m_dim << "  nnz = " << (int)m_mat.nonZeros()
                   << std::endl;
         std::cout << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSeconds() << "s\n"
-                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s"
+                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s\n"
+                  << "  analyze:           " << m_timer_setup_analyze.GetTimeSeconds() << "s"
                   << std::endl;
     }
 
@@ -169,14 +182,15 @@ bool ChDirectSolverLS::SetupCurrent() {
 
     // Let the concrete solver perform the factorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = m_reuse_symbolic ? FactorizeMatrixReuse() : FactorizeMatrix();
     m_timer_setup_solvercall.stop();
 
     if (verbose) {
         std::cout << " Solver SetupCurrent() [" << m_setup_call << "] n = " << m_dim
                   << "  nnz = " << (int)m_mat.nonZeros() << std::endl;
         std::cout << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSeconds() << "s\n"
-                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s"
+                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s\n"
+                  << "  analyze:           " << m_timer_setup_analyze.GetTimeSeconds() << "s"
                   << std::endl;
     }
 
@@ -222,6 +236,51 @@ double ChDirectSolverLS::SolveCurrent() {
 
 // ---------------------------------------------------------------------------
 
+bool ChDirectSolverLS::FactorizeMatrixReuse() {
+    // Perform a new symbolic analysis only if there is no valid one or if the sparsity pattern changed
+    size_t fingerprint = ComputePatternFingerprint();
+    if (!m_analyzed || fingerprint != m_pattern_fingerprint) {
+        m_timer_setup_analyze.start();
+        m_analyzed = AnalyzeMatrix();
+        m_timer_setup_analyze.stop();
+        m_pattern_fingerprint = fingerprint;
+        m_analyze_call++;
+        if (!m_analyzed)
+            return false;
+    }
+
+    bool result = FactorizeMatrixNumeric();
+
+    // Force a new symbolic analysis at the next call if the numeric factorization failed
+    if (!result)
+        m_analyzed = false;
+
+    return result;
+}
+
+size_t ChDirectSolverLS::ComputePatternFingerprint() const {
+    // FNV-1a hash of the matrix dimensions and of the outer and inner index arrays
+    uint64_t hash = 14695981039346656037ULL;
+    auto hash_int = [&hash](uint64_t val) {
+        hash ^= val;
+        hash *= 1099511628211ULL;
+    };
+
+    hash_int(m_mat.rows());
+    hash_int(m_mat.cols());
+    hash_int(m_mat.nonZeros());
+    const int* outer = m_mat.outerIndexPtr();
+    const int* inner = m_mat.innerIndexPtr();
+    for (Eigen::Index i = 0; i <= m_mat.outerSize(); i++)
+        hash_int(outer[i]);
+    for (Eigen::Index i = 0; i < m_mat.nonZeros(); i++)
+        hash_int(inner[i]);
+
+    return static_cast<size_t>(hash);
+}
+
+// ---------------------------------------------------------------------------
+
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
     std::ofstream file(filename);
     file << std::setprecision(12) << std::scientific;
@@ -279,6 +338,16 @@ bool ChSolverSparseLU::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseLU::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return true;
+}
+
+bool ChSolverSparseLU::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseLU::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
@@ -308,6 +377,16 @@ bool ChSolverSparseQR::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseQR::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return true;
+}
+
+bool ChSolverSparseQR::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseQR::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
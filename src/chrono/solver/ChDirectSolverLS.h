@@ -51,6 +51,12 @@ Enabled by default, the sparsity matrix learner identifies the exact matrix spar
 any nonzeros).\n
 See #UseSparsityPatternLearner();
 
+Independently of the above, the symbolic analysis (fill-reducing reordering and symbolic factorization) performed by the
+underlying direct solver can be reused across calls to Setup, in which case only a numeric factorization is performed
+as long as the sparsity pattern of the matrix does not change. Changes in the sparsity pattern are detected from a
+fingerprint of the matrix structure and trigger a new symbolic analysis.\n
+See #ReuseSymbolicFactorization();
+
 A further option allows the user to provide an estimate for the matrix sparsity (a value in [0,1], with 0 corresponding
 to a fully dense matrix). This value is used if the sparsity pattern learner is disabled if/when required to reserve
 space for matrix indices and nonzeros.
@@ -92,6 +98,14 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable reuse of the symbolic factorization (default: false).\n
+    /// If enabled, the symbolic analysis of the problem matrix is performed only at the first call to Setup and
+    /// whenever the matrix sparsity pattern changes. All other calls only perform a numeric factorization, reusing the
+    /// last symbolic analysis. This is most effective together with a locked sparsity pattern (see
+    /// #LockSparsityPattern()). A concrete direct sparse solver which does not support separate analysis and
+    /// factorization phases always performs a full factorization.
+    void ReuseSymbolicFactorization(bool val);
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
@@ -122,11 +136,20 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     double GetTimeSetup_Assembly() const { return m_timer_setup_assembly(); }
     /// Get cumulative time for Pardiso calls in Setup phase.
     double GetTimeSetup_SolverCall() const { return m_timer_setup_solvercall(); }
+    /// Get cumulative time for symbolic analysis in Setup phase (included in GetTimeSetup_SolverCall).
+    /// Only recorded if reuse of the symbolic factorization is enabled.
+    double GetTimeSetup_SolverCallAnalyze() const { return m_timer_setup_analyze(); }
+    /// Get cumulative time for numeric factorization in Setup phase (included in GetTimeSetup_SolverCall).
+    /// If reuse of the symbolic factorization is disabled, this includes the symbolic analysis.
+    double GetTimeSetup_SolverCallFactorize() const { return m_timer_setup_solvercall() - m_timer_setup_analyze(); }
 
     /// Return the number of calls to the solver's Setup function.
     unsigned int GetNumSetupCalls() const { return m_setup_call; }
     /// Return the number of calls to the solver's Setup function.
     unsigned int GetNumSolveCalls() const { return m_solve_call; }
+    /// Return the number of symbolic analyses performed during calls to the solver's Setup function.
+    /// Only counted if reuse of the symbolic factorization is enabled (otherwise, each Setup call performs one).
+    unsigned int GetNumAnalyzeCalls() const { return m_analyze_call; }
 
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
@@ -179,6 +202,16 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() = 0;
 
+    /// Perform the symbolic analysis of the current sparse matrix and return true if successful.
+    /// Only called if reuse of the symbolic factorization is enabled, in which case it is followed by a call to
+    /// FactorizeMatrixNumeric. The default implementation does nothing.
+    virtual bool AnalyzeMatrix() { return true; }
+
+    /// Numerically factorize the current sparse matrix, reusing the last symbolic analysis, and return true if
+    /// successful. Only called if reuse of the symbolic factorization is enabled. The default implementation performs a
+    /// full factorization.
+    virtual bool FactorizeMatrixNumeric() { return FactorizeMatrix(); }
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() = 0;
@@ -198,23 +231,35 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChVectorDynamic<double> m_rhs;  ///< right-hand side vector
     ChVectorDynamic<double> m_sol;  ///< solution vector
 
-    unsigned int m_solve_call;  ///< counter for calls to Solve
-    unsigned int m_setup_call;  ///< counter for calls to Setup
+    unsigned int m_solve_call;    ///< counter for calls to Solve
+    unsigned int m_setup_call;    ///< counter for calls to Setup
+    unsigned int m_analyze_call;  ///< counter for symbolic analyses
 
     bool m_lock;          ///< is the matrix sparsity pattern locked?
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
 
+    bool m_reuse_symbolic;         ///< reuse the symbolic factorization?
+    bool m_analyzed;               ///< is there a valid symbolic analysis?
+    size_t m_pattern_fingerprint;  ///< fingerprint of the sparsity pattern at last symbolic analysis
+
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
 
     ChTimer m_timer_setup_assembly;    ///< timer for matrix assembly
     ChTimer m_timer_setup_solvercall;  ///< timer for factorization
+    ChTimer m_timer_setup_analyze;     ///< timer for symbolic analysis
     ChTimer m_timer_solve_assembly;    ///< timer for RHS assembly
     ChTimer m_timer_solve_solvercall;  ///< timer for solution
 
   private:
+    /// Factorize the current sparse matrix, performing a symbolic analysis only if required.
+    bool FactorizeMatrixReuse();
+
+    /// Compute a fingerprint of the sparsity pattern of the current (compressed) matrix.
+    size_t ComputePatternFingerprint() const;
+
     void WriteMatrix(const std::string& filename, const ChSparseMatrix& M);
     void WriteVector(const std::string& filename, const ChVectorDynamic<double>& v);
 };
@@ -224,6 +269,8 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
 /// Sparse LU direct solver.\n
 /// Interface to Eigen's SparseLU solver, a supernodal LU factorization for general matrices.\n
 /// Cannot handle VI and complementarity problems, so it cannot be used with NSC formulations.\n
+/// Note that, with the row-major ChSparseMatrix, the Eigen SparseLU factorization requires a structurally symmetric
+/// sparsity pattern (as is the case for Chrono system matrices), with or without reuse of the symbolic analysis.\n
 /// See ChDirectSolverLS for more details.
 class ChApi ChSolverSparseLU : public ChDirectSolverLS {
   public:
@@ -235,6 +282,12 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Perform the symbolic analysis of the current sparse matrix.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Numerically factorize the current sparse matrix, reusing the last symbolic analysis.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -260,6 +313,12 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Perform the symbolic analysis of the current sparse matrix.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Numerically factorize the current sparse matrix, reusing the last symbolic analysis.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -219,6 +219,9 @@ double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
     // Assemble the problem right-hand side vector
     sysd.BuildSystemMatrix(nullptr, &m_rhs);
 
+    // Refresh the data used by the compiled matrix-free products (if enabled)
+    sysd.UpdateCompiledProducts();
+
     // Let the concrete solver compute the solution (in m_sol)
     bool result = SolveProblem();
 
@@ -55,6 +55,8 @@ class ChApi ChSolver {
         BICGSTAB,  ///< Bi-conjugate gradient stabilized
         // Other
         CUSTOM,
+        // Iterative VI solvers (appended to preserve the values of existing types)
+        PSOR_COLORED,  ///< Projected SOR with multithreaded processing of independent (graph-colored) constraints
     };
 
     virtual ~ChSolver() {}
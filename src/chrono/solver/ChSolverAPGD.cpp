@@ -81,6 +81,7 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     // that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
+    sysd.UpdateCompiledProducts();
 
     double L, t;
     double theta;
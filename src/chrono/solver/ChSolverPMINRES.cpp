@@ -58,6 +58,7 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
     // that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
+    sysd.UpdateCompiledProducts();
 
     // Average all g_i for the triplet of contact constraints n,u,v.
     //  Can be used as diagonal preconditioner.
@@ -312,6 +313,8 @@ double ChSolverPMINRES::Solve_SupportingStiffness(ChSystemDescriptor& sysd) {
     ChVectorDynamic<> mtmp(nx);
     ChVectorDynamic<> mDi(nx);
 
+    sysd.UpdateCompiledProducts();
+
     //
     // --- Compute a diagonal (scaling) preconditioner for the KKT system:
     //
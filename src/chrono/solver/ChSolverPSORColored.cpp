@@ -0,0 +1,360 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstdint>
+
+#include "chrono/solver/ChSolverPSORColored.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORColored)
+CH_UPCASTING(ChSolverPSORColored, ChIterativeSolverVI)
+
+// Maximum number of colors (one bit per color in the per-variable masks)
+static const int max_colors = 64;
+
+ChSolverPSORColored::ChSolverPSORColored(int num_threads) : maxviolation(0), m_color_start({0, 0}) {
+    SetNumThreads(num_threads);
+}
+
+void ChSolverPSORColored::SetNumThreads(int num_threads) {
+    m_num_threads = std::max(1, num_threads);
+}
+
+// Friction constraints come in triplets (normal, u, v) which are projected together, as in ChSolverPSOR.
+static bool IsFriction(ChConstraint* constraint) {
+    return constraint->GetMode() == ChConstraint::Mode::FRICTION;
+}
+
+void ChSolverPSORColored::ColorConstraints(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+
+    // Bit masks of the colors already used by blocks acting on each active variable (indexed by variable offset)
+    unsigned int n_q = sysd.CountActiveVariables();
+    std::vector<uint64_t> var_colors(n_q, 0);
+
+    std::vector<unsigned int> block_first;
+    std::vector<unsigned int> block_size;
+    std::vector<int> block_color;
+    std::vector<ChVariables*> vars;
+    std::vector<ChVariables*> next_vars;
+    int num_colors = 0;
+
+    unsigned int nc = (unsigned int)mconstraints.size();
+    unsigned int ic = 0;
+    while (ic < nc) {
+        if (!mconstraints[ic]->IsActive()) {
+            ic += IsFriction(mconstraints[ic]) ? 3 : 1;
+            continue;
+        }
+
+        vars.clear();
+        bool known = true;
+        unsigned int size;
+        if (IsFriction(mconstraints[ic])) {
+            assert(ic + 3 <= nc);
+            size = 3;
+            for (unsigned int k = 0; k < 3; k++)
+                known &= mconstraints[ic + k]->AppendVariables(vars);
+        } else {
+            // Consecutive constraints acting on the same variables (e.g. the equations of a joint) are always
+            // dependent; group them in one block, processed sequentially, so that they need a single color.
+            size = 1;
+            known = mconstraints[ic]->AppendVariables(vars);
+            while (known && ic + size < nc && mconstraints[ic + size]->IsActive() &&
+                   !IsFriction(mconstraints[ic + size])) {
+                next_vars.clear();
+                if (!mconstraints[ic + size]->AppendVariables(next_vars) || next_vars != vars)
+                    break;
+                size++;
+            }
+        }
+
+        // Pick the first color not used by any of the active variables of this block.
+        // Inactive variables are never modified by the solver and do not introduce dependencies.
+        int color = max_colors;
+        if (known) {
+            uint64_t used = 0;
+            for (auto var : vars) {
+                if (var->IsActive())
+                    used |= var_colors[var->GetOffset()];
+            }
+            color = 0;
+            while (color < max_colors && (used & (uint64_t(1) << color)))
+                color++;
+            if (color < max_colors) {
+                for (auto var : vars) {
+                    if (var->IsActive())
+                        var_colors[var->GetOffset()] |= (uint64_t(1) << color);
+                }
+                num_colors = std::max(num_colors, color + 1);
+            }
+        }
+
+        block_first.push_back(ic);
+        block_size.push_back(size);
+        block_color.push_back(color);
+        ic += size;
+    }
+
+    // Sort blocks by color (counting sort, preserving the original order within each color).
+    // Blocks that could not be colored are placed last, in the serial group.
+    m_color_start.assign(num_colors + 2, 0);
+    for (auto color : block_color)
+        m_color_start[std::min(color, num_colors) + 1]++;
+    for (int c = 0; c < num_colors + 1; c++)
+        m_color_start[c + 1] += m_color_start[c];
+
+    m_blocks.resize(block_first.size());
+    m_block_sizes.resize(block_first.size());
+    std::vector<unsigned int> pos(m_color_start.begin(), m_color_start.end() - 1);
+    for (size_t ib = 0; ib < block_first.size(); ib++) {
+        unsigned int p = pos[std::min(block_color[ib], num_colors)]++;
+        m_blocks[p] = block_first[ib];
+        m_block_sizes[p] = block_size[ib];
+    }
+}
+
+// Perform one projected SOR update for the constraint starting at 'ic' (a single constraint or a friction triplet).
+// This is the same update as in ChSolverPSOR.
+static void UpdateConstraint(std::vector<ChConstraint*>& mconstraints,
+                             unsigned int ic,
+                             double omega,
+                             double shlambda,
+                             bool record_deltalambda,
+                             double& maxviolation,
+                             double& maxdeltalambda) {
+    if (IsFriction(mconstraints[ic])) {
+        double old_lambda[3];
+        double candidate_violation = 0;
+
+        for (unsigned int k = 0; k < 3; k++) {
+            ChConstraint* constraint = mconstraints[ic + k];
+
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = constraint->ComputeJacobianTimesState() + constraint->GetRightHandSide() +
+                               constraint->GetComplianceTerm() * constraint->GetLagrangeMultiplier();
+
+            // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (omega / constraint->GetSchurComplement()) * (-mresidual);
+
+            // update:   lambda += delta_lambda;
+            old_lambda[k] = constraint->GetLagrangeMultiplier();
+            constraint->SetLagrangeMultiplier(old_lambda[k] + deltal);
+
+            if (k == 0)
+                candidate_violation = std::abs(std::min(0.0, mresidual));
+        }
+
+        mconstraints[ic]->Project();  // the N normal component will take care of N,U,V
+
+        for (unsigned int k = 0; k < 3; k++) {
+            ChConstraint* constraint = mconstraints[ic + k];
+            double new_lambda = constraint->GetLagrangeMultiplier();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (shlambda != 1.0) {
+                new_lambda = shlambda * new_lambda + (1.0 - shlambda) * old_lambda[k];
+                constraint->SetLagrangeMultiplier(new_lambda);
+            }
+            double true_delta = new_lambda - old_lambda[k];
+            constraint->IncrementState(true_delta);
+
+            if (record_deltalambda)
+                maxdeltalambda = std::max(maxdeltalambda, std::abs(true_delta));
+        }
+
+        maxviolation = std::max(maxviolation, candidate_violation);
+        return;
+    }
+
+    ChConstraint* constraint = mconstraints[ic];
+
+    // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+    double mresidual = constraint->ComputeJacobianTimesState() + constraint->GetRightHandSide() +
+                       constraint->GetComplianceTerm() * constraint->GetLagrangeMultiplier();
+
+    // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+    double candidate_violation = (constraint->GetMode() == ChConstraint::Mode::UNILATERAL)
+                                     ? std::abs(std::min(0.0, mresidual))
+                                     : std::abs(constraint->Violation(mresidual));
+
+    // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+    double deltal = (omega / constraint->GetSchurComplement()) * (-mresidual);
+
+    // update:   lambda += delta_lambda;
+    double old_lambda = constraint->GetLagrangeMultiplier();
+    constraint->SetLagrangeMultiplier(old_lambda + deltal);
+
+    // If new lagrangian multiplier does not satisfy inequalities, project
+    // it into an admissible orthant (or, in general, onto an admissible set)
+    constraint->Project();
+
+    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+    double new_lambda = constraint->GetLagrangeMultiplier();
+    if (shlambda != 1.0) {
+        new_lambda = shlambda * new_lambda + (1.0 - shlambda) * old_lambda;
+        constraint->SetLagrangeMultiplier(new_lambda);
+    }
+
+    // For all items with variables, add the effect of incremented (and projected) lagrangian reactions
+    double true_delta = new_lambda - old_lambda;
+    constraint->IncrementState(true_delta);
+
+    if (record_deltalambda)
+        maxdeltalambda = std::max(maxdeltalambda, std::abs(true_delta));
+
+    maxviolation = std::max(maxviolation, candidate_violation);
+}
+
+// Perform one projected SOR update for each constraint in the block 'ib', in sequence.
+void ChSolverPSORColored::UpdateBlock(std::vector<ChConstraint*>& mconstraints,
+                                      unsigned int ib,
+                                      bool record_deltalambda,
+                                      double& maxviolation,
+                                      double& maxdeltalambda) {
+    unsigned int first = m_blocks[ib];
+    unsigned int last = first + m_block_sizes[ib];
+    for (unsigned int ic = first; ic < last; ic += IsFriction(mconstraints[ic]) ? 3 : 1)
+        UpdateConstraint(mconstraints, ic, m_omega, m_shlambda, record_deltalambda, maxviolation, maxdeltalambda);
+}
+
+double ChSolverPSORColored::Solve(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariables();
+
+    int nthreads = m_num_threads;
+    int nc = (int)mconstraints.size();
+    int nv = (int)mvariables.size();
+
+    m_iterations = 0;
+    maxviolation = 0;
+
+    // 1)  Update auxiliary data in all constraints before starting,
+    //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ic = 0; ic < nc; ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    // Average all g_i for the triplet of contact constraints n,u,v.
+    int j_friction_comp = 0;
+    double gi_values[3];
+    for (int ic = 0; ic < nc; ic++) {
+        if (mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION) {
+            gi_values[j_friction_comp] = mconstraints[ic]->GetSchurComplement();
+            j_friction_comp++;
+            if (j_friction_comp == 3) {
+                double average_g_i = (gi_values[0] + gi_values[1] + gi_values[2]) / 3.0;
+                mconstraints[ic - 2]->SetSchurComplement(average_g_i);
+                mconstraints[ic - 1]->SetSchurComplement(average_g_i);
+                mconstraints[ic - 0]->SetSchurComplement(average_g_i);
+                j_friction_comp = 0;
+            }
+        }
+    }
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system:
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int iv = 0; iv < nv; iv++) {
+        if (mvariables[iv]->IsActive())
+            mvariables[iv]->ComputeMassInverseTimesVector(mvariables[iv]->State(),
+                                                          mvariables[iv]->Force());  // q = [M]'*fb
+    }
+
+    // Partition the constraints in independent sets
+    ColorConstraints(sysd);
+    int num_colors = GetNumColors();
+
+    // 3)  For all items with variables, add the effect of initial (guessed)
+    //     lagrangian reactions of constraints, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    if (m_warm_start) {
+#pragma omp parallel num_threads(nthreads) if (nthreads > 1)
+        {
+            for (int color = 0; color < num_colors; color++) {
+                int start = (int)m_color_start[color];
+                int end = (int)m_color_start[color + 1];
+#pragma omp for schedule(static)
+                for (int ib = start; ib < end; ib++) {
+                    for (unsigned int ic = m_blocks[ib]; ic < m_blocks[ib] + m_block_sizes[ib]; ic++)
+                        mconstraints[ic]->IncrementState(mconstraints[ic]->GetLagrangeMultiplier());
+                }
+            }
+#pragma omp single
+            for (unsigned int ib = m_color_start[num_colors]; ib < m_color_start[num_colors + 1]; ib++) {
+                for (unsigned int ic = m_blocks[ib]; ic < m_blocks[ib] + m_block_sizes[ib]; ic++)
+                    mconstraints[ic]->IncrementState(mconstraints[ic]->GetLagrangeMultiplier());
+            }
+        }
+    } else {
+        for (int ic = 0; ic < nc; ic++)
+            mconstraints[ic]->SetLagrangeMultiplier(0.);
+    }
+
+    // 4)  Perform the iteration loops
+    //
+
+    std::fill(violation_history.begin(), violation_history.end(), 0.0);
+    std::fill(dlambda_history.begin(), dlambda_history.end(), 0.0);
+
+    bool record = this->record_violation_history;
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        maxviolation = 0;
+        double maxdeltalambda = 0;
+
+#pragma omp parallel num_threads(nthreads) if (nthreads > 1)
+        {
+            double thread_maxviolation = 0;
+            double thread_maxdeltalambda = 0;
+
+            // Constraints of the same color do not share active variables and can be updated concurrently.
+            // The implicit barrier at the end of each 'omp for' ensures colors are processed in sequence.
+            for (int color = 0; color < num_colors; color++) {
+                int start = (int)m_color_start[color];
+                int end = (int)m_color_start[color + 1];
+#pragma omp for schedule(static)
+                for (int ib = start; ib < end; ib++) {
+                    UpdateBlock(mconstraints, ib, record, thread_maxviolation, thread_maxdeltalambda);
+                }
+            }
+
+            // Process the constraints which could not be colored
+#pragma omp single
+            for (unsigned int ib = m_color_start[num_colors]; ib < m_color_start[num_colors + 1]; ib++) {
+                UpdateBlock(mconstraints, ib, record, thread_maxviolation, thread_maxdeltalambda);
+            }
+
+#pragma omp critical
+            {
+                maxviolation = std::max(maxviolation, thread_maxviolation);
+                maxdeltalambda = std::max(maxdeltalambda, thread_maxdeltalambda);
+            }
+        }
+
+        // For recording into violation history, if debugging
+        if (record)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+    }  // end iteration loop
+
+    return maxviolation;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_COLORED_H
+#define CHSOLVER_PSOR_COLORED_H
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// A multithreaded iterative solver based on projective fixed point method, with overrelaxation and immediate variable
+/// update as in SOR methods (see ChSolverPSOR), with parallel processing of independent constraints.\n
+/// At the beginning of each solve, the constraint graph is colored so that constraints (or contact triplets) that
+/// share an active ChVariables object receive different colors. Consecutive constraints acting on the same variables
+/// (such as the equations of a joint) form a single block, which is colored once and processed sequentially. Within
+/// one PSOR sweep, colors are processed one after the other and all constraints of a given color are processed in
+/// parallel. Since constraints of the same color do not interact, each sweep is equivalent to a sequential
+/// Gauss-Seidel sweep over a permutation of the constraints.\n
+/// Constraints which cannot be colored (more than 64 colors needed, or unknown connectivity) are processed serially at
+/// the end of each sweep.\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORColored : public ChIterativeSolverVI {
+  public:
+    ChSolverPSORColored(int num_threads = 1);
+
+    ~ChSolverPSORColored() {}
+
+    virtual Type GetType() const override { return Type::PSOR_COLORED; }
+
+    /// Set the number of OpenMP threads used by the solver (default: 1).
+    /// If this solver is created with ChSystem::SetSolverType, this is set (and kept in sync with) the number of
+    /// Chrono threads specified through ChSystem::SetNumThreads.
+    void SetNumThreads(int num_threads);
+
+    /// Return the number of OpenMP threads used by the solver.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the tolerance error reached during the last solve.
+    /// For the PSOR solver, this is the maximum constraint violation.
+    virtual double GetError() const override { return maxviolation; }
+
+    /// Return the number of colors used in the last solve (not counting the serially processed constraints).
+    int GetNumColors() const { return (int)m_color_start.size() - 2; }
+
+  private:
+    /// Partition the active constraint blocks (groups of constraints on the same variables, or friction triplets) by
+    /// color.
+    void ColorConstraints(ChSystemDescriptor& sysd);
+
+    /// Perform one projected SOR update for all constraints in the block 'ib'.
+    void UpdateBlock(std::vector<ChConstraint*>& mconstraints,
+                     unsigned int ib,
+                     bool record_deltalambda,
+                     double& maxviolation,
+                     double& maxdeltalambda);
+
+    int m_num_threads;
+    double maxviolation;
+
+    std::vector<unsigned int> m_blocks;       ///< index of first constraint in each block, sorted by color
+    std::vector<unsigned int> m_block_sizes;  ///< number of constraints in each block
+    std::vector<unsigned int> m_color_start;  ///< start of each color in m_blocks (last color is serial)
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
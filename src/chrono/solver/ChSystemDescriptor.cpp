@@ -12,11 +12,16 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <iomanip>
+#include <typeinfo>
 
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
+#include "chrono/solver/ChConstraintTwoBodies.h"
+#include "chrono/solver/ChVariablesBodyOwnMass.h"
+#include "chrono/solver/ChVariablesBodySharedMass.h"
 #include "chrono/core/ChMatrix.h"
 
 namespace chrono {
@@ -27,7 +32,19 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor()
+    : n_q(0),
+      n_c(0),
+      c_a(1.0),
+      freeze_count(false),
+      m_compiled(false),
+      m_compiled_layout(false),
+      m_data_stamp(0),
+      m_compiled_stamp(0),
+      m_num_threads(1),
+      m_cached_assembly(false),
+      m_num_cached_assemblies(0) {
+    m_assembly_map.valid = false;
     m_constraints.clear();
     m_variables.clear();
     m_KRMblocks.clear();
@@ -93,6 +110,7 @@ void ChSystemDescriptor::UpdateCountsAndOffsets() {
     CountActiveVariables();
     CountActiveConstraints();
     freeze_count = true;
+    m_compiled_layout = false;
 }
 
 void ChSystemDescriptor::PasteMassKRMMatrixInto(ChSparseMatrix& Z,
@@ -160,7 +178,8 @@ void ChSystemDescriptor::BuildSystemMatrix(ChSparseMatrix* Z, ChVectorDynamic<>*
 
     n_c = CountActiveConstraints();
 
-    if (Z) {
+    // Use the cached slot map if possible, otherwise paste all items
+    if (Z && !(m_cached_assembly && BuildSystemMatrixCached(*Z))) {
         Z->conservativeResize(n_q + n_c, n_q + n_c);
 
         Z->setZeroValues();
@@ -181,6 +200,210 @@ void ChSystemDescriptor::BuildSystemMatrix(ChSparseMatrix* Z, ChVectorDynamic<>*
     }
 }
 
+// -----------------------------------------------------------------------------
+// Cached assembly
+
+namespace {
+
+// Sparse matrix stand-in capturing the elements pasted by a single assembly item.
+// When recording, the element locations are appended to the slot map. Otherwise, the element locations are checked
+// against the recorded ones and only the values are stored, in the range of entries reserved for the item.
+template <class SlotMap>
+class ChAssemblyItemWriter : public ChSparseMatrix {
+  public:
+    // Recording writer
+    ChAssemblyItemWriter(SlotMap& map) : m_map(map), m_record(true), m_pos(0), m_end(0), m_failed(false) {}
+
+    // Replaying writer, for the entries in [start, end)
+    ChAssemblyItemWriter(SlotMap& map, size_t start, size_t end)
+        : m_map(map), m_record(false), m_pos(start), m_end(end), m_failed(false) {}
+
+    virtual void SetElement(int row, int col, double val, bool overwrite = true) override {
+        if (m_record) {
+            m_map.entry_row.push_back(row);
+            m_map.entry_col.push_back(col);
+            m_map.entry_overwrite.push_back(overwrite);
+            m_map.entry_value.push_back(val);
+            return;
+        }
+
+        if (m_pos >= m_end || m_map.entry_row[m_pos] != row || m_map.entry_col[m_pos] != col ||
+            m_map.entry_overwrite[m_pos] != (char)overwrite) {
+            m_failed = true;
+            return;
+        }
+        m_map.entry_value[m_pos++] = val;
+    }
+
+    // Return true if the replayed item pasted exactly the recorded entries
+    bool Succeeded() const { return !m_failed && m_pos == m_end; }
+
+  private:
+    SlotMap& m_map;
+    bool m_record;
+    size_t m_pos;
+    size_t m_end;
+    bool m_failed;
+};
+
+}  // end namespace
+
+void ChSystemDescriptor::EnableCachedAssembly(bool val) {
+    m_cached_assembly = val;
+    m_assembly_map.valid = false;
+}
+
+void ChSystemDescriptor::CollectAssemblyItems(std::vector<AssemblyItem>& items) const {
+    items.clear();
+
+    for (const auto& var : m_variables) {
+        if (var->IsActive())
+            items.push_back({var, nullptr, nullptr, 0});
+    }
+
+    for (const auto& krm_block : m_KRMblocks) {
+        items.push_back({nullptr, krm_block, nullptr, 0});
+    }
+
+    unsigned int s_c = 0;
+    for (const auto& constr : m_constraints) {
+        if (constr->IsActive())
+            items.push_back({nullptr, nullptr, constr, n_q + s_c++});
+    }
+}
+
+// Paste the contribution of an item to the system matrix, as done in BuildSystemMatrix.
+// Note that mass/KRM entries, Jacobian entries, transposed Jacobian entries, and compliance entries are in disjoint
+// blocks of the system matrix, so that grouping the pastes by item does not change the result.
+template <class Item>
+static void PasteAssemblyItem(const Item& item, ChSparseMatrix& Z, double c_a) {
+    if (item.var) {
+        item.var->PasteMassInto(Z, 0, 0, c_a);
+    } else if (item.krm) {
+        item.krm->PasteMatrixInto(Z, 0, 0, false);
+    } else {
+        item.constr->PasteJacobianInto(Z, item.row, 0);
+        item.constr->PasteJacobianTransposedInto(Z, 0, item.row);
+        Z.SetElement(item.row, item.row, item.constr->GetComplianceTerm());
+    }
+}
+
+bool ChSystemDescriptor::BuildSystemMatrixCached(ChSparseMatrix& Z) const {
+    auto& map = m_assembly_map;
+    int n = (int)(n_q + n_c);
+
+    if (!Z.isCompressed() || Z.rows() != n || Z.cols() != n) {
+        map.valid = false;
+        return false;
+    }
+
+    std::vector<AssemblyItem> items;
+    CollectAssemblyItems(items);
+
+    // Check whether the slot map can be reused (same items and same sparsity pattern size)
+    bool replay = map.valid && map.rows == n && map.nnz == (int)Z.nonZeros() && map.items.size() == items.size();
+    for (size_t i = 0; replay && i < items.size(); i++) {
+        replay = items[i].var == map.items[i].var && items[i].krm == map.items[i].krm &&
+                 items[i].constr == map.items[i].constr && items[i].row == map.items[i].row;
+    }
+
+    // Collect the item values in parallel, each item writing in its own range of entries
+    if (replay) {
+        int num_items = (int)items.size();
+        int num_failed = 0;
+
+#pragma omp parallel for num_threads(m_num_threads) if (m_num_threads > 1) reduction(+ : num_failed)
+        for (int i = 0; i < num_items; i++) {
+            ChAssemblyItemWriter<AssemblyMap> writer(map, map.item_start[i], map.item_start[i + 1]);
+            PasteAssemblyItem(items[i], writer, c_a);
+            if (!writer.Succeeded())
+                num_failed++;
+        }
+
+        replay = (num_failed == 0);
+    }
+
+    // Record the entries of all items and locate them in the CSR value array
+    if (!replay) {
+        map.valid = false;
+        map.items = items;
+        map.item_start.clear();
+        map.entry_row.clear();
+        map.entry_col.clear();
+        map.entry_overwrite.clear();
+        map.entry_value.clear();
+
+        ChAssemblyItemWriter<AssemblyMap> writer(map);
+        for (const auto& item : items) {
+            map.item_start.push_back(map.entry_row.size());
+            PasteAssemblyItem(item, writer, c_a);
+        }
+        map.item_start.push_back(map.entry_row.size());
+
+        const int* outer = Z.outerIndexPtr();
+        const int* inner = Z.innerIndexPtr();
+        size_t num_entries = map.entry_row.size();
+        std::vector<int> entry_slot(num_entries);
+        for (size_t e = 0; e < num_entries; e++) {
+            const int* first = inner + outer[map.entry_row[e]];
+            const int* last = inner + outer[map.entry_row[e] + 1];
+            const int* it = std::lower_bound(first, last, map.entry_col[e]);
+            if (it == last || *it != map.entry_col[e])
+                return false;  // element not in the sparsity pattern
+            entry_slot[e] = (int)(it - inner);
+        }
+
+        // Group the entries by slot, preserving the assembly order within each slot
+        int nnz = (int)Z.nonZeros();
+        map.slot_start.assign(nnz + 1, 0);
+        for (size_t e = 0; e < num_entries; e++)
+            map.slot_start[entry_slot[e] + 1]++;
+        for (int s = 0; s < nnz; s++)
+            map.slot_start[s + 1] += map.slot_start[s];
+        map.slot_entries.resize(num_entries);
+        std::vector<size_t> slot_pos(map.slot_start.begin(), map.slot_start.end() - 1);
+        for (size_t e = 0; e < num_entries; e++)
+            map.slot_entries[slot_pos[entry_slot[e]]++] = e;
+
+        map.rows = n;
+        map.nnz = nnz;
+        map.valid = true;
+    }
+
+    // Scatter the entry values into the CSR value array, in parallel over rows
+    const int* outer = Z.outerIndexPtr();
+    const int* inner = Z.innerIndexPtr();
+    double* values = Z.valuePtr();
+    int num_mismatch = 0;
+
+#pragma omp parallel for num_threads(m_num_threads) if (m_num_threads > 1) reduction(+ : num_mismatch)
+    for (int row = 0; row < n; row++) {
+        for (int s = outer[row]; s < outer[row + 1]; s++) {
+            double val = 0;
+            for (size_t k = map.slot_start[s]; k < map.slot_start[s + 1]; k++) {
+                size_t e = map.slot_entries[k];
+                if (map.entry_row[e] != row || map.entry_col[e] != inner[s])
+                    num_mismatch++;
+                val = map.entry_overwrite[e] ? map.entry_value[e] : val + map.entry_value[e];
+            }
+            values[s] = val;
+        }
+    }
+
+    if (num_mismatch > 0) {
+        // sparsity pattern changed
+        map.valid = false;
+        return false;
+    }
+
+    if (replay)
+        m_num_cached_assemblies++;
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
 unsigned int ChSystemDescriptor::BuildFbVector(ChVectorDynamic<>& Fvector, unsigned int start_row) const {
     n_q = CountActiveVariables();
     Fvector.setZero(n_q);
@@ -376,6 +599,11 @@ void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
     assert(m_KRMblocks.size() == 0);
     assert(lvector.size() == CountActiveConstraints());
 
+    if (m_compiled) {
+        SchurComplementProductCompiled(result, lvector, enabled);
+        return;
+    }
+
     result.setZero(n_c);
 
     // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
@@ -432,6 +660,11 @@ void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVector
     n_q = CountActiveVariables();
     n_c = CountActiveConstraints();
 
+    if (m_compiled) {
+        SystemProductCompiled(result, x);
+        return;
+    }
+
     result.setZero(n_q + n_c);
 
     // 1) First row: result.q part =  [M + K]*x.q + [Cq']*x.l
@@ -465,6 +698,270 @@ void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVector
     }
 }
 
+// -----------------------------------------------------------------------------
+// Compiled products
+
+// Two-tuple constraints between 6-DOF variables (e.g., body-body contacts)
+typedef ChConstraintTwoTuples<ChVariableTupleCarrier_1vars<6>, ChVariableTupleCarrier_1vars<6>> ChConstraintTwoTuples66;
+
+typedef Eigen::Map<ChVectorN<double, 6>> ChMapVector6;
+typedef Eigen::Map<const ChVectorN<double, 6>> ChMapConstVector6;
+typedef Eigen::Map<const ChRowVectorN<double, 6>> ChMapConstRowVector6;
+
+void ChSystemDescriptor::EnableCompiledProducts(bool val) {
+    m_compiled = val;
+    m_compiled_layout = false;
+}
+
+void ChSystemDescriptor::CompileLayout() {
+    UpdateCountsAndOffsets();
+
+    m_compiled_constraints.clear();
+    m_cblock_source.clear();
+    m_cblock_offset.clear();
+    m_cblock_offset_a.clear();
+    m_cblock_offset_b.clear();
+    m_cblock_state_a.clear();
+    m_cblock_state_b.clear();
+
+    for (const auto& constr : m_constraints) {
+        if (!constr->IsActive())
+            continue;
+
+        ChVariables* var_a = nullptr;
+        ChVariables* var_b = nullptr;
+        CompiledBlockSource src = {constr, nullptr, nullptr, nullptr, nullptr};
+
+        // The concrete types below do not override the Jacobian products of their base classes
+        if (auto c2b = dynamic_cast<ChConstraintTwoBodies*>(constr)) {
+            var_a = c2b->GetVariables_a();
+            var_b = c2b->GetVariables_b();
+            src.Cq_a = c2b->Get_Cq_a().data();
+            src.Cq_b = c2b->Get_Cq_b().data();
+            src.Eq_a = c2b->Get_Eq_a().data();
+            src.Eq_b = c2b->Get_Eq_b().data();
+        } else if (auto c66 = dynamic_cast<ChConstraintTwoTuples66*>(constr)) {
+            var_a = c66->Get_tuple_a().GetVariables();
+            var_b = c66->Get_tuple_b().GetVariables();
+            src.Cq_a = c66->Get_tuple_a().Get_Cq().data();
+            src.Cq_b = c66->Get_tuple_b().Get_Cq().data();
+            src.Eq_a = c66->Get_tuple_a().Get_Eq().data();
+            src.Eq_b = c66->Get_tuple_b().Get_Eq().data();
+        }
+
+        if (!var_a || !var_b || var_a->GetDOF() != 6 || var_b->GetDOF() != 6) {
+            // fall back to the virtual calls
+            m_compiled_constraints.push_back(constr);
+            continue;
+        }
+
+        m_compiled_constraints.push_back(nullptr);
+        m_cblock_source.push_back(src);
+        m_cblock_offset.push_back(constr->GetOffset());
+        m_cblock_offset_a.push_back(var_a->IsActive() ? (int)var_a->GetOffset() : -1);
+        m_cblock_offset_b.push_back(var_b->IsActive() ? (int)var_b->GetOffset() : -1);
+        m_cblock_state_a.push_back(var_a->IsActive() ? var_a->State().data() : nullptr);
+        m_cblock_state_b.push_back(var_b->IsActive() ? var_b->State().data() : nullptr);
+    }
+
+    m_cblock_Cq.resize(12 * m_cblock_offset.size());
+    m_cblock_Eq.resize(12 * m_cblock_offset.size());
+    m_cblock_cfm.resize(m_cblock_offset.size());
+
+    m_compiled_variables.clear();
+    m_cbody_vars.clear();
+    m_cbody_offset.clear();
+
+    for (const auto& var : m_variables) {
+        if (!var->IsActive())
+            continue;
+
+        // only rigid-body variables with the default mass product
+        if (typeid(*var) == typeid(ChVariablesBodyOwnMass) || typeid(*var) == typeid(ChVariablesBodySharedMass)) {
+            m_cbody_vars.push_back(static_cast<ChVariablesBody*>(var));
+            m_cbody_offset.push_back(var->GetOffset());
+        } else {
+            m_compiled_variables.push_back(var);
+        }
+    }
+
+    m_cbody_mass.resize(m_cbody_vars.size());
+    m_cbody_inertia.resize(9 * m_cbody_vars.size());
+
+    m_compiled_layout = true;
+}
+
+void ChSystemDescriptor::UpdateCompiledProducts() {
+    if (!m_compiled)
+        return;
+
+    if (!m_compiled_layout)
+        CompileLayout();
+
+    m_compiled_stamp = m_data_stamp;
+
+    double* Cq = m_cblock_Cq.data();
+    double* Eq = m_cblock_Eq.data();
+    for (size_t ib = 0; ib < m_cblock_source.size(); ib++) {
+        const auto& src = m_cblock_source[ib];
+        std::copy(src.Cq_a, src.Cq_a + 6, Cq + 12 * ib);
+        std::copy(src.Cq_b, src.Cq_b + 6, Cq + 12 * ib + 6);
+        std::copy(src.Eq_a, src.Eq_a + 6, Eq + 12 * ib);
+        std::copy(src.Eq_b, src.Eq_b + 6, Eq + 12 * ib + 6);
+        m_cblock_cfm[ib] = src.constraint->GetComplianceTerm();
+    }
+
+    for (size_t iv = 0; iv < m_cbody_vars.size(); iv++) {
+        const auto& inertia = m_cbody_vars[iv]->GetBodyInertia();
+        m_cbody_mass[iv] = m_cbody_vars[iv]->GetBodyMass();
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                m_cbody_inertia[9 * iv + 3 * i + j] = inertia(i, j);
+    }
+}
+
+void ChSystemDescriptor::SchurComplementProductCompiled(ChVectorDynamic<>& result,
+                                                        const ChVectorDynamic<>& lvector,
+                                                        std::vector<bool>* enabled) {
+    // Refresh the compiled arrays if the layout or the data of the inserted items changed since the last update
+    if (!m_compiled_layout || m_compiled_stamp != m_data_stamp)
+        UpdateCompiledProducts();
+
+    result.setZero(n_c);
+
+    for (const auto& var : m_variables) {
+        if (var->IsActive())
+            var->State().setZero();
+    }
+
+    const double* Cq = m_cblock_Cq.data();
+    const double* Eq = m_cblock_Eq.data();
+
+    // qb = [M^(-1)][Cq']*l  and  result = [E]*l, processing the constraints in the same order as the virtual path
+    size_t ib = 0;
+    for (const auto& constr : m_compiled_constraints) {
+        if (constr) {
+            int s_c = constr->GetOffset();
+            if ((!enabled) || (*enabled)[s_c]) {
+                double li = lvector(s_c);
+                constr->IncrementState(li);
+                result(s_c) = constr->GetComplianceTerm() * li;
+            }
+            continue;
+        }
+
+        unsigned int s_c = m_cblock_offset[ib];
+        if ((!enabled) || (*enabled)[s_c]) {
+            double li = lvector(s_c);
+            if (m_cblock_state_a[ib])
+                ChMapVector6(m_cblock_state_a[ib]) += ChMapConstVector6(Eq + 12 * ib) * li;
+            if (m_cblock_state_b[ib])
+                ChMapVector6(m_cblock_state_b[ib]) += ChMapConstVector6(Eq + 12 * ib + 6) * li;
+            result(s_c) = m_cblock_cfm[ib] * li;
+        }
+        ib++;
+    }
+
+    // result += [Cq]*qb
+    ib = 0;
+    for (const auto& constr : m_compiled_constraints) {
+        if (constr) {
+            if ((!enabled) || (*enabled)[constr->GetOffset()])
+                result(constr->GetOffset()) += constr->ComputeJacobianTimesState();
+            else
+                result(constr->GetOffset()) = 0;
+            continue;
+        }
+
+        unsigned int s_c = m_cblock_offset[ib];
+        if ((!enabled) || (*enabled)[s_c]) {
+            double ret = 0;
+            if (m_cblock_state_a[ib])
+                ret += ChMapConstRowVector6(Cq + 12 * ib) * ChMapConstVector6(m_cblock_state_a[ib]);
+            if (m_cblock_state_b[ib])
+                ret += ChMapConstRowVector6(Cq + 12 * ib + 6) * ChMapConstVector6(m_cblock_state_b[ib]);
+            result(s_c) += ret;
+        } else {
+            result(s_c) = 0;
+        }
+        ib++;
+    }
+}
+
+void ChSystemDescriptor::SystemProductCompiled(ChVectorDynamic<>& result, const ChVectorDynamic<>& x) {
+    // Refresh the compiled arrays if the layout or the data of the inserted items changed since the last update
+    if (!m_compiled_layout || m_compiled_stamp != m_data_stamp)
+        UpdateCompiledProducts();
+
+    result.setZero(n_q + n_c);
+
+    // M*x.q, unrolled as in ChVariablesBodyOwnMass::AddMassTimesVectorInto
+    for (size_t iv = 0; iv < m_cbody_offset.size(); iv++) {
+        unsigned int offset = m_cbody_offset[iv];
+        const double* inertia = &m_cbody_inertia[9 * iv];
+        double q0 = x(offset + 0);
+        double q1 = x(offset + 1);
+        double q2 = x(offset + 2);
+        double q3 = x(offset + 3);
+        double q4 = x(offset + 4);
+        double q5 = x(offset + 5);
+        double scaledmass = c_a * m_cbody_mass[iv];
+        result(offset + 0) += scaledmass * q0;
+        result(offset + 1) += scaledmass * q1;
+        result(offset + 2) += scaledmass * q2;
+        result(offset + 3) += c_a * (inertia[0] * q3 + inertia[1] * q4 + inertia[2] * q5);
+        result(offset + 4) += c_a * (inertia[3] * q3 + inertia[4] * q4 + inertia[5] * q5);
+        result(offset + 5) += c_a * (inertia[6] * q3 + inertia[7] * q4 + inertia[8] * q5);
+    }
+    for (const auto& var : m_compiled_variables) {
+        var->AddMassTimesVectorInto(result, x, c_a);
+    }
+
+    // K*x.q
+    for (const auto& krm_block : m_KRMblocks) {
+        krm_block->AddMatrixTimesVectorInto(result, x);
+    }
+
+    const double* Cq = m_cblock_Cq.data();
+
+    // [Cq']*x.l
+    size_t ib = 0;
+    for (const auto& constr : m_compiled_constraints) {
+        if (constr) {
+            constr->AddJacobianTransposedTimesScalarInto(result, x(constr->GetOffset() + n_q));
+            continue;
+        }
+
+        double l = x(m_cblock_offset[ib] + n_q);
+        if (m_cblock_offset_a[ib] >= 0)
+            result.segment(m_cblock_offset_a[ib], 6) += ChMapConstRowVector6(Cq + 12 * ib).transpose() * l;
+        if (m_cblock_offset_b[ib] >= 0)
+            result.segment(m_cblock_offset_b[ib], 6) += ChMapConstRowVector6(Cq + 12 * ib + 6).transpose() * l;
+        ib++;
+    }
+
+    // result.l = [Cq]*x.q + [E]*x.l
+    ib = 0;
+    for (const auto& constr : m_compiled_constraints) {
+        if (constr) {
+            int s_c = constr->GetOffset() + n_q;
+            constr->AddJacobianTimesVectorInto(result(s_c), x);
+            result(s_c) += constr->GetComplianceTerm() * x(s_c);
+            continue;
+        }
+
+        unsigned int s_c = m_cblock_offset[ib] + n_q;
+        if (m_cblock_offset_a[ib] >= 0)
+            result(s_c) += ChMapConstRowVector6(Cq + 12 * ib) * x.segment(m_cblock_offset_a[ib], 6);
+        if (m_cblock_offset_b[ib] >= 0)
+            result(s_c) += ChMapConstRowVector6(Cq + 12 * ib + 6) * x.segment(m_cblock_offset_b[ib], 6);
+        result(s_c) += m_cblock_cfm[ib] * x(s_c);
+        ib++;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 void ChSystemDescriptor::ConstraintsProject(ChVectorDynamic<>& multipliers) {
     FromVectorToConstraints(multipliers);
 
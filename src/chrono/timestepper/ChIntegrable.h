@@ -16,6 +16,7 @@
 #define CHINTEGRABLE_H
 
 #include <cstdlib>
+#include <limits>
 
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChFrame.h"
@@ -387,6 +388,28 @@ class ChApi ChIntegrableIIorder : public ChIntegrable {
             "LoadLumpedMass_Md() not implemented, explicit integrators with mass lumping cannot be used. ");
     }
 
+    /// Return true if all constraints can be enforced by projection (see StateProjectLumped).
+    /// Used by lumped explicit integrators to select projection or penalty before modifying the state.
+    virtual bool CanProjectLumped() { return GetNumConstraints() == 0; }
+
+    /// Enforce the constraints by projection of the given state, assuming the diagonal (lumped) mass matrix Md.
+    /// Velocities (and positions, if requested) are corrected with mass-weighted impulses, and the corresponding
+    /// reactions (impulses divided by dt) are added to L. Used by lumped explicit integrators.
+    /// Return false if some of the constraints cannot be enforced by projection.
+    virtual bool StateProjectLumped(ChState& x,                   ///< state, position part (corrected in place)
+                                    ChStateDelta& v,              ///< state, speed part (corrected in place)
+                                    ChVectorDynamic<>& L,         ///< result: L += constraint reactions
+                                    const ChVectorDynamic<>& Md,  ///< diagonal of the lumped mass matrix
+                                    const double dt,              ///< time step used to convert impulses
+                                    const bool project_positions  ///< if true, also correct positions
+    ) {
+        return GetNumConstraints() == 0;
+    }
+
+    /// Return an estimate of the critical (stable) step size of explicit integrators with lumped mass.
+    /// The default implementation returns infinity, i.e. no stability limit is known.
+    virtual double EstimateCriticalTimeStep() { return std::numeric_limits<double>::infinity(); }
+
     /// Assuming   M*a = F(x,v,t) + Cq'*L
     ///         C(x,t) = 0
     /// increment a vectorR (usually the residual in a Newton Raphson iteration
@@ -12,7 +12,9 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "chrono/timestepper/ChTimestepper.h"
 
@@ -40,6 +42,7 @@ class ChTimestepper_Type_enum_mapper : public ChTimestepper {
     CH_ENUM_VAL(Type::EULER_EXPLICIT);
     CH_ENUM_VAL(Type::LEAPFROG);
     CH_ENUM_VAL(Type::NEWMARK);
+    CH_ENUM_VAL(Type::CENTRAL_DIFFERENCE);
     CH_ENUM_VAL(Type::CUSTOM);
     CH_ENUM_MAPPER_END(Type);
 };
@@ -68,6 +71,119 @@ void ChTimestepper::ArchiveIn(ChArchiveIn& archive) {
 
 // -----------------------------------------------------------------------------
 
+// Trick to avoid putting the following mapper macro inside the class definition in .h file:
+// enclose macros in local 'ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper'.
+class ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper : public ChImplicitIterativeTimestepper {
+  public:
+    CH_ENUM_MAPPER_BEGIN(JacobianUpdate);
+    CH_ENUM_VAL(JacobianUpdate::EVERY_ITERATION);
+    CH_ENUM_VAL(JacobianUpdate::EVERY_STEP);
+    CH_ENUM_VAL(JacobianUpdate::AUTOMATIC);
+    CH_ENUM_MAPPER_END(JacobianUpdate);
+};
+
+void ChImplicitIterativeTimestepper::SetJacobianUpdateMethod(JacobianUpdate method) {
+    jacobian_update = method;
+    jacobian_current = false;
+}
+
+void ChImplicitIterativeTimestepper::ResetCounters() {
+    numiters = 0;
+    numsetups = 0;
+    numsolves = 0;
+}
+
+bool ChImplicitIterativeTimestepper::CheckJacobianUpdate(bool step_start, double h, unsigned int size) {
+    bool update;
+    if (!jacobian_current || h != jacobian_h || size != jacobian_size) {
+        // no Newton matrix available, or the current one was evaluated for a different step size or problem size
+        update = true;
+    } else {
+        switch (jacobian_update) {
+            case JacobianUpdate::EVERY_ITERATION:
+                update = true;
+                break;
+            case JacobianUpdate::EVERY_STEP:
+                update = step_start;
+                break;
+            default:
+                update = false;
+                break;
+        }
+    }
+
+    if (update) {
+        jacobian_h = h;
+        jacobian_size = size;
+    }
+
+    return update;
+}
+
+void ChImplicitIterativeTimestepper::RecordIteration(bool first_iter, bool setup_called, double correction_norm) {
+    numiters++;
+    numsolves++;
+    numiters_total++;
+    numsolves_total++;
+    if (setup_called) {
+        numsetups++;
+        numsetups_total++;
+        jacobian_current = true;
+    }
+
+    if (first_iter) {
+        // No previous correction in this Newton process to estimate the convergence rate
+        jacobian_reused = !setup_called;
+    } else if (jacobian_update == JacobianUpdate::AUTOMATIC && !setup_called &&
+               correction_norm > jacobian_rate * correction_nrm) {
+        // The Newton matrix was reused and the iteration converges too slowly: request an update
+        jacobian_current = false;
+    }
+
+    correction_nrm = correction_norm;
+}
+
+bool ChImplicitIterativeTimestepper::RetryStep(bool converged) {
+    if (converged || !jacobian_reused)
+        return false;
+
+    // Re-attempt the step with a new Newton matrix (this happens at most once per step)
+    jacobian_current = false;
+    jacobian_reused = false;
+    return true;
+}
+
+void ChImplicitIterativeTimestepper::ArchiveOut(ChArchiveOut& archive) {
+    // version number
+    archive.VersionWrite(2);
+    // serialize all member data:
+    archive << CHNVP(maxiters);
+    archive << CHNVP(reltol);
+    archive << CHNVP(abstolS);
+    archive << CHNVP(abstolL);
+    ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper::JacobianUpdate_mapper updatemapper;
+    archive << CHNVP(updatemapper(jacobian_update), "jacobian_update");
+    archive << CHNVP(jacobian_rate);
+}
+
+void ChImplicitIterativeTimestepper::ArchiveIn(ChArchiveIn& archive) {
+    // version number
+    int version = archive.VersionRead();
+    // stream in all member data:
+    archive >> CHNVP(maxiters);
+    archive >> CHNVP(reltol);
+    archive >> CHNVP(abstolS);
+    archive >> CHNVP(abstolL);
+    if (version >= 2) {
+        ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper::JacobianUpdate_mapper updatemapper;
+        archive >> CHNVP(updatemapper(jacobian_update), "jacobian_update");
+        archive >> CHNVP(jacobian_rate);
+        jacobian_current = false;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerExpl)
 CH_UPCASTING(ChTimestepperEulerExpl, ChTimestepperIorder)
@@ -407,6 +523,175 @@ void ChTimestepperLeapfrog::ArchiveIn(ChArchiveIn& archive) {
 
 // -----------------------------------------------------------------------------
 
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChTimestepperCentralDifference)
+CH_UPCASTING(ChTimestepperCentralDifference, ChTimestepperIIorder)
+CH_UPCASTING(ChTimestepperCentralDifference, ChExplicitTimestepper)
+
+ChTimestepperCentralDifference::ChTimestepperCentralDifference(ChIntegrableIIorder* intgr)
+    : ChTimestepperIIorder(intgr),
+      Tlast(0),
+      mass_current(false),
+      acc_current(false),
+      acc_reuse(false),
+      projection(true),
+      auto_substeps(false),
+      safety_factor(0.9),
+      critical_dt(std::numeric_limits<double>::infinity()),
+      num_substeps(1) {
+    lumping_parameters = new ChLumpingParms();
+}
+
+void ChTimestepperCentralDifference::UpdateLumpedMass() {
+    ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
+
+    double err = 0;
+    Md.setZero(mintegrable->GetNumCoordsVelLevel());
+    mintegrable->LoadLumpedMass_Md(Md, err, 1.0);
+    lumping_parameters->error = err;
+
+    if (Md.size() > 0 && Md.minCoeff() <= 0)
+        throw std::runtime_error("ChTimestepperCentralDifference: the lumped mass matrix is not positive definite.");
+
+    critical_dt = auto_substeps ? mintegrable->EstimateCriticalTimeStep() : std::numeric_limits<double>::infinity();
+
+    mass_current = true;
+}
+
+void ChTimestepperCentralDifference::ComputeAcceleration(bool penalty) {
+    ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
+
+    R.setZero(mintegrable->GetNumCoordsVelLevel());
+    mintegrable->LoadResidual_F(R, 1.0);  // applied and internal forces
+
+    if (penalty) {
+        Qc.setZero(mintegrable->GetNumConstraints());
+        mintegrable->LoadConstraint_C(Qc, -lumping_parameters->Ck_penalty);  // L = -k*C
+        mintegrable->LoadResidual_CqL(R, Qc, 1.0);                           // Fc = Cq' * L
+        L = Qc;
+    }
+
+    // a = Md^-1 * F (no linear solver needed)
+    A.array() = R.array() / Md.array();
+}
+
+// Performs a step of the central difference explicit integrator with lumped mass.
+void ChTimestepperCentralDifference::Advance(const double dt) {
+    // downcast
+    ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
+
+    // the acceleration from the previous step can be reused only if the problem size did not change
+    if (A.size() != mintegrable->GetNumCoordsVelLevel() || Md.size() != A.size())
+        mass_current = false;
+
+    // diagonal lumping cannot be turned off for this integrator
+    if (!lumping_parameters)
+        lumping_parameters = new ChLumpingParms();
+
+    // setup main vectors
+    mintegrable->StateSetup(X, V, A);
+
+    // setup auxiliary vectors
+    L.setZero(mintegrable->GetNumConstraints());
+
+    mintegrable->StateGather(X, V, T);  // state <- system
+
+    // the acceleration of the last step is reused only if requested and if the state was not modified since then
+    if (acc_current) {
+        acc_current = acc_reuse && T == Tlast && X.size() == Xlast.size() && V.size() == Vlast.size() &&
+                      X == Xlast && V == Vlast;
+    }
+
+    if (!mass_current) {
+        // evaluate the forces at the current state first, so that the critical time step estimate (and mass scaling)
+        // use an up-to-date element stiffness
+        R.setZero(mintegrable->GetNumCoordsVelLevel());
+        mintegrable->LoadResidual_F(R, 1.0);
+        UpdateLumpedMass();
+        acc_current = false;
+    }
+
+    num_substeps = 1;
+    if (auto_substeps && critical_dt > 0 && critical_dt < std::numeric_limits<double>::infinity())
+        num_substeps = std::max(1, (int)std::ceil(dt / (safety_factor * critical_dt) - 1e-9));
+    double h = dt / num_substeps;
+
+    // decide between projection and penalty before any modification of the state
+    bool has_constraints = mintegrable->GetNumConstraints() > 0;
+    bool projected = has_constraints && projection && mintegrable->CanProjectLumped();
+
+    // initial acceleration (the system is already in sync with the gathered state)
+    if (!acc_current) {
+        if (projected) {
+            mintegrable->StateProjectLumped(X, V, L, Md, h, true);
+            mintegrable->StateScatter(X, V, T, true);
+        }
+        ComputeAcceleration(has_constraints && !projected);
+        acc_current = true;
+    }
+
+    for (unsigned int i = 0; i < num_substeps; i++) {
+        L.setZero();
+
+        V = V + A * (0.5 * h);  // v_half = v + a * h/2
+        X = X + V * h;          // x_new = x + v_half * h
+        T += h;
+
+        // project the new positions and the mid-step velocities onto the constraints
+        if (projected)
+            mintegrable->StateProjectLumped(X, V, L, Md, h, true);
+
+        // compute the new acceleration (single force evaluation)
+        mintegrable->StateScatter(X, V, T, true);
+        ComputeAcceleration(has_constraints && !projected);
+
+        V = V + A * (0.5 * h);  // v_new = v_half + a_new * h/2
+
+        // project the final velocities onto the constraints
+        if (projected)
+            mintegrable->StateProjectLumped(X, V, L, Md, h, false);
+    }
+
+    mintegrable->StateScatter(X, V, T, true);  // state -> system
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data
+    mintegrable->StateScatterReactions(L);     // -> system auxiliary data
+
+    if (acc_reuse) {
+        Xlast = X;
+        Vlast = V;
+        Tlast = T;
+    }
+}
+
+void ChTimestepperCentralDifference::ArchiveOut(ChArchiveOut& archive) {
+    // version number
+    archive.VersionWrite<ChTimestepperCentralDifference>();
+    // serialize parent class:
+    ChTimestepperIIorder::ArchiveOut(archive);
+    ChExplicitTimestepper::ArchiveOut(archive);
+    // serialize all member data:
+    archive << CHNVP(projection);
+    archive << CHNVP(acc_reuse);
+    archive << CHNVP(auto_substeps);
+    archive << CHNVP(safety_factor);
+}
+void ChTimestepperCentralDifference::ArchiveIn(ChArchiveIn& archive) {
+    // version number
+    /*int version =*/archive.VersionRead<ChTimestepperCentralDifference>();
+    // deserialize parent class:
+    ChTimestepperIIorder::ArchiveIn(archive);
+    ChExplicitTimestepper::ArchiveIn(archive);
+    // stream in all member data:
+    archive >> CHNVP(projection);
+    archive >> CHNVP(acc_reuse);
+    archive >> CHNVP(auto_substeps);
+    archive >> CHNVP(safety_factor);
+    mass_current = false;
+    acc_current = false;
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 CH_UPCASTING(ChTimestepperEulerImplicit, ChTimestepperIIorder)
@@ -431,59 +716,69 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
 
     mintegrable->StateGather(X, V, T);  // state <- system
 
-    // Extrapolate a prediction as warm start
-
-    Xnew = X + V * dt;
-    Vnew = V;  //+ A()*dt;
-
     // use Newton Raphson iteration to solve implicit Euler for v_new
     //
     // [ M - dt*dF/dv - dt^2*dF/dx    Cq' ] [ Dv     ] = [ M*(v_old - v_new) + dt*f + dt*Cq'*l ]
     // [ Cq                           0   ] [ -dt*Dl ] = [ -C/dt  ]
 
-    numiters = 0;
-    numsetups = 0;
-    numsolves = 0;
+    ResetCounters();
+    unsigned int size = mintegrable->GetNumCoordsVelLevel() + mintegrable->GetNumConstraints();
+    bool converged = false;
+
+    do {
+        // Extrapolate a prediction as warm start
+        Xnew = X + V * dt;
+        Vnew = V;  //+ A()*dt;
+        L.setZero();
+        converged = false;
+
+        for (int i = 0; i < this->GetMaxIters(); ++i) {
+            mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
+            R.setZero();
+            Qc.setZero();
+            mintegrable->LoadResidual_F(R, dt);                // R  = dt*f
+            mintegrable->LoadResidual_Mv(R, (V - Vnew), 1.0);  // R += M*(v_old - v_new)
+            mintegrable->LoadResidual_CqL(R, L, dt);           // R += dt*Cq'*l
+            mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp,
+                                          Qc_clamping);  // Qc= C/dt  (sign flipped later in StateSolveCorrection)
+
+            if (verbose)
+                std::cout << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
+                          << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
+
+            if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+                converged = true;
+                break;
+            }
 
-    for (int i = 0; i < this->GetMaxIters(); ++i) {
-        mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
-        R.setZero();
-        Qc.setZero();
-        mintegrable->LoadResidual_F(R, dt);                // R  = dt*f
-        mintegrable->LoadResidual_Mv(R, (V - Vnew), 1.0);  // R += M*(v_old - v_new)
-        mintegrable->LoadResidual_CqL(R, L, dt);           // R += dt*Cq'*l
-        mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp,
-                                      Qc_clamping);  // Qc= C/dt  (sign flipped later in StateSolveCorrection)
-
-        if (verbose)
-            std::cout << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
-                      << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
-
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
-            break;
-
-        mintegrable->StateSolveCorrection(  //
-            Dv, Dl, R, Qc,                  //
-            1.0,                            // factor for  M
-            -dt,                            // factor for  dF/dv
-            -dt * dt,                       // factor for  dF/dx
-            Xnew, Vnew, T + dt,             // not used here (scatter = false)
-            false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
-            false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
-        );
-
-        numiters++;
-        numsetups++;
-        numsolves++;
+            bool call_setup = CheckJacobianUpdate(i == 0, dt, size);
 
-        Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
-        L += Dl;
+            mintegrable->StateSolveCorrection(  //
+                Dv, Dl, R, Qc,                  //
+                1.0,                            // factor for  M
+                -dt,                            // factor for  dF/dv
+                -dt * dt,                       // factor for  dF/dx
+                Xnew, Vnew, T + dt,             // not used here (scatter = false)
+                false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
+                false,                          // full update? (not used, since no scatter)
+                call_setup                      // call the solver's Setup? (always, unless reusing the Newton matrix)
+            );
 
-        Vnew += Dv;
+            RecordIteration(i == 0, call_setup, Dv.norm());
 
-        Xnew = X + Vnew * dt;
-    }
+            // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
+            Dl *= (1.0 / dt);
+            L += Dl;
+
+            Vnew += Dv;
+
+            Xnew = X + Vnew * dt;
+        }
+    } while (RetryStep(converged));
+
+    // Do not reuse the Newton matrix at the next step if the Newton iteration did not converge
+    if (!converged)
+        InvalidateJacobian();
 
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
@@ -745,11 +1040,6 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
     mintegrable->StateGather(X, V, T);  // state <- system
     // mintegrable->StateGatherReactions(L); // <- system  assume l_old = 0;  otherwise DAE gives oscillatory reactions
 
-    // extrapolate a prediction as a warm start
-
-    Xnew = X + V * dt;
-    Vnew = V;  // +A()*dt;
-
     // use Newton Raphson iteration to solve implicit trapezoidal for v_new
     //
     // [M-dt/2*dF/dv-dt^2/4*dF/dx  Cq'] [Dv      ] = [M*(v_old - v_new) + dt/2(f_old + f_new  + Cq*l_old + Cq*l_new)]
@@ -759,49 +1049,64 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
     mintegrable->LoadResidual_Mv(Rold, V, 1.0);   // M*v_old
     // mintegrable->LoadResidual_CqL(Rold, L, dt*0.5); // dt/2*l_old   assume L_old = 0
 
-    numiters = 0;
-    numsetups = 0;
-    numsolves = 0;
+    ResetCounters();
+    unsigned int size = mintegrable->GetNumCoordsVelLevel() + mintegrable->GetNumConstraints();
+    bool converged = false;
+
+    do {
+        // extrapolate a prediction as a warm start
+        Xnew = X + V * dt;
+        Vnew = V;  // +A()*dt;
+        L.setZero();
+        converged = false;
+
+        for (int i = 0; i < this->GetMaxIters(); ++i) {
+            mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
+            R = Rold;
+            Qc.setZero();
+            mintegrable->LoadResidual_F(R, dt * 0.5);       // + dt/2*f_new
+            mintegrable->LoadResidual_Mv(R, Vnew, -1.0);    // - M*v_new
+            mintegrable->LoadResidual_CqL(R, L, dt * 0.5);  // + dt/2*Cq*l_new
+            // Qc= C/dt  (sign will be flipped later in StateSolveCorrection)
+            mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp, Qc_clamping);
+
+            if (verbose)
+                std::cout << " Trapezoidal iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
+                          << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
+
+            if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+                converged = true;
+                break;
+            }
 
-    for (int i = 0; i < this->GetMaxIters(); ++i) {
-        mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
-        R = Rold;
-        Qc.setZero();
-        mintegrable->LoadResidual_F(R, dt * 0.5);       // + dt/2*f_new
-        mintegrable->LoadResidual_Mv(R, Vnew, -1.0);    // - M*v_new
-        mintegrable->LoadResidual_CqL(R, L, dt * 0.5);  // + dt/2*Cq*l_new
-        mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp,
-                                      Qc_clamping);  // Qc= C/dt  (sign will be flipped later in StateSolveCorrection)
-
-        if (verbose)
-            std::cout << " Trapezoidal iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
-                      << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
-
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
-            break;
-
-        mintegrable->StateSolveCorrection(  //
-            Dv, Dl, R, Qc,                  //
-            1.0,                            // factor for  M
-            -dt * 0.5,                      // factor for  dF/dv
-            -dt * dt * 0.25,                // factor for  dF/dx
-            Xnew, Vnew, T + dt,             // not used here (scatter = false)
-            false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
-            false,                          // full update? (not used, since no scatter)
-            true                            // always force a call to the solver's Setup() function
-        );
-
-        numiters++;
-        numsetups++;
-        numsolves++;
+            bool call_setup = CheckJacobianUpdate(i == 0, dt, size);
 
-        Dl *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
-        L += Dl;
+            mintegrable->StateSolveCorrection(  //
+                Dv, Dl, R, Qc,                  //
+                1.0,                            // factor for  M
+                -dt * 0.5,                      // factor for  dF/dv
+                -dt * dt * 0.25,                // factor for  dF/dx
+                Xnew, Vnew, T + dt,             // not used here (scatter = false)
+                false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
+                false,                          // full update? (not used, since no scatter)
+                call_setup                      // call the solver's Setup? (always, unless reusing the Newton matrix)
+            );
 
-        Vnew += Dv;
+            RecordIteration(i == 0, call_setup, Dv.norm());
 
-        Xnew = X + ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
-    }
+            // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
+            Dl *= (2.0 / dt);
+            L += Dl;
+
+            Vnew += Dv;
+
+            Xnew = X + ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
+        }
+    } while (RetryStep(converged));
+
+    // Do not reuse the Newton matrix at the next step if the Newton iteration did not converge
+    if (!converged)
+        InvalidateJacobian();
 
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
@@ -1063,76 +1368,79 @@ void ChTimestepperNewmark::Advance(const double dt) {
     mintegrable->StateGather(X, V, T);  // state <- system
     mintegrable->StateGatherAcceleration(A);
 
-    // extrapolate a prediction as a warm start
-
-    Vnew = V;
-    Xnew = X + Vnew * dt;
-
     // use Newton Raphson iteration to solve implicit Newmark for a_new
 
     //
     // [ M - dt*gamma*dF/dv - dt^2*beta*dF/dx    Cq' ] [ Da   ] = [ -M*(a_new) + f_new + Cq*l_new ]
     // [ Cq                                      0   ] [ -Dl  ] = [ -1/(beta*dt^2)*C              ]
 
-    numiters = 0;
-    numsetups = 0;
-    numsolves = 0;
-    bool call_setup = true;
+    ResetCounters();
+    unsigned int size = mintegrable->GetNumCoordsVelLevel() + mintegrable->GetNumConstraints();
+    bool converged = false;
 
-    for (int i = 0; i < this->GetMaxIters(); ++i) {
-        mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
-
-        R.setZero(mintegrable->GetNumCoordsVelLevel());
-        Qc.setZero(mintegrable->GetNumConstraints());
-        mintegrable->LoadResidual_F(R, 1.0);          //  f_new
-        mintegrable->LoadResidual_CqL(R, L, 1.0);     //   Cq'*l_new
-        mintegrable->LoadResidual_Mv(R, Anew, -1.0);  //  - M*a_new
-        mintegrable->LoadConstraint_C(
-            Qc, (1.0 / (beta * dt * dt)), Qc_do_clamp,
-            Qc_clamping);  //  Qc = 1/(beta*dt^2)*C  (sign will be flipped later in StateSolveCorrection)
-
-        if (verbose)
-            std::cout << " Newmark iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
-                      << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
-
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
-            if (verbose) {
-                std::cout << " Newmark NR converged (" << i << ")."
-                          << "  T = " << T + dt << "  h = " << dt << std::endl;
+    do {
+        // extrapolate a prediction as a warm start
+        Vnew = V;
+        Xnew = X + Vnew * dt;
+        Anew.setZero(mintegrable->GetNumCoordsVelLevel(), mintegrable);
+        L.setZero(mintegrable->GetNumConstraints());
+        converged = false;
+
+        for (int i = 0; i < this->GetMaxIters(); ++i) {
+            mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
+
+            R.setZero(mintegrable->GetNumCoordsVelLevel());
+            Qc.setZero(mintegrable->GetNumConstraints());
+            mintegrable->LoadResidual_F(R, 1.0);          //  f_new
+            mintegrable->LoadResidual_CqL(R, L, 1.0);     //   Cq'*l_new
+            mintegrable->LoadResidual_Mv(R, Anew, -1.0);  //  - M*a_new
+            mintegrable->LoadConstraint_C(
+                Qc, (1.0 / (beta * dt * dt)), Qc_do_clamp,
+                Qc_clamping);  //  Qc = 1/(beta*dt^2)*C  (sign will be flipped later in StateSolveCorrection)
+
+            if (verbose)
+                std::cout << " Newmark iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
+                          << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
+
+            if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+                if (verbose) {
+                    std::cout << " Newmark NR converged (" << i << ")."
+                              << "  T = " << T + dt << "  h = " << dt << std::endl;
+                }
+                converged = true;
+                break;
             }
-            break;
-        }
 
-        if (verbose && modified_Newton && call_setup)
-            std::cout << " Newmark call Setup." << std::endl;
-
-        mintegrable->StateSolveCorrection(  //
-            Da, Dl, R, Qc,                  //
-            1.0,                            // factor for  M
-            -dt * gamma,                    // factor for  dF/dv
-            -dt * dt * beta,                // factor for  dF/dx
-            Xnew, Vnew, T + dt,             // not used here (scatter = false)
-            false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
-            false,                          // full update? (not used, since no scatter)
-            call_setup                      // force a call to the solver's Setup() function
-        );
-
-        numiters++;
-        numsolves++;
-        if (call_setup) {
-            numsetups++;
-        }
+            bool call_setup = CheckJacobianUpdate(i == 0, dt, size);
 
-        // If using modified Newton, do not call Setup again
-        call_setup = !modified_Newton;
+            if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
+                std::cout << " Newmark call Setup." << std::endl;
 
-        L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
-        Anew += Da;
+            mintegrable->StateSolveCorrection(  //
+                Da, Dl, R, Qc,                  //
+                1.0,                            // factor for  M
+                -dt * gamma,                    // factor for  dF/dv
+                -dt * dt * beta,                // factor for  dF/dx
+                Xnew, Vnew, T + dt,             // not used here (scatter = false)
+                false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
+                false,                          // full update? (not used, since no scatter)
+                call_setup                      // force a call to the solver's Setup() function
+            );
 
-        Xnew = X + V * dt + A * (dt * dt * (0.5 - beta)) + Anew * (dt * dt * beta);
+            RecordIteration(i == 0, call_setup, Da.norm());
 
-        Vnew = V + A * (dt * (1.0 - gamma)) + Anew * (dt * gamma);
-    }
+            L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
+            Anew += Da;
+
+            Xnew = X + V * dt + A * (dt * dt * (0.5 - beta)) + Anew * (dt * dt * beta);
+
+            Vnew = V + A * (dt * (1.0 - gamma)) + Anew * (dt * gamma);
+        }
+    } while (RetryStep(converged));
+
+    // Do not reuse the Newton matrix at the next step if the Newton iteration did not converge
+    if (!converged)
+        InvalidateJacobian();
 
     X = Xnew;
     V = Vnew;
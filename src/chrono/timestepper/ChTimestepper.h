@@ -44,6 +44,7 @@ class ChApi ChTimestepper {
         EULER_EXPLICIT = 8,
         LEAPFROG = 9,
         NEWMARK = 10,
+        CENTRAL_DIFFERENCE = 11,
         CUSTOM = 20
     };
 
@@ -186,12 +187,17 @@ class ChApi ChExplicitTimestepper {
     /// If lumping not supported because ChIntegrable::LoadLumpedMass_Md() not implemented, throw exception.
     /// If lumping introduces some approximation, you'll get nonzero in GetLumpingError().
     /// Optionally paramters: the stiffness penalty for constraints, and damping penalty for constraints.
-    void SetDiagonalLumpingON(double Ck = 1000, double Cr = 0) { lumping_parameters = new ChLumpingParms(Ck, Cr); }
+    void SetDiagonalLumpingON(double Ck = 1000, double Cr = 0) {
+        if (lumping_parameters)
+            delete (lumping_parameters);
+        lumping_parameters = new ChLumpingParms(Ck, Cr);
+    }
 
     /// Turn off the diagonal lumping (default is off)
     void SetDiagonalLumpingOFF() {
         if (lumping_parameters)
             delete (lumping_parameters);
+        lumping_parameters = nullptr;
     }
 
     /// Gets the diagonal lumping error done last time the integrator has been called
@@ -231,7 +237,18 @@ class ChApi ChImplicitTimestepper {};
 /// Such integrators require solution of a nonlinear problem, typically solved
 /// using an iterative process, up to a desired tolerance. At each iteration,
 /// a linear system must be solved.
+/// The Newton matrix (Jacobian) of the nonlinear problem can be re-evaluated at each iteration, once per step, or
+/// reused across iterations and steps for as long as the Newton iteration converges fast enough
+/// (see SetJacobianUpdateMethod).
 class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
+  public:
+    /// Strategy for updating the Newton matrix (i.e., calling the solver's Setup function).
+    enum class JacobianUpdate {
+        EVERY_ITERATION,  ///< evaluate and factorize the Newton matrix at every iteration (full Newton)
+        EVERY_STEP,       ///< evaluate and factorize the Newton matrix once per step (modified Newton)
+        AUTOMATIC         ///< reuse the Newton matrix across iterations and steps, while convergence is satisfactory
+    };
+
   protected:
     unsigned int maxiters;  ///< maximum number of iterations
     double reltol;          ///< relative tolerance
@@ -242,11 +259,56 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     unsigned int numsetups;  ///< number of calls to the solver's Setup function
     unsigned int numsolves;  ///< number of calls to the solver's Solve function
 
+    unsigned int numiters_total;   ///< cumulative number of iterations
+    unsigned int numsetups_total;  ///< cumulative number of calls to the solver's Setup function
+    unsigned int numsolves_total;  ///< cumulative number of calls to the solver's Solve function
+
+    JacobianUpdate jacobian_update;  ///< Newton matrix update strategy
+    double jacobian_rate;            ///< convergence rate threshold for a Newton matrix update (AUTOMATIC)
+    bool jacobian_current;           ///< can the current Newton matrix be reused?
+    double jacobian_h;               ///< step size used in the current Newton matrix
+    unsigned int jacobian_size;      ///< problem size of the current Newton matrix
+    double correction_nrm;           ///< norm of the last Newton correction
+    bool jacobian_reused;            ///< was the Newton iteration started with a matrix from a previous step?
+
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          numiters_total(0),
+          numsetups_total(0),
+          numsolves_total(0),
+          jacobian_update(JacobianUpdate::EVERY_ITERATION),
+          jacobian_rate(0.5),
+          jacobian_current(false),
+          jacobian_h(0),
+          jacobian_size(0),
+          correction_nrm(0),
+          jacobian_reused(false) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
+    /// Set the strategy for updating the Newton matrix.
+    /// With AUTOMATIC, the Newton matrix is re-evaluated (and, with a direct linear solver, re-factorized) only if the
+    /// step size or the problem size changed, if the Newton iteration did not converge at the previous step, or if the
+    /// estimated convergence rate (ratio of successive correction norms) exceeds a threshold (see
+    /// SetJacobianUpdateRate). If the Newton iteration started with a matrix from a previous step does not converge,
+    /// the step is re-attempted with a new Newton matrix. Since the problem size is used to detect changes in the
+    /// structure of the Newton matrix, AUTOMATIC should not be used with a changing set of constraints of constant
+    /// size. The default is integrator-dependent.
+    void SetJacobianUpdateMethod(JacobianUpdate method);
+
+    /// Return the strategy for updating the Newton matrix.
+    JacobianUpdate GetJacobianUpdateMethod() const { return jacobian_update; }
+
+    /// Set the convergence rate threshold above which an out-of-date Newton matrix is re-evaluated (default: 0.5).
+    /// Only used with JacobianUpdate::AUTOMATIC.
+    void SetJacobianUpdateRate(double rate) { jacobian_rate = rate; }
+
     /// Set the max number of iterations using the Newton Raphson procedure
     void SetMaxIters(int iters) { maxiters = iters; }
     /// Get the max number of iterations using the Newton Raphson procedure
@@ -284,27 +346,40 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     unsigned int GetNumSolveCalls() const { return numsolves; }
 
+    /// Return the cumulative number of iterations over all steps.
+    unsigned int GetNumIterationsTotal() const { return numiters_total; }
+
+    /// Return the cumulative number of calls to the solver's Setup function over all steps.
+    unsigned int GetNumSetupCallsTotal() const { return numsetups_total; }
+
+    /// Return the cumulative number of calls to the solver's Solve function over all steps.
+    unsigned int GetNumSolveCallsTotal() const { return numsolves_total; }
+
     /// Method to allow serialization of transient data to archives.
-    virtual void ArchiveOut(ChArchiveOut& archive) {
-        // version number
-        archive.VersionWrite(1);
-        // serialize all member data:
-        archive << CHNVP(maxiters);
-        archive << CHNVP(reltol);
-        archive << CHNVP(abstolS);
-        archive << CHNVP(abstolL);
-    }
+    virtual void ArchiveOut(ChArchiveOut& archive);
 
     /// Method to allow de-serialization of transient data from archives.
-    virtual void ArchiveIn(ChArchiveIn& archive) {
-        // version number
-        /*int version =*/archive.VersionRead();
-        // stream in all member data:
-        archive >> CHNVP(maxiters);
-        archive >> CHNVP(reltol);
-        archive >> CHNVP(abstolS);
-        archive >> CHNVP(abstolL);
-    }
+    virtual void ArchiveIn(ChArchiveIn& archive);
+
+  protected:
+    /// Reset the per-step counters.
+    void ResetCounters();
+
+    /// Return true if the Newton matrix must be updated (i.e., the solver's Setup function called) at the current
+    /// iteration. Set 'step_start' for the first iteration of a step. The step size and problem size are used to detect
+    /// whether a Newton matrix evaluated at a previous step can be reused.
+    bool CheckJacobianUpdate(bool step_start, double h, unsigned int size);
+
+    /// Update counters and convergence rate estimate after a Newton iteration.
+    /// Set 'first_iter' for the first iteration of the Newton process (at the current step or step re-attempt).
+    void RecordIteration(bool first_iter, bool setup_called, double correction_norm);
+
+    /// Return true if the current step must be re-attempted with a new Newton matrix, i.e. if the Newton iteration did
+    /// not converge and was started with a Newton matrix evaluated at a previous step.
+    bool RetryStep(bool converged);
+
+    /// Force a Newton matrix update at the next iteration (e.g., if the Newton iteration failed).
+    void InvalidateJacobian() { jacobian_current = false; }
 };
 
 /// Euler explicit timestepper.
@@ -448,6 +523,101 @@ class ChApi ChTimestepperLeapfrog : public ChTimestepperIIorder, public ChExplic
     virtual void ArchiveIn(ChArchiveIn& archive) override;
 };
 
+/// Explicit central difference timestepper with lumped mass, for structural (FEA) dynamics.
+/// This integrator implements the central difference scheme in its velocity form:
+///    v_half = v + a * dt/2
+///    x_new  = x + v_half * dt
+///    a_new  = Md^-1 * F(x_new, v_half)
+///    v_new  = v_half + a_new * dt/2
+/// The acceleration at the beginning of the step is recomputed at each step, so that changes of the state, applied
+/// forces or contacts between steps are accounted for; with EnableAccelerationReuse, the acceleration from the end of
+/// the previous step is reused instead, and a single force evaluation per step is needed. The diagonal (lumped) mass
+/// matrix Md is computed once and reused until the number of coordinates changes or ResetLumpedMass() is called, so
+/// that no linear system is ever solved.
+/// Constraints are enforced by projection (see ChIntegrableIIorder::StateProjectLumped); if some of the constraints do
+/// not support projection, all constraints are enforced with the penalty parameters of ChExplicitTimestepper.
+/// If all constraints (if any) are enforced by projection, ChSystem does not update its system descriptor during the
+/// step, since it is not used by this integrator.
+/// The method is only conditionally stable. If automatic substepping is enabled, each step is split in substeps
+/// smaller than the estimated critical time step (see ChIntegrableIIorder::EstimateCriticalTimeStep).
+class ChApi ChTimestepperCentralDifference : public ChTimestepperIIorder, public ChExplicitTimestepper {
+  protected:
+    ChVectorDynamic<> Md;  ///< cached diagonal of the lumped mass matrix
+    ChVectorDynamic<> R;   ///< force residual
+    ChVectorDynamic<> Qc;  ///< constraint residual (penalty method only)
+    ChState Xlast;         ///< state at the end of the last step (acceleration reuse only)
+    ChStateDelta Vlast;    ///< velocities at the end of the last step (acceleration reuse only)
+    double Tlast;          ///< time at the end of the last step (acceleration reuse only)
+
+    bool mass_current;          ///< true if the cached lumped mass is valid
+    bool acc_current;           ///< true if A holds the acceleration at the end of the last step
+    bool acc_reuse;             ///< reuse the acceleration of the last step as initial acceleration
+    bool projection;            ///< enforce constraints by projection if possible
+    bool auto_substeps;         ///< split steps larger than the critical time step
+    double safety_factor;       ///< fraction of the critical time step used with automatic substepping
+    double critical_dt;         ///< critical time step estimated at the last update of the lumped mass
+    unsigned int num_substeps;  ///< number of substeps taken in the last step
+
+  public:
+    /// Constructor. Diagonal lumping is always used by this integrator.
+    /// If turned off with SetDiagonalLumpingOFF, the default lumping parameters are restored at the next step.
+    ChTimestepperCentralDifference(ChIntegrableIIorder* intgr = nullptr);
+
+    virtual Type GetType() const override { return Type::CENTRAL_DIFFERENCE; }
+
+    /// Enable/disable enforcing the constraints by projection (default: true).
+    /// If disabled, or if some constraints do not support projection, the penalty method is used.
+    void EnableConstraintProjection(bool val) { projection = val; }
+
+    /// Return true if constraints are enforced by projection when possible.
+    bool IsConstraintProjectionEnabled() const { return projection; }
+
+    /// Enable/disable reusing the acceleration computed at the end of a step as initial acceleration of the next step
+    /// (default: false). This saves one force evaluation per step, but it is only valid if the applied forces and the
+    /// contacts do not change between steps. The acceleration is always recomputed if the state or time were modified
+    /// after the last step. If disabled, the acceleration is recomputed at the beginning of each step.
+    void EnableAccelerationReuse(bool val) { acc_reuse = val; }
+
+    /// Enable/disable automatic substepping (default: false).
+    /// If enabled, each step is split in the smallest number of equal substeps not larger than the critical time step
+    /// scaled by the given safety factor. The critical time step is estimated every time the lumped mass is updated.
+    void EnableAutomaticSubsteps(bool val, double safety = 0.9) {
+        auto_substeps = val;
+        safety_factor = safety;
+        mass_current = false;
+    }
+
+    /// Force an update of the lumped mass (and of the critical time step estimate) at the next step.
+    /// Call this function if masses change during the simulation (e.g., if mesh mass scaling is modified).
+    void ResetLumpedMass() { mass_current = false; }
+
+    /// Get the critical time step estimated at the last update of the lumped mass.
+    /// Only available if automatic substepping is enabled (infinity otherwise or if no estimate is available).
+    double GetCriticalTimeStep() const { return critical_dt; }
+
+    /// Get the number of substeps taken during the last step.
+    unsigned int GetNumSubsteps() const { return num_substeps; }
+
+    /// Performs an integration timestep
+    virtual void Advance(const double dt  ///< timestep to advance
+                         ) override;
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& archive) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& archive) override;
+
+  private:
+    /// Compute the lumped mass and, if needed, the critical time step.
+    /// The forces must have been evaluated at the current state, since element stiffness used for the critical time
+    /// step estimate (and for mass scaling) may be updated only during the internal force evaluation.
+    void UpdateLumpedMass();
+
+    /// Compute the acceleration A at the current (scattered) state, using penalty for the constraints if needed.
+    void ComputeAcceleration(bool penalty);
+};
+
 /// Performs a step of Euler implicit for II order systems.
 class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
   protected:
@@ -637,14 +807,13 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     ChVectorDynamic<> R;
     ChVectorDynamic<> Rold;
     ChVectorDynamic<> Qc;
-    bool modified_Newton;
 
   public:
     /// Constructors (default empty)
     ChTimestepperNewmark(ChIntegrableIIorder* intgr = nullptr)
         : ChTimestepperIIorder(intgr), ChImplicitIterativeTimestepper() {
         SetGammaBeta(0.6, 0.3);  // default values with some damping, and that works also with DAE constraints
-        modified_Newton = true;  // default use modified Newton with jacobian factorization only at beginning
+        jacobian_update = JacobianUpdate::EVERY_STEP;  // default use modified Newton
     }
 
     virtual Type GetType() const override { return Type::NEWMARK; }
@@ -667,7 +836,10 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once per step.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
     /// Modified Newton iteration is enabled by default.
-    void SetModifiedNewton(bool val) { modified_Newton = val; }
+    /// This is a shortcut for SetJacobianUpdateMethod with EVERY_STEP or EVERY_ITERATION, respectively.
+    void SetModifiedNewton(bool val) {
+        SetJacobianUpdateMethod(val ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION);
+    }
 
     /// Performs an integration timestep
     virtual void Advance(const double dt  ///< timestep to advance
@@ -33,9 +33,9 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       step_decrease_factor(0.5),
       h_min(1e-10),
       h(1e6),
-      num_successful_steps(0),
-      modified_Newton(true) {
-    SetAlpha(-0.2);  // default: some dissipation
+      num_successful_steps(0) {
+    SetAlpha(-0.2);                                // default: some dissipation
+    jacobian_update = JacobianUpdate::EVERY_STEP;  // default: modified Newton
 }
 
 void ChTimestepperHHT::SetAlpha(double val) {
@@ -75,9 +75,7 @@ void ChTimestepperHHT::Advance(const double dt) {
 
     // Advance solution to time T+dt, possibly taking multiple steps
     double tfinal = T + dt;  // target final time
-    numiters = 0;            // total number of NR iterations for this step
-    numsetups = 0;
-    numsolves = 0;
+    ResetCounters();  // NR iterations and solver calls for this step
 
     // If we had a streak of successful steps, consider a stepsize increase.
     // Note that we never attempt a step larger than the specified dt value.
@@ -102,9 +100,11 @@ void ChTimestepperHHT::Advance(const double dt) {
     //   - at the beginning of a step
     //   - on a stepsize decrease
     //   - if the Newton iteration does not converge with an out-of-date matrix
+    // With automatic Jacobian update, the matrix from a previous step is reused unless a stepsize change occurs or the
+    // Newton iteration converges too slowly; if the Newton iteration does not converge with it, the step is re-attempted
+    // with an updated matrix.
     // Otherwise, the matrix is updated at each iteration.
-    matrix_is_current = false;
-    call_setup = true;
+    unsigned int size = mintegrable->GetNumCoordsVelLevel() + mintegrable->GetNumConstraints();
 
     // Loop until reaching final time
     while (true) {
@@ -117,21 +117,16 @@ void ChTimestepperHHT::Advance(const double dt) {
         unsigned int it;
 
         for (it = 0; it < maxiters; it++) {
-            if (verbose && modified_Newton && call_setup)
+            call_setup = CheckJacobianUpdate(numiters == 0, h, size);
+
+            if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
                 std::cout << " HHT call Setup." << std::endl;
 
             // Solve linear system and increment state
             Increment(mintegrable);
 
-            // Increment counters
-            numiters++;
-            numsolves++;
-            if (call_setup) {
-                numsetups++;
-            }
-
-            // If using modified Newton, do not call Setup again
-            call_setup = !modified_Newton;
+            // Increment counters and update convergence rate estimate
+            RecordIteration(it == 0, call_setup, Da.norm());
 
             // Check convergence
             converged = CheckConvergence(it);
@@ -166,20 +161,16 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-            /*
-            } else if (!matrix_is_current) {
-                // ------ NR did not converge but the matrix was out-of-date
+        } else if (RetryStep(converged)) {
+            // ------ NR did not converge but the matrix was out-of-date
 
-                // reset the count of successive successful steps
-                num_successful_steps = 0;
-
-                // re-attempt step with updated matrix
-                if (verbose) {
-                    std::cout << " HHT re-attempt step with updated matrix." << std::endl;
-                }
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
 
-                call_setup = true;
-            */
+            // re-attempt step with updated matrix
+            if (verbose) {
+                std::cout << " HHT re-attempt step with updated matrix." << std::endl;
+            }
 
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
@@ -187,6 +178,9 @@ void ChTimestepperHHT::Advance(const double dt) {
             // reset the count of successive successful steps
             num_successful_steps = 0;
 
+            // do not reuse the Newton matrix
+            InvalidateJacobian();
+
             // accept solution as is and complete step
             if (verbose) {
                 std::cout << " HHT NR terminated.";
@@ -219,7 +213,7 @@ void ChTimestepperHHT::Advance(const double dt) {
             }
 
             // force a matrix re-evaluation (due to change in stepsize)
-            call_setup = true;
+            InvalidateJacobian();
         }
 
         if (T >= tfinal) {
@@ -306,9 +300,6 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable) {
     Anew += Da;
     Xnew = X + V * h + A * (h * h * (0.5 - beta)) + Anew * (h * h * beta);
     Vnew = V + A * (h * (1.0 - gamma)) + Anew * (h * gamma);
-
-    // If Setup was called at this iteration, mark the Newton matrix as up-to-date
-    matrix_is_current = call_setup;
 }
 
 // Convergence test
@@ -213,6 +213,7 @@ struct host_container {
 
     // Contact shear history (SMC)
     custom_vector<vec3> shear_neigh;          ///< Neighbor list of contacting bodies and shapes
+    custom_vector<int> shear_face;            ///< Mesh face for each neighbor (-1 if no triangle mesh involved)
     custom_vector<real3> shear_disp;          ///< Accumulated shear displacement for each neighbor
     custom_vector<real> contact_relvel_init;  ///< Initial relative normal velocity manitude per contact pair
     custom_vector<real> contact_duration;     ///< Accumulated contact duration, per contact pair
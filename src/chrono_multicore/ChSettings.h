@@ -42,6 +42,8 @@ class collision_settings {
           bins_per_axis(vec3(10, 10, 10)),
           bin_size(real3(1, 1, 1)),
           grid_density(5),
+          large_shape_bins(64),
+          broadphase_incremental(false),
           broadphase_grid(ChBroadphase::GridType::FIXED_RESOLUTION),
           narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID) {}
 
@@ -76,9 +78,17 @@ class collision_settings {
     real3 bin_size;
 
     /// Broadphase collision grid density. This value is used for dynamic tuning of the number of collision bins if the
-    /// `broadphase_grid` type is set to FIXED_DENSITY.
+    /// `broadphase_grid` type is set to FIXED_DENSITY or TWO_LEVEL.
     real grid_density;
 
+    /// Maximum number of bins spanned by a shape inserted in the broadphase grid. Larger shapes are tested directly
+    /// against all other shapes. This value is used only if the `broadphase_grid` type is set to TWO_LEVEL.
+    uint large_shape_bins;
+
+    /// Enable incremental broadphase, reusing the grid and the candidate pairs of unmodified bins from the previous
+    /// step (default: false).
+    bool broadphase_incremental;
+
     /// Algorithm for narrowphase collision detection phase.
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
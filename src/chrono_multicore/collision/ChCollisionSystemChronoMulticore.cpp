@@ -74,6 +74,8 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     broadphase.grid_resolution = settings.bins_per_axis;
     broadphase.bin_size = settings.bin_size;
     broadphase.grid_density = settings.grid_density;
+    broadphase.large_shape_bins = settings.large_shape_bins;
+    broadphase.incremental = settings.broadphase_incremental;
     narrowphase.algorithm = settings.narrowphase_algorithm;
 }
 
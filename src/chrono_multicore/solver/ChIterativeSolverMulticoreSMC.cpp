@@ -54,6 +54,7 @@ void function_CalcContactForces(
     int index,                                            // index of this contact pair
     vec2* body_pairs,                                     // indices of the body pair in contact
     vec2* shape_pairs,                                    // indices of the shape pair in contact
+    int* shape_faces,                                     // mesh face in contact (-1 if no triangle mesh involved)
     ChSystemSMC::ContactForceModel contact_model,         // contact force model
     ChSystemSMC::AdhesionForceModel adhesion_model,       // adhesion force model
     ChSystemSMC::TangentialDisplacementModel displ_mode,  // type of tangential displacement history
@@ -78,6 +79,7 @@ void function_CalcContactForces(
     real* depth,                                          // penetration depth (per contact)
     real* eff_radius,                                     // effective contact radius (per contact)
     vec3* shear_neigh,                                    // neighbor list of contacting bodies and shapes (per body)
+    int* shear_face,                                      // mesh face for each neighbor (per body)
     char* shear_touch,                                    // flag if contact in neighbor list is persistent (per body)
     real3* shear_disp,                                    // accumulated shear displacement for each neighbor (per body)
     real* contact_relvel_init,                            // initial relative normal velocity per contact pair
@@ -178,6 +180,7 @@ void function_CalcContactForces(
     int shear_body2;
     int shear_shape1;
     int shear_shape2;
+    int shear_face1;
     bool newcontact = true;
 
     if (displ_mode == ChSystemSMC::TangentialDisplacementModel::OneStep) {
@@ -185,9 +188,11 @@ void function_CalcContactForces(
     } else if (displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
         delta_t = relvel_t * dT;
 
-        // Identify the two shapes in contact (global shape IDs).
+        // Identify the two shapes in contact (global shape IDs). For a triangle mesh shape, contacts with different
+        // faces have separate contact histories.
         int s1 = shape_pairs[index].x;
         int s2 = shape_pairs[index].y;
+        shear_face1 = shape_faces[index];
 
         // Contact history information stored on the body with the smaller shape or else the body with larger index.
         // Currently, it is assumed that the smaller shape is on the body with larger ID. We call this body shear_body1.
@@ -200,7 +205,7 @@ void function_CalcContactForces(
         for (i = 0; i < max_shear; i++) {
             int ctIdUnrolled = max_shear * shear_body1 + i;
             if (shear_neigh[ctIdUnrolled].x == shear_body2 && shear_neigh[ctIdUnrolled].y == shear_shape1 &&
-                shear_neigh[ctIdUnrolled].z == shear_shape2) {
+                shear_neigh[ctIdUnrolled].z == shear_shape2 && shear_face[ctIdUnrolled] == shear_face1) {
                 contact_duration[ctIdUnrolled] += dT;
                 contact_id = i;
                 newcontact = false;
@@ -215,6 +220,7 @@ void function_CalcContactForces(
                     shear_neigh[ctIdUnrolled].x = shear_body2;
                     shear_neigh[ctIdUnrolled].y = shear_shape1;
                     shear_neigh[ctIdUnrolled].z = shear_shape2;
+                    shear_face[ctIdUnrolled] = shear_face1;
                     shear_disp[ctIdUnrolled].x = 0;
                     shear_disp[ctIdUnrolled].y = 0;
                     shear_disp[ctIdUnrolled].z = 0;
@@ -563,6 +569,7 @@ void ChIterativeSolverMulticoreSMC::host_CalcContactForces(custom_vector<int>& c
             index,                                                  // index of this contact pair
             data_manager->cd_data->bids_rigid_rigid.data(),         // indices of the body pair in contact
             shape_pairs.data(),                                     // indices of the shape pair in contact
+            data_manager->cd_data->contact_faceIDs.data(),          // mesh face in contact (-1 if no mesh involved)
             data_manager->settings.solver.contact_force_model,      // contact force model
             data_manager->settings.solver.adhesion_force_model,     // adhesion force model
             data_manager->settings.solver.tangential_displ_mode,    // type of tangential displacement history
@@ -587,6 +594,7 @@ void ChIterativeSolverMulticoreSMC::host_CalcContactForces(custom_vector<int>& c
             data_manager->cd_data->dpth_rigid_rigid.data(),         // penetration depth (per contact)
             data_manager->cd_data->erad_rigid_rigid.data(),         // effective contact radius (per contact)
             data_manager->host_data.shear_neigh.data(),  // neighbor list of contacting bodies and shapes (per body)
+            data_manager->host_data.shear_face.data(),   // mesh face for each neighbor (per body)
             shear_touch.data(),                          // flag if contact in neighbor list is persistent (per body)
             data_manager->host_data.shear_disp.data(),   // accumulated shear displacement for each neighbor (per body)
             data_manager->host_data.contact_relvel_init.data(),  // initial relative normal velocity per contact pair
@@ -52,6 +52,19 @@ bool ChSolverMumps::FactorizeMatrix() {
     return (mumps_err == 0);
 }
 
+bool ChSolverMumps::AnalyzeMatrix() {
+    m_engine.SetMatrix(m_mat);
+    auto mumps_err = m_engine.MumpsCall(ChMumpsEngine::mumps_JOB::ANALYZE);
+    return (mumps_err == 0);
+}
+
+bool ChSolverMumps::FactorizeMatrixNumeric() {
+    // the sparsity pattern is unchanged since the last analysis; only update the matrix values
+    m_engine.SetMatrix(m_mat);
+    auto mumps_err = m_engine.MumpsCall(ChMumpsEngine::mumps_JOB::FACTORIZE);
+    return (mumps_err == 0);
+}
+
 bool ChSolverMumps::SolveSystem() {
     m_sol = m_rhs;
     m_engine.SetRhsVector(m_sol);
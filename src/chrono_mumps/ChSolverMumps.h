@@ -70,6 +70,12 @@ class ChApiMumps ChSolverMumps : public ChDirectSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Perform the symbolic analysis of the current sparse matrix.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Numerically factorize the current sparse matrix, reusing the last symbolic analysis.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
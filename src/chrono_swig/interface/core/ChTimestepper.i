@@ -79,6 +79,7 @@ using namespace chrono;
 %shared_ptr(chrono::ChTimestepperRungeKuttaExpl)
 %shared_ptr(chrono::ChTimestepperHeun)
 %shared_ptr(chrono::ChTimestepperLeapfrog)
+%shared_ptr(chrono::ChTimestepperCentralDifference)
 %shared_ptr(chrono::ChTimestepperEulerImplicit)
 %shared_ptr(chrono::ChTimestepperEulerImplicitLinearized)
 %shared_ptr(chrono::ChTimestepperEulerImplicitProjected)
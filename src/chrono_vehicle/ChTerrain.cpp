@@ -42,5 +42,22 @@ void ChTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector3d&
     friction = GetCoefficientFriction(loc);
 }
 
+void ChTerrain::GetHeightBatch(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const {
+    heights.resize(locs.size());
+    for (size_t k = 0; k < locs.size(); k++)
+        heights[k] = GetHeight(locs[k]);
+}
+
+void ChTerrain::GetPropertiesBatch(const std::vector<ChVector3d>& locs,
+                                   std::vector<double>& heights,
+                                   std::vector<ChVector3d>& normals,
+                                   std::vector<float>& frictions) const {
+    heights.resize(locs.size());
+    normals.resize(locs.size());
+    frictions.resize(locs.size());
+    for (size_t k = 0; k < locs.size(); k++)
+        GetProperties(locs[k], heights[k], normals[k], frictions[k]);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
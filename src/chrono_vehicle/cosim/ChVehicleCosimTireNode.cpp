@@ -256,6 +256,7 @@ void ChVehicleCosimTireNode::InitializeSystem() {
         }
         case ChSolver::Type::PSOR:
         case ChSolver::Type::PSSOR:
+        case ChSolver::Type::PSOR_COLORED:
         case ChSolver::Type::PJACOBI:
         case ChSolver::Type::PMINRES:
         case ChSolver::Type::BARZILAIBORWEIN:
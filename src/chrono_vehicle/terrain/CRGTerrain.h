@@ -93,6 +93,21 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value specified at construction.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    /// Get all terrain characteristics at the point below the specified location.
+    /// The height at the query location is evaluated only once and reused for the normal calculation.
+    virtual void GetProperties(const ChVector3d& loc,
+                               double& height,
+                               ChVector3d& normal,
+                               float& friction) const override;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// Queries are evaluated sequentially (the OpenCRG contact point is not thread safe), in the given order. Listing
+    /// nearby locations consecutively allows OpenCRG to reuse its search history in the xy -> uv transformation.
+    virtual void GetPropertiesBatch(const std::vector<ChVector3d>& locs,
+                                    std::vector<double>& heights,
+                                    std::vector<ChVector3d>& normals,
+                                    std::vector<float>& frictions) const override;
+
     /// Get the road center line as a Bezier curve.
     std::shared_ptr<ChBezierCurve> GetRoadCenterLine();
 
@@ -179,6 +194,9 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     double m_vinc, m_vbeg, m_vend;  // increment, begin , end of lateral road coordinates
 
     std::vector<double> m_v;  // vector with distinct v values, if m_vinc <= 0.01 m
+
+    /// Estimate the terrain normal at the specified location, given the terrain height at that location.
+    ChVector3d CalcNormal(const ChVector3d& loc, double height) const;
 };
 
 /// @} vehicle_terrain
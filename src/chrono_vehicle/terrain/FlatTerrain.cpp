@@ -36,5 +36,30 @@ float FlatTerrain::GetCoefficientFriction(const ChVector3d& loc) const {
     return m_friction_fun ? (*m_friction_fun)(loc) : m_friction;
 }
 
+void FlatTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector3d& normal, float& friction) const {
+    height = m_height;
+    normal = ChWorldFrame::Vertical();
+    friction = m_friction_fun ? (*m_friction_fun)(loc) : m_friction;
+}
+
+void FlatTerrain::GetHeightBatch(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const {
+    heights.assign(locs.size(), m_height);
+}
+
+void FlatTerrain::GetPropertiesBatch(const std::vector<ChVector3d>& locs,
+                                     std::vector<double>& heights,
+                                     std::vector<ChVector3d>& normals,
+                                     std::vector<float>& frictions) const {
+    heights.assign(locs.size(), m_height);
+    normals.assign(locs.size(), ChWorldFrame::Vertical());
+    if (!m_friction_fun) {
+        frictions.assign(locs.size(), m_friction);
+        return;
+    }
+    frictions.resize(locs.size());
+    for (size_t k = 0; k < locs.size(); k++)
+        frictions[k] = (*m_friction_fun)(locs[k]);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
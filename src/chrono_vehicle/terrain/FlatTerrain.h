@@ -57,6 +57,21 @@ class CH_VEHICLE_API FlatTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value specified at construction.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    /// Get all terrain characteristics at the point below the specified location.
+    virtual void GetProperties(const ChVector3d& loc,
+                               double& height,
+                               ChVector3d& normal,
+                               float& friction) const override;
+
+    /// Get the terrain heights below the specified locations.
+    virtual void GetHeightBatch(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const override;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    virtual void GetPropertiesBatch(const std::vector<ChVector3d>& locs,
+                                    std::vector<double>& heights,
+                                    std::vector<ChVector3d>& normals,
+                                    std::vector<float>& frictions) const override;
+
   private:
     double m_height;   ///< terrain height
     float m_friction;  ///< contact coefficient of friction
@@ -50,6 +50,7 @@ RigidTerrain::RigidTerrain(ChSystem* system)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_mesh_index(false),
       m_contact_callback(nullptr),
       m_collision_family(14),
       m_initialized(false) {}
@@ -61,6 +62,7 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_mesh_index(false),
       m_contact_callback(nullptr),
       m_collision_family(14),
       m_initialized(false) {
@@ -182,6 +184,10 @@ void RigidTerrain::InitializePatch(std::shared_ptr<Patch> patch) {
     // All patches are added to the same collision family and collision with other models in this family is disabled
     patch->m_body->GetCollisionModel()->SetFamily(m_collision_family);
     patch->m_body->GetCollisionModel()->DisallowCollisionsWith(m_collision_family);
+
+    // Build the query index for patches represented as meshes (if requested)
+    if (m_use_mesh_index && patch->m_type != PatchType::BOX)
+        std::static_pointer_cast<MeshPatch>(patch)->BuildQueryIndex();
 }
 
 // -----------------------------------------------------------------------------
@@ -1075,6 +1081,78 @@ void RigidTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector
         friction = (*m_friction_fun)(loc);
 }
 
+int RigidTerrain::GetNumQueryThreads() const {
+    // Mesh patches without a query index are intersected with a ray cast against the patch collision model, for which
+    // the collision system does not guarantee thread safety (batched ray casts cannot be restricted to a given model).
+    // Evaluate in parallel only if all mesh patches have a query index.
+    for (const auto& patch : m_patches) {
+        if (patch->m_type != PatchType::BOX && std::static_pointer_cast<MeshPatch>(patch)->m_index_start.empty())
+            return 1;
+    }
+    return m_system->GetNumThreadsChrono();
+}
+
+void RigidTerrain::GetHeightBatch(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const {
+    int num_locs = (int)locs.size();
+    heights.resize(num_locs);
+
+    if (m_height_fun) {
+        for (int k = 0; k < num_locs; k++)
+            heights[k] = (*m_height_fun)(locs[k]);
+        return;
+    }
+
+    int nthreads = GetNumQueryThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int k = 0; k < num_locs; k++) {
+        ChVector3d normal;
+        float friction;
+        bool hit = FindPoint(locs[k], heights[k], normal, friction);
+        if (!hit)
+            heights[k] = 0;
+    }
+}
+
+void RigidTerrain::GetPropertiesBatch(const std::vector<ChVector3d>& locs,
+                                      std::vector<double>& heights,
+                                      std::vector<ChVector3d>& normals,
+                                      std::vector<float>& frictions) const {
+    int num_locs = (int)locs.size();
+    heights.resize(num_locs);
+    normals.resize(num_locs);
+    frictions.resize(num_locs);
+
+    if (!(m_height_fun && m_normal_fun && m_friction_fun)) {
+        int nthreads = GetNumQueryThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+        for (int k = 0; k < num_locs; k++) {
+            bool hit = FindPoint(locs[k], heights[k], normals[k], frictions[k]);
+            if (!hit) {
+                heights[k] = 0;
+                normals[k] = ChWorldFrame::Vertical();
+                frictions[k] = 0.8f;
+            }
+        }
+    }
+
+    if (m_height_fun) {
+        for (int k = 0; k < num_locs; k++)
+            heights[k] = (*m_height_fun)(locs[k]);
+    }
+
+    if (m_normal_fun) {
+        for (int k = 0; k < num_locs; k++)
+            normals[k] = (*m_normal_fun)(locs[k]);
+    }
+
+    if (m_friction_fun) {
+        for (int k = 0; k < num_locs; k++)
+            frictions[k] = (*m_friction_fun)(locs[k]);
+    }
+}
+
 bool RigidTerrain::FindPoint(const ChVector3d loc, double& height, ChVector3d& normal, float& friction) const {
     bool hit = false;
     height = std::numeric_limits<double>::lowest();
@@ -1113,6 +1191,9 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector3d& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    if (!m_index_start.empty())
+        return FindPointIndexed(loc, height, normal);
+
     ChVector3d from = loc;
     ChVector3d to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -1124,6 +1205,146 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, C
     return result.hit;
 }
 
+// -----------------------------------------------------------------------------
+// Query index for mesh patches
+// -----------------------------------------------------------------------------
+
+void RigidTerrain::MeshPatch::BuildQueryIndex() {
+    const auto& vertices = m_trimesh->GetCoordsVertices();
+    const auto& faces = m_trimesh->GetIndicesVertexes();
+    int num_faces = (int)faces.size();
+
+    m_index_vertices.clear();
+    m_index_normals.clear();
+    m_index_start.clear();
+    m_index_faces.clear();
+    if (num_faces == 0)
+        return;
+
+    // Mesh vertices, expressed in the ISO frame, and their horizontal extent
+    std::vector<ChVector3d> verts(vertices.size());
+    double xmin = std::numeric_limits<double>::max();
+    double ymin = std::numeric_limits<double>::max();
+    double xmax = std::numeric_limits<double>::lowest();
+    double ymax = std::numeric_limits<double>::lowest();
+    for (size_t i = 0; i < vertices.size(); i++) {
+        verts[i] = ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(vertices[i]));
+        xmin = std::min(xmin, verts[i].x());
+        ymin = std::min(ymin, verts[i].y());
+        xmax = std::max(xmax, verts[i].x());
+        ymax = std::max(ymax, verts[i].y());
+    }
+
+    // Grid cell size, such that there are on average a couple of faces per cell
+    double lx = xmax - xmin;
+    double ly = ymax - ymin;
+    double delta = std::sqrt(2 * lx * ly / num_faces);
+    if (delta <= 0)
+        delta = std::max(std::max(lx, ly), 1.0);
+    m_index_nx = std::max(1, (int)std::ceil(lx / delta));
+    m_index_ny = std::max(1, (int)std::ceil(ly / delta));
+    m_index_min[0] = xmin;
+    m_index_min[1] = ymin;
+    m_index_delta_inv = 1 / delta;
+
+    // Cache triangle vertices and upward face normals
+    m_index_vertices.resize(3 * num_faces);
+    m_index_normals.resize(num_faces);
+    for (int f = 0; f < num_faces; f++) {
+        const auto& v0 = verts[faces[f][0]];
+        const auto& v1 = verts[faces[f][1]];
+        const auto& v2 = verts[faces[f][2]];
+        m_index_vertices[3 * f + 0] = v0;
+        m_index_vertices[3 * f + 1] = v1;
+        m_index_vertices[3 * f + 2] = v2;
+        ChVector3d n = Vcross(v1 - v0, v2 - v0);
+        if (n.z() < 0)
+            n = -n;
+        m_index_normals[f] = n.GetNormalized();
+    }
+
+    // Range of grid cells overlapped by the bounding box of a face
+    auto face_cells = [&](int f, int& i0, int& i1, int& j0, int& j1) {
+        const auto& v0 = m_index_vertices[3 * f + 0];
+        const auto& v1 = m_index_vertices[3 * f + 1];
+        const auto& v2 = m_index_vertices[3 * f + 2];
+        double x0 = std::min(std::min(v0.x(), v1.x()), v2.x());
+        double x1 = std::max(std::max(v0.x(), v1.x()), v2.x());
+        double y0 = std::min(std::min(v0.y(), v1.y()), v2.y());
+        double y1 = std::max(std::max(v0.y(), v1.y()), v2.y());
+        i0 = std::max(0, (int)std::floor((x0 - xmin) * m_index_delta_inv) - 1);
+        i1 = std::min(m_index_nx - 1, (int)std::floor((x1 - xmin) * m_index_delta_inv) + 1);
+        j0 = std::max(0, (int)std::floor((y0 - ymin) * m_index_delta_inv) - 1);
+        j1 = std::min(m_index_ny - 1, (int)std::floor((y1 - ymin) * m_index_delta_inv) + 1);
+    };
+
+    // Count faces in each cell, then fill the face lists (compressed row storage).
+    // Cell ranges are padded by one cell to account for round-off in the point-in-triangle tests.
+    int i0, i1, j0, j1;
+    m_index_start.assign(m_index_nx * m_index_ny + 1, 0);
+    for (int f = 0; f < num_faces; f++) {
+        face_cells(f, i0, i1, j0, j1);
+        for (int j = j0; j <= j1; j++)
+            for (int i = i0; i <= i1; i++)
+                m_index_start[j * m_index_nx + i + 1]++;
+    }
+    for (int c = 0; c < m_index_nx * m_index_ny; c++)
+        m_index_start[c + 1] += m_index_start[c];
+
+    std::vector<int> fill(m_index_start.begin(), m_index_start.end() - 1);
+    m_index_faces.resize(m_index_start.back());
+    for (int f = 0; f < num_faces; f++) {
+        face_cells(f, i0, i1, j0, j1);
+        for (int j = j0; j <= j1; j++)
+            for (int i = i0; i <= i1; i++)
+                m_index_faces[fill[j * m_index_nx + i]++] = f;
+    }
+}
+
+bool RigidTerrain::MeshPatch::FindPointIndexed(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    // Query location in ISO frame and corresponding grid cell
+    ChVector3d p = ChWorldFrame::ToISO(loc);
+    int i = (int)std::floor((p.x() - m_index_min[0]) * m_index_delta_inv);
+    int j = (int)std::floor((p.y() - m_index_min[1]) * m_index_delta_inv);
+    if (i < 0 || i >= m_index_nx || j < 0 || j >= m_index_ny)
+        return false;
+
+    // Find the highest triangle below the query location (consistent with casting a vertical ray downward)
+    const double eps = 1e-10;
+    int face = -1;
+    double z_max = std::numeric_limits<double>::lowest();
+    int c = j * m_index_nx + i;
+    for (int k = m_index_start[c]; k < m_index_start[c + 1]; k++) {
+        int f = m_index_faces[k];
+        const auto& a = m_index_vertices[3 * f + 0];
+        const auto& b = m_index_vertices[3 * f + 1];
+        const auto& v = m_index_vertices[3 * f + 2];
+
+        // Barycentric coordinates of the projected query point (skip vertical faces)
+        double det = (b.y() - v.y()) * (a.x() - v.x()) + (v.x() - b.x()) * (a.y() - v.y());
+        if (std::abs(det) < eps * eps)
+            continue;
+        double l1 = ((b.y() - v.y()) * (p.x() - v.x()) + (v.x() - b.x()) * (p.y() - v.y())) / det;
+        double l2 = ((v.y() - a.y()) * (p.x() - v.x()) + (a.x() - v.x()) * (p.y() - v.y())) / det;
+        double l3 = 1 - l1 - l2;
+        if (l1 < -eps || l2 < -eps || l3 < -eps)
+            continue;
+
+        double z = l1 * a.z() + l2 * b.z() + l3 * v.z();
+        if (z <= p.z() && z > z_max) {
+            z_max = z;
+            face = f;
+        }
+    }
+
+    if (face < 0)
+        return false;
+
+    height = z_max;
+    normal = ChWorldFrame::FromISO(m_index_normals[face]);
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
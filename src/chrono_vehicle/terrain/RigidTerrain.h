@@ -184,6 +184,15 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// default, this option is disabled.  This function must be called before Initialize.
     void UseLocationDependentFriction(bool val) { m_use_friction_functor = val; }
 
+    /// Enable use of a precomputed query index for mesh and height-map patches.
+    /// If enabled, a 2D bucket grid of the patch mesh triangles (projected onto the horizontal plane) is built when
+    /// the patch is initialized, and terrain queries (GetHeight, GetNormal, GetProperties) on such patches are answered
+    /// by searching the triangles in the grid cell below the query location, without ray casting into the collision
+    /// system. This is significantly faster for large meshes, at the cost of additional memory. The patch bodies are
+    /// assumed to not move after initialization. By default, this option is disabled. This function must be called
+    /// before Initialize.
+    void UseMeshQueryIndex(bool val) { m_use_mesh_index = val; }
+
     /// Get the terrain height below the specified location.
     /// This function should return the height of the closest point *below* the specified location (in the direction of
     /// the current world vertical). If a user-provided functor object of type ChTerrain::HeightFunctor is provided,
@@ -217,6 +226,20 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
                                ChVector3d& normal,
                                float& friction) const override;
 
+    /// Get the terrain heights below the specified locations.
+    /// Queries are evaluated in parallel under the same conditions as in GetPropertiesBatch. A user-provided height
+    /// functor, if any, is evaluated sequentially.
+    virtual void GetHeightBatch(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const override;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// Ray casting into the terrain contact model is done sequentially. If all mesh patches use a query index (see
+    /// UseMeshQueryIndex), the queries are evaluated in parallel, using the number of threads set for the containing
+    /// Chrono system. User-provided functors, if any, are always evaluated sequentially.
+    virtual void GetPropertiesBatch(const std::vector<ChVector3d>& locs,
+                                    std::vector<double>& heights,
+                                    std::vector<ChVector3d>& normals,
+                                    std::vector<float>& frictions) const override;
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -229,6 +252,10 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// heigh=0, normal=world vertical, and friction=0.8).
     bool FindPoint(const ChVector3d loc, double& height, ChVector3d& normal, float& friction) const;
 
+    /// Return the number of threads for evaluating batched terrain queries.
+    /// Queries are evaluated sequentially unless all mesh patches have a query index.
+    int GetNumQueryThreads() const;
+
     /// Set common collision family for patches. Default: 14.
     /// Collision is disabled with all other objects in this family.
     void SetCollisionFamily(int family) { m_collision_family = family; }
@@ -250,16 +277,33 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         std::shared_ptr<ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                             ///< name of associated mesh
+
+        std::vector<ChVector3d> m_index_vertices;  ///< triangle vertices (ISO frame), 3 per face
+        std::vector<ChVector3d> m_index_normals;   ///< upward face normals (ISO frame)
+        std::vector<int> m_index_start;            ///< start of face list for each grid cell (size nx*ny+1)
+        std::vector<int> m_index_faces;            ///< face indices, grouped by grid cell
+        double m_index_min[2];                     ///< lower-left corner of the index grid (ISO frame)
+        double m_index_delta_inv;                  ///< inverse of the index grid cell size
+        int m_index_nx;                            ///< number of index grid cells in X direction
+        int m_index_ny;                            ///< number of index grid cells in Y direction
+
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
+
+        /// Build the 2D bucket grid of mesh triangles used for terrain queries.
+        void BuildQueryIndex();
+
+        /// Find the terrain point below the specified location using the query index.
+        bool FindPointIndexed(const ChVector3d& loc, double& height, ChVector3d& normal) const;
     };
 
     ChSystem* m_system;
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
+    bool m_use_mesh_index;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
 
     void AddPatch(std::shared_ptr<Patch> patch,
@@ -17,6 +17,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <bitset>
 #include <cstdio>
 #include <cmath>
 #include <queue>
@@ -33,6 +35,7 @@
 #include "chrono/assets/ChTexture.h"
 #include "chrono/assets/ChVisualShapeBox.h"
 #include "chrono/utils/ChConvexHull.h"
+#include "chrono/utils/ChOpenMP.h"
 #include "chrono/utils/ChUtils.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
@@ -83,6 +86,46 @@ float SCMTerrain::GetCoefficientFriction(const ChVector3d& loc) const {
     return m_friction_fun ? (*m_friction_fun)(loc) : 0.8f;
 }
 
+// Get all terrain characteristics at the point below the specified location.
+void SCMTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector3d& normal, float& friction) const {
+    m_loader->GetHeightNormal(loc, height, normal);
+    friction = m_friction_fun ? (*m_friction_fun)(loc) : 0.8f;
+}
+
+// Get the terrain heights below the specified locations.
+void SCMTerrain::GetHeightBatch(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const {
+    int num_locs = (int)locs.size();
+    heights.resize(num_locs);
+
+    // Grid lookups may page tiles in from disk; evaluate in parallel only if all tiles are resident
+    int nthreads = m_loader->m_grid.GetNumPagedTiles() == 0 ? m_loader->GetSystem()->GetNumThreadsChrono() : 1;
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int k = 0; k < num_locs; k++)
+        heights[k] = m_loader->GetHeight(locs[k]);
+}
+
+// Get all terrain characteristics at the points below the specified locations.
+void SCMTerrain::GetPropertiesBatch(const std::vector<ChVector3d>& locs,
+                                    std::vector<double>& heights,
+                                    std::vector<ChVector3d>& normals,
+                                    std::vector<float>& frictions) const {
+    int num_locs = (int)locs.size();
+    heights.resize(num_locs);
+    normals.resize(num_locs);
+    frictions.resize(num_locs);
+
+    // Grid lookups may page tiles in from disk; evaluate in parallel only if all tiles are resident
+    int nthreads = m_loader->m_grid.GetNumPagedTiles() == 0 ? m_loader->GetSystem()->GetNumThreadsChrono() : 1;
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int k = 0; k < num_locs; k++)
+        m_loader->GetHeightNormal(locs[k], heights[k], normals[k]);
+
+    for (int k = 0; k < num_locs; k++)
+        frictions[k] = m_friction_fun ? (*m_friction_fun)(locs[k]) : 0.8f;
+}
+
 // Get SCM information at the node closest to the specified location.
 SCMTerrain::NodeInfo SCMTerrain::GetNodeInfo(const ChVector3d& loc) const {
     return m_loader->GetNodeInfo(loc);
@@ -140,6 +183,17 @@ void SCMTerrain::SetCosimulationMode(bool val) {
     m_loader->m_cosim_mode = val;
 }
 
+// Set the level-of-detail coarsening factor.
+void SCMTerrain::SetLevelOfDetail(int factor) {
+    m_loader->m_lod = std::max(factor, 1);
+}
+
+// Enable paging of the SCM grid to disk.
+void SCMTerrain::EnableTilePaging(const std::string& filename, size_t memory_budget) {
+    size_t max_tiles = memory_budget / SCMLoader::NodeGrid::GetTileMemory();
+    m_loader->m_grid.SetPaging(filename, max_tiles);
+}
+
 // Set properties of the SCM soil model.
 void SCMTerrain::SetSoilParameters(
     double Bekker_Kphi,    // Kphi, frictional modulus in Bekker model
@@ -179,6 +233,10 @@ void SCMTerrain::SetBulldozingParameters(
     m_loader->m_erosion_propagations = erosion_propagations;
 }
 
+void SCMTerrain::EnableParallelErosion(bool val) {
+    m_loader->m_parallel_erosion = val;
+}
+
 void SCMTerrain::SetTestHeight(double offset) {
     m_loader->m_test_offset_up = offset;
 }
@@ -293,6 +351,14 @@ int SCMTerrain::GetNumErosionNodes() const {
     return m_loader->m_num_erosion_nodes;
 }
 
+int SCMTerrain::GetNumResidentTiles() const {
+    return (int)m_loader->m_grid.GetNumResidentTiles();
+}
+
+int SCMTerrain::GetNumPagedTiles() const {
+    return (int)m_loader->m_grid.GetNumPagedTiles();
+}
+
 // Timer information
 double SCMTerrain::GetTimerMovingPatches() const {
     return 1e3 * m_loader->m_timer_moving_patches();
@@ -312,6 +378,15 @@ double SCMTerrain::GetTimerContactForces() const {
 double SCMTerrain::GetTimerBulldozing() const {
     return 1e3 * m_loader->m_timer_bulldozing();
 }
+double SCMTerrain::GetTimerBulldozingBoundary() const {
+    return 1e3 * m_loader->m_timer_bulldozing_boundary();
+}
+double SCMTerrain::GetTimerBulldozingDomain() const {
+    return 1e3 * m_loader->m_timer_bulldozing_domain();
+}
+double SCMTerrain::GetTimerBulldozingErosion() const {
+    return 1e3 * m_loader->m_timer_bulldozing_erosion();
+}
 double SCMTerrain::GetTimerVisUpdate() const {
     return 1e3 * m_loader->m_timer_visualization();
 }
@@ -339,6 +414,8 @@ void SCMTerrain::PrintStepStatistics(std::ostream& os) const {
     os << "   Number ray hits:         " << m_loader->m_num_ray_hits << std::endl;
     os << "   Number contact patches:  " << m_loader->m_num_contact_patches << std::endl;
     os << "   Number erosion nodes:    " << m_loader->m_num_erosion_nodes << std::endl;
+    os << "   Number resident tiles:   " << m_loader->m_grid.GetNumResidentTiles() << std::endl;
+    os << "   Number paged tiles:      " << m_loader->m_grid.GetNumPagedTiles() << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -354,6 +431,281 @@ SCMContactableData::SCMContactableData(double area_ratio,
       Mohr_mu(std::tan(Mohr_friction * CH_DEG_TO_RAD)),
       Janosi_shear(Janosi_shear) {}
 
+// -----------------------------------------------------------------------------
+// Sparse tiled storage of SCM grid node records
+// -----------------------------------------------------------------------------
+
+SCMLoader::NodeGrid::~NodeGrid() {
+    // The paging file only holds data for this grid
+    if (m_file.is_open()) {
+        m_file.close();
+        std::remove(m_filename.c_str());
+    }
+}
+
+SCMLoader::NodeGrid::Tile* SCMLoader::NodeGrid::GetTile(const ChVector2i& tij) {
+    auto t = m_tile_map.find(tij);
+    if (t != m_tile_map.end())
+        return t->second;
+
+    // Page in the tile if it was written to the paging file
+    if (m_num_paged == 0)
+        return nullptr;
+    auto s = m_slots.find(tij);
+    if (s == m_slots.end() || !s->second.paged)
+        return nullptr;
+
+    // Reuse a copy of the tile read by a const query, if any
+    auto c = m_copies.find(tij);
+    if (c != m_copies.end()) {
+        m_tiles.push_back(std::move(c->second));
+        m_copies.erase(c);
+    } else {
+        m_tiles.push_back(std::unique_ptr<Tile>(new Tile));
+        ReadTile(s->second, *m_tiles.back());
+    }
+    Tile* tile = m_tiles.back().get();
+    tile->origin = ChVector2i(tij.x() * TILE_SIZE, tij.y() * TILE_SIZE);
+    tile->last_use = m_stamp;
+    m_tile_map.insert(std::make_pair(tij, tile));
+    s->second.paged = false;
+    m_num_paged--;
+
+    return tile;
+}
+
+SCMLoader::NodeRecord* SCMLoader::NodeGrid::Find(const ChVector2i& ij) {
+    Tile* tile = GetTile(TileCoords(ij));
+    if (!tile)
+        return nullptr;
+    int i = ij.x() - tile->origin.x();
+    int j = ij.y() - tile->origin.y();
+    if (!(tile->mask[j] & (uint32_t(1) << i)))
+        return nullptr;
+    return &tile->records[j * TILE_SIZE + i];
+}
+
+const SCMLoader::NodeRecord* SCMLoader::NodeGrid::Find(const ChVector2i& ij) const {
+    ChVector2i tij = TileCoords(ij);
+    const Tile* tile = nullptr;
+
+    auto t = m_tile_map.find(tij);
+    if (t != m_tile_map.end()) {
+        tile = t->second;
+    } else {
+        // Read a paged-out tile into a temporary copy, leaving the resident tiles untouched
+        if (m_num_paged == 0)
+            return nullptr;
+        auto s = m_slots.find(tij);
+        if (s == m_slots.end() || !s->second.paged)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock(m_copies_mutex);
+        auto& copy = m_copies[tij];
+        if (!copy) {
+            copy = std::unique_ptr<Tile>(new Tile);
+            copy->origin = ChVector2i(tij.x() * TILE_SIZE, tij.y() * TILE_SIZE);
+            ReadTile(s->second, *copy);
+        }
+        tile = copy.get();
+    }
+
+    int i = ij.x() - tile->origin.x();
+    int j = ij.y() - tile->origin.y();
+    if (!(tile->mask[j] & (uint32_t(1) << i)))
+        return nullptr;
+    return &tile->records[j * TILE_SIZE + i];
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::At(const ChVector2i& ij) {
+    NodeRecord* nr = Find(ij);
+    assert(nr);
+    return *nr;
+}
+
+const SCMLoader::NodeRecord& SCMLoader::NodeGrid::At(const ChVector2i& ij) const {
+    const NodeRecord* nr = Find(ij);
+    assert(nr);
+    return *nr;
+}
+
+std::pair<SCMLoader::NodeRecord*, bool> SCMLoader::NodeGrid::Insert(const ChVector2i& ij, const NodeRecord& nr) {
+    ChVector2i tij = TileCoords(ij);
+    Tile* tile = GetTile(tij);
+    if (!tile) {
+        m_tiles.push_back(std::unique_ptr<Tile>(new Tile));
+        tile = m_tiles.back().get();
+        tile->origin = ChVector2i(tij.x() * TILE_SIZE, tij.y() * TILE_SIZE);
+        tile->mask.fill(0);
+        m_tile_map.insert(std::make_pair(tij, tile));
+    }
+    tile->last_use = m_stamp;
+
+    int i = ij.x() - tile->origin.x();
+    int j = ij.y() - tile->origin.y();
+    NodeRecord* rec = &tile->records[j * TILE_SIZE + i];
+    if (tile->mask[j] & (uint32_t(1) << i))
+        return std::make_pair(rec, false);
+
+    tile->mask[j] |= (uint32_t(1) << i);
+    *rec = nr;
+    m_num_nodes++;
+    return std::make_pair(rec, true);
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::Set(const ChVector2i& ij, const NodeRecord& nr) {
+    auto rec = Insert(ij, nr);
+    if (!rec.second)
+        *rec.first = nr;
+    return *rec.first;
+}
+
+void SCMLoader::NodeGrid::Clear() {
+    m_tile_map.clear();
+    m_tiles.clear();
+    m_num_nodes = 0;
+
+    // Discard the content of the paging file
+    m_slots.clear();
+    m_free_slots.clear();
+    m_copies.clear();
+    m_num_paged = 0;
+    if (m_file.is_open())
+        SetPaging(m_filename, m_max_tiles);
+}
+
+void SCMLoader::NodeGrid::SetPaging(const std::string& filename, size_t max_tiles) {
+    // Paged-out tiles must be brought back before switching to a different file
+    if (m_num_paged > 0) {
+        for (auto& slot : m_slots) {
+            if (slot.second.paged)
+                GetTile(slot.first);
+        }
+    }
+
+    if (m_file.is_open()) {
+        m_file.close();
+        if (filename != m_filename)
+            std::remove(m_filename.c_str());
+    }
+    m_file.open(filename, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open()) {
+        std::cerr << "Cannot open SCM paging file " << filename << std::endl;
+        throw std::runtime_error("Cannot open SCM paging file");
+    }
+    m_filename = filename;
+    m_slots.clear();
+    m_free_slots.clear();
+    m_copies.clear();
+    m_max_tiles = std::max(max_tiles, size_t(1));
+}
+
+void SCMLoader::NodeGrid::Prefetch(const ChVector2i& ij_min, const ChVector2i& ij_max) {
+    ChVector2i tij_min = TileCoords(ij_min);
+    ChVector2i tij_max = TileCoords(ij_max);
+    for (int ti = tij_min.x(); ti <= tij_max.x(); ti++) {
+        for (int tj = tij_min.y(); tj <= tij_max.y(); tj++) {
+            if (Tile* tile = GetTile(ChVector2i(ti, tj)))
+                tile->last_use = m_stamp;
+        }
+    }
+}
+
+void SCMLoader::NodeGrid::PageOut() {
+    if (m_file.is_open() && m_tiles.size() > m_max_tiles) {
+        // Order resident tiles from least to most recently used
+        std::vector<Tile*> order(m_tiles.size());
+        for (size_t k = 0; k < m_tiles.size(); k++)
+            order[k] = m_tiles[k].get();
+        std::sort(order.begin(), order.end(), [](const Tile* a, const Tile* b) { return a->last_use < b->last_use; });
+
+        // Write out excess tiles which were not used since last call and remove them from the tile map
+        size_t num_out = m_tiles.size() - m_max_tiles;
+        for (size_t k = 0; k < num_out && order[k]->last_use < m_stamp; k++) {
+            WriteTile(*order[k]);
+            m_tile_map.erase(TileCoords(order[k]->origin));
+        }
+
+        // Release the paged-out tiles
+        m_tiles.erase(std::remove_if(m_tiles.begin(), m_tiles.end(),
+                                     [this](const std::unique_ptr<Tile>& tile) {
+                                         return m_tile_map.find(TileCoords(tile->origin)) == m_tile_map.end();
+                                     }),
+                      m_tiles.end());
+    }
+
+    m_copies.clear();
+    m_stamp++;
+}
+
+SCMLoader::NodeGrid::FileSlot SCMLoader::NodeGrid::AllocateSlot(int count) {
+    // Use the smallest released slot large enough
+    auto best = m_free_slots.end();
+    for (auto f = m_free_slots.begin(); f != m_free_slots.end(); ++f) {
+        if (f->capacity >= count && (best == m_free_slots.end() || f->capacity < best->capacity))
+            best = f;
+    }
+    if (best != m_free_slots.end()) {
+        FileSlot slot = *best;
+        *best = m_free_slots.back();
+        m_free_slots.pop_back();
+        return slot;
+    }
+
+    // Append a new slot at the end of the paging file
+    FileSlot slot;
+    m_file.seekp(0, std::ios::end);
+    slot.offset = m_file.tellp();
+    slot.capacity = count;
+    slot.paged = false;
+    return slot;
+}
+
+void SCMLoader::NodeGrid::WriteTile(const Tile& tile) {
+    int count = 0;
+    for (auto row : tile.mask)
+        count += (int)std::bitset<TILE_SIZE>(row).count();
+
+    // Reuse the tile slot in the paging file if large enough, otherwise release it and allocate a new slot
+    auto& slot = m_slots[TileCoords(tile.origin)];
+    if (slot.capacity == 0 || slot.capacity < count) {
+        if (slot.capacity > 0)
+            m_free_slots.push_back(slot);
+        slot = AllocateSlot(count);
+    }
+    m_file.seekp(slot.offset);
+
+    m_file.write(reinterpret_cast<const char*>(tile.mask.data()), sizeof(tile.mask));
+    for (int j = 0; j < TILE_SIZE; j++) {
+        for (int i = 0; i < TILE_SIZE; i++) {
+            if (tile.mask[j] & (uint32_t(1) << i))
+                m_file.write(reinterpret_cast<const char*>(&tile.records[j * TILE_SIZE + i]), sizeof(NodeRecord));
+        }
+    }
+    if (!m_file) {
+        std::cerr << "Error writing SCM paging file" << std::endl;
+        throw std::runtime_error("Error writing SCM paging file");
+    }
+
+    slot.paged = true;
+    m_num_paged++;
+}
+
+void SCMLoader::NodeGrid::ReadTile(const FileSlot& slot, Tile& tile) const {
+    m_file.seekg(slot.offset);
+    m_file.read(reinterpret_cast<char*>(tile.mask.data()), sizeof(tile.mask));
+    for (int j = 0; j < TILE_SIZE; j++) {
+        for (int i = 0; i < TILE_SIZE; i++) {
+            if (tile.mask[j] & (uint32_t(1) << i))
+                m_file.read(reinterpret_cast<char*>(&tile.records[j * TILE_SIZE + i]), sizeof(NodeRecord));
+        }
+    }
+    if (!m_file) {
+        std::cerr << "Error reading SCM paging file" << std::endl;
+        throw std::runtime_error("Error reading SCM paging file");
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Implementation of SCMLoader
 // -----------------------------------------------------------------------------
@@ -373,12 +725,16 @@ SCMLoader::SCMLoader(ChSystem* system, bool visualization_mesh) : m_soil_fun(nul
     m_plane = ChCoordsys<>(VNULL, QUNIT);
     m_Z = m_plane.rot.GetAxisZ();
 
+    // Single-resolution grid by default
+    m_lod = 1;
+
     // Bulldozing effects
     m_bulldozing = false;
     m_flow_factor = 1.2;
     m_erosion_slope = std::tan(40.0 * CH_DEG_TO_RAD);
     m_erosion_iterations = 3;
     m_erosion_propagations = 10;
+    m_parallel_erosion = true;
 
     // Default soil parameters
     m_Bekker_Kphi = 2e6;
@@ -406,11 +762,13 @@ SCMLoader::SCMLoader(ChSystem* system, bool visualization_mesh) : m_soil_fun(nul
 void SCMLoader::Initialize(double sizeX, double sizeY, double delta) {
     m_type = PatchType::FLAT;
 
-    m_nx = static_cast<int>(std::ceil((sizeX / 2) / delta));  // half number of divisions in X direction
-    m_ny = static_cast<int>(std::ceil((sizeY / 2) / delta));  // number of divisions in Y direction
+    // Half number of divisions in X and Y directions (multiples of the LOD factor)
+    m_nx = m_lod * static_cast<int>(std::ceil((sizeX / 2) / (m_lod * delta)));
+    m_ny = m_lod * static_cast<int>(std::ceil((sizeY / 2) / (m_lod * delta)));
 
     m_delta = sizeX / (2 * m_nx);   // grid spacing
     m_area = std::pow(m_delta, 2);  // area of a cell
+    sizeY = 2 * m_ny * m_delta;     // adjusted terrain dimension in Y direction
 
     // Return now if no visualization
     if (!m_trimesh_shape)
@@ -441,15 +799,18 @@ void SCMLoader::Initialize(const std::string& heightmap_file,
     double dx_img = 1.0 / (nx_img - 1.0);
     double dy_img = 1.0 / (ny_img - 1.0);
 
-    m_nx = static_cast<int>(std::ceil((sizeX / 2) / delta));  // half number of divisions in X direction
-    m_ny = static_cast<int>(std::ceil((sizeY / 2) / delta));  // number of divisions in Y direction
-    int nvx = 2 * m_nx + 1;                                   // number of grid vertices in X direction
-    int nvy = 2 * m_ny + 1;                                   // number of grid vertices in Y direction
-    m_delta = sizeX / (2.0 * m_nx);                           // grid spacing
-    m_area = std::pow(m_delta, 2);                            // area of a cell
+    // Half number of divisions in X and Y directions (multiples of the LOD factor)
+    m_nx = m_lod * static_cast<int>(std::ceil((sizeX / 2) / (m_lod * delta)));
+    m_ny = m_lod * static_cast<int>(std::ceil((sizeY / 2) / (m_lod * delta)));
 
-    double dx_grid = 0.5 / m_nx;
-    double dy_grid = 0.5 / m_ny;
+    int nvx = 2 * (m_nx / m_lod) + 1;  // number of coarse grid vertices in X direction
+    int nvy = 2 * (m_ny / m_lod) + 1;  // number of coarse grid vertices in Y direction
+    m_delta = sizeX / (2.0 * m_nx);    // grid spacing
+    m_area = std::pow(m_delta, 2);     // area of a cell
+    sizeY = 2 * m_ny * m_delta;        // adjusted terrain dimension in Y direction
+
+    double dx_grid = 1.0 / (nvx - 1);
+    double dy_grid = 1.0 / (nvy - 1);
 
     // Resample image and calculate interpolated gray levels and then map it to the height range, with black
     // corresponding to hMin and white corresponding to hMax. Entry (0,0) corresponds to bottom-left grid vertex.
@@ -468,7 +829,7 @@ void SCMLoader::Initialize(const std::string& heightmap_file,
         assert(jx1 <= jx2);
 
         for (int iy = 0; iy < nvy; iy++) {
-            double y = (2 * m_ny - iy) * dy_grid;     // y location in image (in [0,1], 0 at top)
+            double y = (nvy - 1 - iy) * dy_grid;      // y location in image (in [0,1], 0 at top)
             int jy1 = (int)std::floor(y / dy_img);    // Up pixel
             int jy2 = (int)std::ceil(y / dy_img);     // Down pixel
             double ay = (y - jy1 * dy_img) / dy_img;  // Scaled offset from down pixel
@@ -547,15 +908,19 @@ void SCMLoader::Initialize(const ChTriangleMeshConnected& trimesh, double delta)
     auto sizeY = (maxY - minY);
     ChVector3d center((maxX + minX) / 2, (maxY + minY) / 2, 0);
 
-    // Initial grid extent
-    m_nx = static_cast<int>(std::ceil((sizeX / 2) / delta));  // half number of divisions in X direction
-    m_ny = static_cast<int>(std::ceil((sizeY / 2) / delta));  // number of divisions in Y direction
-    m_delta = sizeX / (2.0 * m_nx);                           // grid spacing
-    m_area = std::pow(m_delta, 2);                            // area of a cell
-    int nvx = 2 * m_nx + 1;                                   // number of grid vertices in X direction
-    int nvy = 2 * m_ny + 1;                                   // number of grid vertices in Y direction
-
-    // Loop over all mesh faces, project onto the x-y plane and set the height for all covered grid nodes.
+    // Initial grid extent (half number of divisions are multiples of the LOD factor)
+    m_nx = m_lod * static_cast<int>(std::ceil((sizeX / 2) / (m_lod * delta)));
+    m_ny = m_lod * static_cast<int>(std::ceil((sizeY / 2) / (m_lod * delta)));
+    m_delta = sizeX / (2.0 * m_nx);   // grid spacing
+    m_area = std::pow(m_delta, 2);    // area of a cell
+    sizeY = 2 * m_ny * m_delta;       // adjusted terrain dimension in Y direction
+    int cnx = m_nx / m_lod;           // range for coarse grid indices in X direction: [-cnx, +cnx]
+    int cny = m_ny / m_lod;           // range for coarse grid indices in Y direction: [-cny, +cny]
+    double cdelta = m_lod * m_delta;  // coarse grid spacing
+    int nvx = 2 * cnx + 1;            // number of coarse grid vertices in X direction
+    int nvy = 2 * cny + 1;            // number of coarse grid vertices in Y direction
+
+    // Loop over all mesh faces, project onto the x-y plane and set the height for all covered coarse grid nodes.
     ////m_heights = ChMatrixDynamic<>::Zero(nvx, nvy);
     m_heights = (minZ + m_base_height) * ChMatrixDynamic<>::Ones(nvx, nvy);
 
@@ -570,20 +935,20 @@ void SCMLoader::Initialize(const ChTriangleMeshConnected& trimesh, double delta)
         auto x_max = std::max(std::max(v1.x(), v2.x()), v3.x());
         auto y_min = std::min(std::min(v1.y(), v2.y()), v3.y());
         auto y_max = std::max(std::max(v1.y(), v2.y()), v3.y());
-        int i_min = static_cast<int>(std::floor(x_min / m_delta));
-        int j_min = static_cast<int>(std::floor(y_min / m_delta));
-        int i_max = static_cast<int>(std::ceil(x_max / m_delta));
-        int j_max = static_cast<int>(std::ceil(y_max / m_delta));
-        ChClampValue(i_min, -m_nx, +m_nx);
-        ChClampValue(i_max, -m_nx, +m_nx);
-        ChClampValue(j_min, -m_ny, +m_ny);
-        ChClampValue(j_max, -m_ny, +m_ny);
-        // Loop over all grid nodes within bounds
+        int i_min = static_cast<int>(std::floor(x_min / cdelta));
+        int j_min = static_cast<int>(std::floor(y_min / cdelta));
+        int i_max = static_cast<int>(std::ceil(x_max / cdelta));
+        int j_max = static_cast<int>(std::ceil(y_max / cdelta));
+        ChClampValue(i_min, -cnx, +cnx);
+        ChClampValue(i_max, -cnx, +cnx);
+        ChClampValue(j_min, -cny, +cny);
+        ChClampValue(j_max, -cny, +cny);
+        // Loop over all coarse grid nodes within bounds
         for (int i = i_min; i <= i_max; i++) {
             for (int j = j_min; j <= j_max; j++) {
-                ChVector3d v(i * m_delta, j * m_delta, 0);
+                ChVector3d v(i * cdelta, j * cdelta, 0);
                 if (calcBarycentricCoordinates(v1, v2, v3, v, a1, a2, a3)) {
-                    m_heights(m_nx + i, m_ny + j) = minZ + a1 * v1.z() + a2 * v2.z() + a3 * v3.z();
+                    m_heights(cnx + i, cny + j) = minZ + a1 * v1.z() + a2 * v2.z() + a3 * v3.z();
                     num_h_set++;
                 }
             }
@@ -599,12 +964,15 @@ void SCMLoader::Initialize(const ChTriangleMeshConnected& trimesh, double delta)
 }
 
 void SCMLoader::CreateVisualizationMesh(double sizeX, double sizeY) {
-    int nvx = 2 * m_nx + 1;                     // number of grid vertices in X direction
-    int nvy = 2 * m_ny + 1;                     // number of grid vertices in Y direction
-    int n_verts = nvx * nvy;                    // total number of vertices for initial visualization trimesh
-    int n_faces = 2 * (2 * m_nx) * (2 * m_ny);  // total number of faces for initial visualization trimesh
-    double x_scale = 0.5 / m_nx;                // scale for texture coordinates (U direction)
-    double y_scale = 0.5 / m_ny;                // scale for texture coordinates (V direction)
+    int cnx = m_nx / m_lod;                   // range for coarse grid indices in X direction: [-cnx, +cnx]
+    int cny = m_ny / m_lod;                   // range for coarse grid indices in Y direction: [-cny, +cny]
+    double cdelta = m_lod * m_delta;          // coarse grid spacing
+    int nvx = 2 * cnx + 1;                    // number of coarse grid vertices in X direction
+    int nvy = 2 * cny + 1;                    // number of coarse grid vertices in Y direction
+    int n_verts = nvx * nvy;                  // total number of vertices for initial visualization trimesh
+    int n_faces = 2 * (2 * cnx) * (2 * cny);  // total number of faces for initial visualization trimesh
+    double x_scale = 0.5 / cnx;               // scale for texture coordinates (U direction)
+    double y_scale = 0.5 / cny;               // scale for texture coordinates (V direction)
 
     // Readability aliases
     auto trimesh = m_trimesh_shape->GetMesh();
@@ -624,15 +992,15 @@ void SCMLoader::CreateVisualizationMesh(double sizeX, double sizeY) {
     idx_vertices.resize(n_faces);
     idx_normals.resize(n_faces);
 
-    // Load mesh vertices.
+    // Load mesh vertices (at the coarse grid nodes).
     // We order the vertices starting at the bottom-left corner, row after row.
     // The bottom-left corner corresponds to the point (-sizeX/2, -sizeY/2).
     // UV coordinates are mapped in [0,1] x [0,1]. Use smoothed vertex normals.
     int iv = 0;
     for (int iy = 0; iy < nvy; iy++) {
-        double y = iy * m_delta - 0.5 * sizeY;
+        double y = iy * cdelta - 0.5 * sizeY;
         for (int ix = 0; ix < nvx; ix++) {
-            double x = ix * m_delta - 0.5 * sizeX;
+            double x = ix * cdelta - 0.5 * sizeX;
             if (m_type == PatchType::FLAT) {
                 // Set vertex location
                 vertices[iv] = m_plane * ChVector3d(x, y, 0);
@@ -706,7 +1074,8 @@ void SCMLoader::SetupInitial() {
 }
 
 bool SCMLoader::CheckMeshBounds(const ChVector2i& loc) const {
-    return loc.x() >= -m_nx && loc.x() <= m_nx && loc.y() >= -m_ny && loc.y() <= m_ny;
+    return loc.x() >= -m_nx && loc.x() <= m_nx && loc.y() >= -m_ny && loc.y() <= m_ny &&  //
+           loc.x() % m_lod == 0 && loc.y() % m_lod == 0;
 }
 
 SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector3d& loc) const {
@@ -720,16 +1089,15 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector3d& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2i ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid.Find(ij)) {
+        ni.sinkage = nr->sinkage;
+        ni.sinkage_plastic = nr->sinkage_plastic;
+        ni.sinkage_elastic = nr->sinkage_elastic;
+        ni.sigma = nr->sigma;
+        ni.sigma_yield = nr->sigma_yield;
+        ni.kshear = nr->kshear;
+        ni.tau = nr->tau;
         return ni;
     }
 
@@ -746,26 +1114,28 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector3d& loc) const {
 
 // Get index of trimesh vertex corresponding to the specified grid vertex.
 int SCMLoader::GetMeshVertexIndex(const ChVector2i& loc) {
-    assert(loc.x() >= -m_nx);
-    assert(loc.x() <= +m_nx);
-    assert(loc.y() >= -m_ny);
-    assert(loc.y() <= +m_ny);
-    return (loc.x() + m_nx) + (2 * m_nx + 1) * (loc.y() + m_ny);
+    assert(CheckMeshBounds(loc));
+    int cnx = m_nx / m_lod;
+    int cny = m_ny / m_lod;
+    return (loc.x() / m_lod + cnx) + (2 * cnx + 1) * (loc.y() / m_lod + cny);
 }
 
 // Get indices of trimesh faces incident to the specified grid vertex.
 std::vector<int> SCMLoader::GetMeshFaceIndices(const ChVector2i& loc) {
-    int i = loc.x();
-    int j = loc.y();
+    // Coarse grid indices
+    int cnx = m_nx / m_lod;
+    int cny = m_ny / m_lod;
+    int i = loc.x() / m_lod;
+    int j = loc.y() / m_lod;
 
     // Ignore boundary vertices
-    if (i == -m_nx || i == m_nx || j == -m_ny || j == m_ny)
+    if (i == -cnx || i == cnx || j == -cny || j == cny)
         return std::vector<int>();
 
     // Load indices of 6 adjacent faces
-    i += m_nx;
-    j += m_ny;
-    int nx = 2 * m_nx;
+    i += cnx;
+    j += cny;
+    int nx = 2 * cnx;
     std::vector<int> faces(6);
     faces[0] = 2 * ((i - 1) + nx * (j - 1));
     faces[1] = 2 * ((i - 1) + nx * (j - 1)) + 1;
@@ -784,9 +1154,25 @@ double SCMLoader::GetInitHeight(const ChVector2i& loc) const {
             return 0;
         case PatchType::HEIGHT_MAP:
         case PatchType::TRI_MESH: {
-            auto x = ChClamp(loc.x(), -m_nx, +m_nx);
-            auto y = ChClamp(loc.y(), -m_ny, +m_ny);
-            return m_heights(x + m_nx, y + m_ny);
+            auto x = ChClamp(loc.x(), -m_nx, +m_nx) + m_nx;
+            auto y = ChClamp(loc.y(), -m_ny, +m_ny) + m_ny;
+            if (m_lod == 1)
+                return m_heights(x, y);
+
+            // Coarse grid cell containing the node and scaled node offsets within the cell
+            int ic = std::min(x / m_lod, 2 * (m_nx / m_lod) - 1);
+            int jc = std::min(y / m_lod, 2 * (m_ny / m_lod) - 1);
+            double u = (x - ic * m_lod) / (double)m_lod;
+            double v = (y - jc * m_lod) / (double)m_lod;
+
+            // Linear interpolation over the same triangles used in the visualization mesh
+            double h00 = m_heights(ic, jc);
+            double h10 = m_heights(ic + 1, jc);
+            double h01 = m_heights(ic, jc + 1);
+            double h11 = m_heights(ic + 1, jc + 1);
+            if (u >= v)
+                return h00 + u * (h10 - h00) + v * (h11 - h10);
+            return h00 + v * (h01 - h00) + u * (h11 - h01);
         }
         default:
             return 0;
@@ -813,10 +1199,9 @@ ChVector3d SCMLoader::GetInitNormal(const ChVector2i& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2i& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid.Find(loc))
+        return nr->level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -900,6 +1285,22 @@ ChVector3d SCMLoader::GetNormal(const ChVector3d& loc) const {
     return ChWorldFrame::FromISO(nrm_abs);
 }
 
+// Get the terrain height and normal at the point below the specified location.
+void SCMLoader::GetHeightNormal(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    // Express location in the SCM frame
+    ChVector3d loc_loc = m_plane.TransformPointParentToLocal(loc);
+
+    // Get height and normal (relative to SCM plane) at closest grid vertex (approximation)
+    int i = static_cast<int>(std::round(loc_loc.x() / m_delta));
+    int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
+    loc_loc.z() = GetHeight(ChVector2i(i, j));
+    auto nrm_loc = GetNormal(ChVector2i(i, j));
+
+    // Express in global frame
+    height = ChWorldFrame::Height(m_plane.TransformPointLocalToParent(loc_loc));
+    normal = ChWorldFrame::FromISO(m_plane.TransformDirectionLocalToParent(nrm_loc));
+}
+
 // Synchronize information for a moving patch
 void SCMLoader::UpdateMovingPatch(MovingPatchInfo& p, const ChVector3d& Z) {
     ChVector2d p_min(+std::numeric_limits<double>::max());
@@ -1044,7 +1445,7 @@ void SCMLoader::ComputeInternalForces() {
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
     for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+        auto& nr = m_grid.At(ij);
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -1093,6 +1494,16 @@ void SCMLoader::ComputeInternalForces() {
         UpdateFixedPatch(m_patches[0]);
     }
 
+    // If paging, bring in the grid tiles that may be accessed during this step (some in parallel): the patch ranges,
+    // extended by the maximum extent of the erosion domain (if bulldozing) and by one node for neighbor queries.
+    if (m_grid.IsPaging()) {
+        int margin = m_bulldozing ? m_erosion_propagations + 3 : 1;
+        for (const auto& p : m_patches) {
+            if (!p.m_range.empty())
+                m_grid.Prefetch(p.m_range.front() - ChVector2i(margin), p.m_range.back() + ChVector2i(margin));
+        }
+    }
+
     m_timer_moving_patches.stop();
 
     // -------------------------
@@ -1101,13 +1512,15 @@ void SCMLoader::ComputeInternalForces() {
 
     // Information of vertices with ray-cast hits
     struct HitRecord {
+        ChVector2i ij;               // grid node
         ChContactable* contactable;  // pointer to hit object
         ChVector3d abs_point;        // hit point, expressed in global frame
         int patch_id;                // index of associated patch id
     };
 
-    // Hash-map for vertices with ray-cast hits
-    std::unordered_map<ChVector2i, HitRecord, CoordHash> hits;
+    // Vertices with ray-cast hits (in order of insertion) and hash-map for look-up by grid node
+    std::vector<HitRecord> hits;
+    std::unordered_map<ChVector2i, int, CoordHash> hit_index;
 
     m_num_ray_casts = 0;
     m_num_ray_hits = 0;
@@ -1152,13 +1565,14 @@ void SCMLoader::ComputeInternalForces() {
     #pragma omp critical(SCM_ray_casting)
                 {
                     // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-                    }
+                    m_grid.Insert(ij, NodeRecord(z, z, GetInitNormal(ij)));
 
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
+                    // Add to our list of hits to process
+                    if (hit_index.insert(std::make_pair(ij, (int)hits.size())).second) {
+                        HitRecord record = {ij, mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint,
+                                            -1};
+                        hits.push_back(record);
+                    }
                     m_num_ray_hits++;
                 }
             }
@@ -1168,20 +1582,27 @@ void SCMLoader::ComputeInternalForces() {
 
 #else
 
-    // Map-reduce approach (to eliminate critical section)
+    // Batched approach: generate the rays at all vertices in a patch range and cast them together
 
     const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2i, HitRecord, CoordHash>> t_hits(nthreads);
+    std::vector<ChVector2i> ray_nodes;
+    std::vector<ChVector3d> ray_from;
+    std::vector<ChVector3d> ray_to;
+    std::vector<char> ray_active;
+    std::vector<ChCollisionSystem::ChRayhitResult> ray_results;
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
         m_timer_ray_testing.start();
 
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
+        // Generate rays at all vertices in the patch range.
+        // Rays are kept in the order of the patch range, so that neighboring rays are spatially coherent.
+        int num_range = (int)p.m_range.size();
+        ray_from.resize(num_range);
+        ray_to.resize(num_range);
+        ray_active.resize(num_range);
+    #pragma omp parallel for num_threads(nthreads)
+        for (int k = 0; k < num_range; k++) {
             ChVector2i ij = p.m_range[k];
 
             // Move from (i, j) to (x, y, z) representation in the world frame
@@ -1192,42 +1613,53 @@ void SCMLoader::ComputeInternalForces() {
             ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
 
             // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector3d from = to - m_Z * m_test_offset_down;
+            ray_to[k] = vertex_abs + m_Z * m_test_offset_up;
+            ray_from[k] = ray_to[k] - m_Z * m_test_offset_down;
 
             // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
+            ray_active[k] = !m_moving_patch || RayOBBtest(p, ray_from[k], m_Z);
+        }
 
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
-            }
+        // Compact the list of rays, discarding those rejected by the Ray-OBB test
+        int num_rays = 0;
+        ray_nodes.resize(num_range);
+        for (int k = 0; k < num_range; k++) {
+            if (!ray_active[k])
+                continue;
+            ray_nodes[num_rays] = p.m_range[k];
+            ray_from[num_rays] = ray_from[k];
+            ray_to[num_rays] = ray_to[k];
+            num_rays++;
         }
+        ray_nodes.resize(num_rays);
+        ray_from.resize(num_rays);
+        ray_to.resize(num_rays);
+
+        // Cast all rays into collision system
+        GetSystem()->GetCollisionSystem()->RayHitBatch(ray_from, ray_to, ray_results);
 
         m_timer_ray_testing.stop();
 
-        m_num_ray_casts += num_ray_casts;
+        m_num_ray_casts += num_rays;
 
         // Sequential insertion in global hits
-        for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
-                }
-                ////hits.insert(h);
+        for (int k = 0; k < num_rays; k++) {
+            const auto& result = ray_results[k];
+            if (!result.hit)
+                continue;
+
+            // If this is the first hit from this node, initialize the node record
+            const auto& ij = ray_nodes[k];
+            if (!m_grid.Find(ij)) {
+                double z = GetInitHeight(ij);
+                m_grid.Insert(ij, NodeRecord(z, z, GetInitNormal(ij)));
             }
 
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
+            // Add to our list of hits to process
+            if (hit_index.insert(std::make_pair(ij, (int)hits.size())).second) {
+                HitRecord record = {ij, result.hitModel->GetContactable(), result.abs_hitPoint, -1};
+                hits.push_back(record);
+            }
         }
         m_num_ray_hits = (int)hits.size();
     }
@@ -1254,55 +1686,58 @@ void SCMLoader::ComputeInternalForces() {
 
     // Loop through all hit nodes and determine to which contact patch they belong.
     // Use a queue-based flood-filling algorithm based on the neighbors of each hit node.
+    // Hit nodes are processed in the order of the ray casts, so that the patch numbering is deterministic.
+    int num_hits = (int)hits.size();
     m_num_contact_patches = 0;
-    for (auto& h : hits) {
-        if (h.second.patch_id != -1)
+    std::queue<int> todo;
+    for (int ih = 0; ih < num_hits; ih++) {
+        if (hits[ih].patch_id != -1)
             continue;
 
-        ChVector2i ij = h.first;
+        ChVector2i ij = hits[ih].ij;
 
         // Make a new contact patch and add this hit node to it
-        h.second.patch_id = m_num_contact_patches++;
+        int crt_patch = m_num_contact_patches++;
+        hits[ih].patch_id = crt_patch;
         ContactPatchRecord patch;
         patch.nodes.push_back(ij);
         patch.points.push_back(ChVector2d(m_delta * ij.x(), m_delta * ij.y()));
 
         // Add current node to the work queue
-        std::queue<ChVector2i> todo;
-        todo.push(ij);
+        todo.push(ih);
 
         while (!todo.empty()) {
-            auto crt = hits.find(todo.front());  // Current hit node is first element in queue
-            todo.pop();                          // Remove first element from queue
-
-            ChVector2i crt_ij = crt->first;
-            int crt_patch = crt->second.patch_id;
+            ChVector2i crt_ij = hits[todo.front()].ij;  // Current hit node is first element in queue
+            todo.pop();                                 // Remove first element from queue
 
             // Loop through the neighbors of the current hit node
             for (int k = 0; k < 4; k++) {
                 ChVector2i nbr_ij = crt_ij + neighbors4[k];
                 // If neighbor is not a hit node, move on
-                auto nbr = hits.find(nbr_ij);
-                if (nbr == hits.end())
+                auto nbr = hit_index.find(nbr_ij);
+                if (nbr == hit_index.end())
                     continue;
                 // If neighbor already assigned to a contact patch, move on
-                if (nbr->second.patch_id != -1)
+                auto& nbr_hit = hits[nbr->second];
+                if (nbr_hit.patch_id != -1)
                     continue;
                 // Assign neighbor to the same contact patch
-                nbr->second.patch_id = crt_patch;
+                nbr_hit.patch_id = crt_patch;
                 // Add neighbor point to patch lists
                 patch.nodes.push_back(nbr_ij);
                 patch.points.push_back(ChVector2d(m_delta * nbr_ij.x(), m_delta * nbr_ij.y()));
                 // Add neighbor to end of work queue
-                todo.push(nbr_ij);
+                todo.push(nbr->second);
             }
         }
-        contact_patches.push_back(patch);
+        contact_patches.push_back(std::move(patch));
     }
 
     // Calculate area and perimeter of each contact patch.
     // Calculate approximation to Beker term 1/b.
-    for (auto& p : contact_patches) {
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (int ip = 0; ip < m_num_contact_patches; ip++) {
+        auto& p = contact_patches[ip];
         utils::ChConvexHull2D ch(p.points);
         p.area = ch.GetArea();
         p.perimeter = ch.GetPerimeter();
@@ -1321,166 +1756,267 @@ void SCMLoader::ComputeInternalForces() {
 
     m_timer_contact_forces.start();
 
-    // Initialize local values for the soil parameters
-    double Bekker_Kphi = m_Bekker_Kphi;
-    double Bekker_Kc = m_Bekker_Kc;
-    double Bekker_n = m_Bekker_n;
-    double Mohr_cohesion = m_Mohr_cohesion;
-    double Mohr_mu = m_Mohr_mu;
-    double Janosi_shear = m_Janosi_shear;
-    double elastic_K = m_elastic_K;
-    double damping_R = m_damping_R;
+    const double step = GetSystem()->GetStep();
+
+    // Soil parameters at the hit nodes.
+    // If location-dependent, these are evaluated sequentially (the user callback may not be thread-safe).
+    struct SoilParameters {
+        double Bekker_Kphi;
+        double Bekker_Kc;
+        double Bekker_n;
+        double Mohr_cohesion;
+        double Mohr_mu;
+        double Janosi_shear;
+        double elastic_K;
+        double damping_R;
+    };
+    SoilParameters soil_default = {m_Bekker_Kphi, m_Bekker_Kc,    m_Bekker_n,  m_Mohr_cohesion,
+                                   m_Mohr_mu,     m_Janosi_shear, m_elastic_K, m_damping_R};
+    std::vector<SoilParameters> soil;
+    if (m_soil_fun) {
+        soil.resize(num_hits, soil_default);
+        for (int ih = 0; ih < num_hits; ih++) {
+            auto& sp = soil[ih];
+            auto hit_point_loc = m_plane.TransformPointParentToLocal(hits[ih].abs_point);
+            double Mohr_friction;
+            m_soil_fun->Set(hit_point_loc, sp.Bekker_Kphi, sp.Bekker_Kc, sp.Bekker_n, sp.Mohr_cohesion, Mohr_friction,
+                            sp.Janosi_shear, sp.elastic_K, sp.damping_R);
+            sp.Mohr_mu = std::tan(Mohr_friction * CH_DEG_TO_RAD);
+        }
+    }
 
-    // Process only hit nodes
-    for (auto& h : hits) {
-        ChVector2d ij = h.first;
+    // Type of contactable at a hit node and indices of the force accumulators it contributes to
+    enum class ForceTarget { NONE, BODY, TRIANGLE, SURFACE };
+    struct ForceRecord {
+        ForceTarget target;  // type of contactable
+        int index[3];        // accumulator indices (rigid body or FEA triangle nodes)
+        bool touched;        // true if the hit node is in contact (positive pressure)
+        ChVector3d force;    // contact force (expressed in global frame)
+    };
+    std::vector<ForceRecord> frc(num_hits);
+
+    // Assign accumulator indices to the contactables receiving forces.
+    // Consecutive hit nodes mostly belong to the same contactable, so cache the last classification.
+    std::vector<ChBody*> frc_bodies;
+    std::vector<std::shared_ptr<fea::ChNodeFEAxyz>> frc_nodes;
+    std::unordered_map<ChBody*, int> body_index;
+    std::unordered_map<fea::ChNodeFEAxyz*, int> node_index;
+    ChContactable* last_contactable = nullptr;
+    ForceRecord last_frc = {ForceTarget::NONE, {-1, -1, -1}, false, VNULL};
+    for (int ih = 0; ih < num_hits; ih++) {
+        ChContactable* contactable = hits[ih].contactable;
+        if (contactable != last_contactable) {
+            last_contactable = contactable;
+            last_frc.target = ForceTarget::NONE;
+            if (ChBody* body = dynamic_cast<ChBody*>(contactable)) {
+                auto b = body_index.insert(std::make_pair(body, (int)frc_bodies.size()));
+                if (b.second)
+                    frc_bodies.push_back(body);
+                last_frc.target = ForceTarget::BODY;
+                last_frc.index[0] = b.first->second;
+            } else if (auto tri = dynamic_cast<fea::ChContactTriangleXYZ*>(contactable)) {
+                for (int i = 0; i < 3; i++) {
+                    auto node = tri->GetNode(i);
+                    auto n = node_index.insert(std::make_pair(node.get(), (int)frc_nodes.size()));
+                    if (n.second)
+                        frc_nodes.push_back(node);
+                    last_frc.index[i] = n.first->second;
+                }
+                last_frc.target = ForceTarget::TRIANGLE;
+            } else if (dynamic_cast<ChLoadableUV*>(contactable)) {
+                last_frc.target = ForceTarget::SURFACE;
+            }
+        }
+        frc[ih] = last_frc;
+    }
 
-        auto& nr = m_grid_map.at(ij);      // node record
-        const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
+    // Per-thread force accumulators (rigid body forces and torques, FEA node forces)
+    int num_bodies = (int)frc_bodies.size();
+    int num_nodes = (int)frc_nodes.size();
+    std::vector<ChVector3d> thread_body_forces(nthreads * num_bodies, VNULL);
+    std::vector<ChVector3d> thread_body_torques(nthreads * num_bodies, VNULL);
+    std::vector<ChVector3d> thread_node_forces(nthreads * num_nodes, VNULL);
+
+    // Process only hit nodes (each hit node updates its own grid node record)
+#pragma omp parallel num_threads(nthreads)
+    {
+        int tid = ChOMP::GetThreadNum();
+        ChVector3d* body_forces = thread_body_forces.data() + tid * num_bodies;
+        ChVector3d* body_torques = thread_body_torques.data() + tid * num_bodies;
+        ChVector3d* node_forces = thread_node_forces.data() + tid * num_nodes;
+
+#pragma omp for schedule(static)
+        for (int ih = 0; ih < num_hits; ih++) {
+            const auto& h = hits[ih];
+            const auto& sp = m_soil_fun ? soil[ih] : soil_default;
+            auto& f = frc[ih];
+            f.touched = false;
+
+            ChVector2i ij = h.ij;
+            auto& nr = m_grid.At(ij);          // node record
+            const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
+
+            auto hit_point_loc = m_plane.TransformPointParentToLocal(h.abs_point);
+
+            nr.hit_level = hit_point_loc.z();                              // along SCM z axis
+            double p_hit_offset = ca * (nr.level_initial - nr.hit_level);  // along local normal direction
+
+            // Elastic try (along local normal direction)
+            nr.sigma = sp.elastic_K * (p_hit_offset - nr.sinkage_plastic);
+
+            // Handle unilaterality
+            if (nr.sigma < 0) {
+                nr.sigma = 0;
+                continue;
+            }
 
-        ChContactable* contactable = h.second.contactable;
-        const ChVector3d& hit_point_abs = h.second.abs_point;
-        int patch_id = h.second.patch_id;
+            // Mark current node as modified
+            f.touched = true;
+
+            // Calculate velocity at touched grid node
+            ChVector3d point_local(ij.x() * m_delta, ij.y() * m_delta, nr.level);
+            ChVector3d point_abs = m_plane.TransformPointLocalToParent(point_local);
+            ChVector3d speed_abs = h.contactable->GetContactPointSpeed(point_abs);
+
+            // Calculate normal and tangent directions (expressed in absolute frame)
+            ChVector3d N = m_plane.TransformDirectionLocalToParent(nr.normal);
+            double Vn = Vdot(speed_abs, N);
+            ChVector3d T = -(speed_abs - Vn * N);
+            T.Normalize();
+
+            // Update total sinkage and current level for this hit node
+            nr.sinkage = p_hit_offset;
+            nr.level = nr.hit_level;
+
+            // Accumulate shear for Janosi-Hanamoto (along local tangent direction)
+            nr.kshear += Vdot(speed_abs, -T) * step;
+
+            // Plastic correction (along local normal direction)
+            if (nr.sigma > nr.sigma_yield) {
+                // Bekker formula
+                nr.sigma = (contact_patches[h.patch_id].oob * sp.Bekker_Kc + sp.Bekker_Kphi) *
+                           std::pow(nr.sinkage, sp.Bekker_n);
+                nr.sigma_yield = nr.sigma;
+                double old_sinkage_plastic = nr.sinkage_plastic;
+                nr.sinkage_plastic = nr.sinkage - nr.sigma / sp.elastic_K;
+                nr.step_plastic_flow = (nr.sinkage_plastic - old_sinkage_plastic) / step;
+            }
 
-        auto hit_point_loc = m_plane.TransformPointParentToLocal(hit_point_abs);
+            // Elastic sinkage (along local normal direction)
+            nr.sinkage_elastic = nr.sinkage - nr.sinkage_plastic;
 
-        if (m_soil_fun) {
-            double Mohr_friction;
-            m_soil_fun->Set(hit_point_loc, Bekker_Kphi, Bekker_Kc, Bekker_n, Mohr_cohesion, Mohr_friction, Janosi_shear,
-                            elastic_K, damping_R);
-            Mohr_mu = std::tan(Mohr_friction * CH_DEG_TO_RAD);
-        }
+            // Add compressive speed-proportional damping (not clamped by pressure yield)
+            ////if (Vn < 0) {
+            nr.sigma += -Vn * sp.damping_R;
+            ////}
 
-        nr.hit_level = hit_point_loc.z();                              // along SCM z axis
-        double p_hit_offset = ca * (nr.level_initial - nr.hit_level);  // along local normal direction
+            // Mohr-Coulomb
+            double tau_max = sp.Mohr_cohesion + nr.sigma * sp.Mohr_mu;
 
-        // Elastic try (along local normal direction)
-        nr.sigma = elastic_K * (p_hit_offset - nr.sinkage_plastic);
+            // Janosi-Hanamoto (along local tangent direction)
+            nr.tau = tau_max * (1.0 - std::exp(-(nr.kshear / sp.Janosi_shear)));
 
-        // Handle unilaterality
-        if (nr.sigma < 0) {
-            nr.sigma = 0;
-            continue;
-        }
+            // Calculate normal and tangential forces (in local node directions).
+            // If specified, combine properties for soil-contactable interaction and soil-soil interaction.
+            ChVector3d Fn = N * m_area * nr.sigma;
+            ChVector3d Ft;
 
-        // Mark current node as modified
-        m_modified_nodes.push_back(ij);
-
-        // Calculate velocity at touched grid node
-        ChVector3d point_local(ij.x() * m_delta, ij.y() * m_delta, nr.level);
-        ChVector3d point_abs = m_plane.TransformPointLocalToParent(point_local);
-        ChVector3d speed_abs = contactable->GetContactPointSpeed(point_abs);
-
-        // Calculate normal and tangent directions (expressed in absolute frame)
-        ChVector3d N = m_plane.TransformDirectionLocalToParent(nr.normal);
-        double Vn = Vdot(speed_abs, N);
-        ChVector3d T = -(speed_abs - Vn * N);
-        T.Normalize();
-
-        // Update total sinkage and current level for this hit node
-        nr.sinkage = p_hit_offset;
-        nr.level = nr.hit_level;
-
-        // Accumulate shear for Janosi-Hanamoto (along local tangent direction)
-        nr.kshear += Vdot(speed_abs, -T) * GetSystem()->GetStep();
-
-        // Plastic correction (along local normal direction)
-        if (nr.sigma > nr.sigma_yield) {
-            // Bekker formula
-            nr.sigma = (contact_patches[patch_id].oob * Bekker_Kc + Bekker_Kphi) * pow(nr.sinkage, Bekker_n);
-            nr.sigma_yield = nr.sigma;
-            double old_sinkage_plastic = nr.sinkage_plastic;
-            nr.sinkage_plastic = nr.sinkage - nr.sigma / elastic_K;
-            nr.step_plastic_flow = (nr.sinkage_plastic - old_sinkage_plastic) / GetSystem()->GetStep();
-        }
+            //// TODO:  take into account "tread height" (add to SCMContactableData)?
+
+            if (auto cprops = h.contactable->GetUserData<vehicle::SCMContactableData>()) {
+                // Use weighted sum of soil-contactable and soil-soil parameters
+                double c_tau_max = cprops->Mohr_cohesion + nr.sigma * cprops->Mohr_mu;
+                double c_tau = c_tau_max * (1.0 - std::exp(-(nr.kshear / cprops->Janosi_shear)));
+                double ratio = cprops->area_ratio;
+                Ft = T * m_area * ((1 - ratio) * nr.tau + ratio * c_tau);
+            } else {
+                // Use only soil-soil parameters
+                Ft = T * m_area * nr.tau;
+            }
 
-        // Elastic sinkage (along local normal direction)
-        nr.sinkage_elastic = nr.sinkage - nr.sinkage_plastic;
+            f.force = Fn + Ft;
 
-        // Add compressive speed-proportional damping (not clamped by pressure yield)
-        ////if (Vn < 0) {
-        nr.sigma += -Vn * damping_R;
-        ////}
+            switch (f.target) {
+                case ForceTarget::BODY: {
+                    // Accumulate resultant force and torque (expressed in global frame) for this rigid body.
+                    // The resultant force is assumed to be applied at the body COM.
+                    ChBody* body = frc_bodies[f.index[0]];
+                    body_forces[f.index[0]] += f.force;
+                    body_torques[f.index[0]] += Vcross(point_abs - body->GetPos(), f.force);
+                    break;
+                }
+                case ForceTarget::TRIANGLE: {
+                    // Accumulate forces (expressed in global frame) for the nodes of this contact triangle.
+                    auto tri = static_cast<fea::ChContactTriangleXYZ*>(h.contactable);
+                    double s[3];
+                    tri->ComputeUVfromP(point_abs, s[1], s[2]);
+                    s[0] = 1 - s[1] - s[2];
+                    for (int i = 0; i < 3; i++)
+                        node_forces[f.index[i]] += s[i] * f.force;
+                    break;
+                }
+                default:
+                    break;
+            }
 
-        // Mohr-Coulomb
-        double tau_max = Mohr_cohesion + nr.sigma * Mohr_mu;
+            // Update grid node height (in local SCM frame, along SCM z axis)
+            nr.level = nr.level_initial - nr.sinkage / ca;
 
-        // Janosi-Hanamoto (along local tangent direction)
-        nr.tau = tau_max * (1.0 - exp(-(nr.kshear / Janosi_shear)));
+        }  // end loop on ray hits
+    }
 
-        // Calculate normal and tangential forces (in local node directions).
-        // If specified, combine properties for soil-contactable interaction and soil-soil interaction.
-        ChVector3d Fn = N * m_area * nr.sigma;
-        ChVector3d Ft;
+    // Collect modified nodes and apply forces on surfaces (sequentially, in order of hit nodes).
+    // Flag the bodies and FEA nodes which received contact forces.
+    std::vector<char> body_touched(num_bodies, 0);
+    std::vector<char> node_touched(num_nodes, 0);
+    for (int ih = 0; ih < num_hits; ih++) {
+        if (!frc[ih].touched)
+            continue;
 
-        //// TODO:  take into account "tread height" (add to SCMContactableData)?
+        m_modified_nodes.push_back(hits[ih].ij);
 
-        if (auto cprops = contactable->GetUserData<vehicle::SCMContactableData>()) {
-            // Use weighted sum of soil-contactable and soil-soil parameters
-            double c_tau_max = cprops->Mohr_cohesion + nr.sigma * cprops->Mohr_mu;
-            double c_tau = c_tau_max * (1.0 - exp(-(nr.kshear / cprops->Janosi_shear)));
-            double ratio = cprops->area_ratio;
-            Ft = T * m_area * ((1 - ratio) * nr.tau + ratio * c_tau);
-        } else {
-            // Use only soil-soil parameters
-            Ft = T * m_area * nr.tau;
+        if (frc[ih].target == ForceTarget::BODY) {
+            body_touched[frc[ih].index[0]] = 1;
+        } else if (frc[ih].target == ForceTarget::TRIANGLE) {
+            for (int i = 0; i < 3; i++)
+                node_touched[frc[ih].index[i]] = 1;
         }
 
-        if (ChBody* body = dynamic_cast<ChBody*>(contactable)) {
-            // Accumulate resultant force and torque (expressed in global frame) for this rigid body.
-            // The resultant force is assumed to be applied at the body COM.
-            ChVector3d force = Fn + Ft;
-            ChVector3d moment = Vcross(point_abs - body->GetPos(), force);
-
-            auto itr = m_body_forces.find(body);
-            if (itr == m_body_forces.end()) {
-                // Create new entry and initialize generalized force
-                auto frc = std::make_pair(force, moment);
-                m_body_forces.insert(std::make_pair(body, frc));
-            } else {
-                // Update generalized force
-                itr->second.first += force;
-                itr->second.second += moment;
-            }
-        } else if (fea::ChContactTriangleXYZ* tri = dynamic_cast<fea::ChContactTriangleXYZ*>(contactable)) {
-            // Accumulate forces (expressed in global frame) for the nodes of this contact triangle.
-            ChVector3d force = Fn + Ft;
-
-            double s[3];
-            tri->ComputeUVfromP(point_abs, s[1], s[2]);
-            s[0] = 1 - s[1] - s[2];
-
-            for (int i = 0; i < 3; i++) {
-                auto node = tri->GetNode(i);
-                auto node_force = s[i] * force;
-                auto itr = m_node_forces.find(node);
-                if (itr == m_node_forces.end()) {
-                    // Create new entry and initialize force
-                    m_node_forces.insert(std::make_pair(node, node_force));
-                } else {
-                    // Update force
-                    itr->second += node_force;
-                }
-            }
-        } else if (ChLoadableUV* surf = dynamic_cast<ChLoadableUV*>(contactable)) {
-            if (!m_cosim_mode) {
-                // [](){} Trick: no deletion for this shared ptr
-                std::shared_ptr<ChLoadableUV> ssurf(surf, [](ChLoadableUV*) {});
-                auto loader = chrono_types::make_shared<ChLoaderForceOnSurface>(ssurf);
-                loader->SetForce(Fn + Ft);
-                loader->SetApplication(0.5, 0.5);  //// TODO set UV, now just in middle
-                auto load = chrono_types::make_shared<ChLoad>(loader);
-                this->Add(load);
-            }
+        if (frc[ih].target == ForceTarget::SURFACE && !m_cosim_mode) {
+            // [](){} Trick: no deletion for this shared ptr
+            ChLoadableUV* surf = dynamic_cast<ChLoadableUV*>(hits[ih].contactable);
+            std::shared_ptr<ChLoadableUV> ssurf(surf, [](ChLoadableUV*) {});
+            auto loader = chrono_types::make_shared<ChLoaderForceOnSurface>(ssurf);
+            loader->SetForce(frc[ih].force);
+            loader->SetApplication(0.5, 0.5);  //// TODO set UV, now just in middle
+            auto load = chrono_types::make_shared<ChLoad>(loader);
+            this->Add(load);
 
             // Accumulate contact forces for this surface.
             //// TODO
         }
+    }
 
-        // Update grid node height (in local SCM frame, along SCM z axis)
-        nr.level = nr.level_initial - nr.sinkage / ca;
-
-    }  // end loop on ray hits
+    // Reduce the per-thread accumulators
+    for (int ib = 0; ib < num_bodies; ib++) {
+        if (!body_touched[ib])
+            continue;
+        ChVector3d force = VNULL;
+        ChVector3d torque = VNULL;
+        for (int it = 0; it < nthreads; it++) {
+            force += thread_body_forces[it * num_bodies + ib];
+            torque += thread_body_torques[it * num_bodies + ib];
+        }
+        m_body_forces.insert(std::make_pair(frc_bodies[ib], std::make_pair(force, torque)));
+    }
+    for (int in = 0; in < num_nodes; in++) {
+        if (!node_touched[in])
+            continue;
+        ChVector3d force = VNULL;
+        for (int it = 0; it < nthreads; it++)
+            force += thread_node_forces[it * num_nodes + in];
+        m_node_forces.insert(std::make_pair(frc_nodes[in], force));
+    }
 
     // Create loads for bodies and nodes to apply the accumulated terrain force/torque for each of them
     if (!m_cosim_mode) {
@@ -1494,7 +2030,6 @@ void SCMLoader::ComputeInternalForces() {
         }
 
         for (const auto& f : m_node_forces) {
-            std::cout << f.second << std::endl;
             auto force_load = chrono_types::make_shared<ChLoadNodeXYZ>(f.first, f.second);
             Add(force_load);
         }
@@ -1513,20 +2048,22 @@ void SCMLoader::ComputeInternalForces() {
     if (m_bulldozing) {
         typedef std::unordered_set<ChVector2i, CoordHash> NodeSet;
 
+        const int nthreads = GetSystem()->GetNumThreadsChrono();
+
         // Maximum level change between neighboring nodes (smoothing phase)
         double dy_lim = m_delta * m_erosion_slope;
 
         // (1) Raise boundaries of each contact patch
         m_timer_bulldozing_boundary.start();
 
-        NodeSet boundary;  // union of contact patch boundaries
+        m_erosion_domain.clear();  // erosion domain (initialized with the union of contact patch boundaries)
         for (auto p : contact_patches) {
             NodeSet p_boundary;  // boundary of effective contact patch
 
             // Calculate the displaced material from all touched nodes and identify boundary
             double tot_step_flow = 0;
             for (const auto& ij : p.nodes) {                 // for each node in contact patch
-                const auto& nr = m_grid_map.at(ij);          //   get node record
+                const auto& nr = m_grid.At(ij);              //   get node record
                 if (nr.sigma <= 0)                           //   if node not touched
                     continue;                                //     skip (not in effective patch)
                 tot_step_flow += nr.step_plastic_flow;       //   accumulate displaced material
@@ -1534,10 +2071,11 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
+                    auto nbr_nr = m_grid.Find(nbr_ij);  //     neighbor node record
+                    if (!nbr_nr)                        //     if neighbor not yet recorded
+                        p_boundary.insert(nbr_ij);      //       set neighbor as boundary
+                    else if (nbr_nr->sigma <= 0)        //     if neighbor not touched
+                        p_boundary.insert(nbr_ij);      //       set neighbor as boundary
                 }
             }
             tot_step_flow *= GetSystem()->GetStep();
@@ -1546,100 +2084,66 @@ void SCMLoader::ComputeInternalForces() {
             double diff = m_flow_factor * tot_step_flow / p_boundary.size();
 
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
-            for (const auto& ij : p_boundary) {                                  // for each node in bndry
-                m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
-                    double z = GetInitHeight(ij);                                //     undeformed height
-                    const ChVector3d& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
-                    m_modified_nodes.push_back(ij);                              //     mark as modified
-                }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
-                nr.erosion = true;                                               //   add to erosion domain
-                AddMaterialToNode(diff, nr);                                     //   add raise amount
+            for (const auto& ij : p_boundary) {               // for each node in bndry
+                m_modified_nodes.push_back(ij);               //   mark as modified
+                if (!m_grid.Find(ij)) {                       //   if not yet recorded
+                    double z = GetInitHeight(ij);             //     undeformed height
+                    const ChVector3d& n = GetInitNormal(ij);  //     terrain normal
+                    m_grid.Insert(ij, NodeRecord(z, z, n));   //     add new node record
+                    m_modified_nodes.push_back(ij);           //     mark as modified
+                }                                             //
+                auto& nr = m_grid.At(ij);                     //   node record
+                if (!nr.erosion)                              //   if not already in erosion domain
+                    m_erosion_domain.push_back(ij);           //     accumulate boundary
+                nr.erosion = true;                            //   add to erosion domain
+                AddMaterialToNode(diff, nr);                  //   add raise amount
             }
 
-            // Accumulate boundary
-            boundary.insert(p_boundary.begin(), p_boundary.end());
-
         }  // end for contact_patches
 
         m_timer_bulldozing_boundary.stop();
 
-        // (2) Calculate erosion domain (dilate boundary)
+        // (2) Calculate erosion domain (dilate boundary).
+        // Membership in the erosion domain is tracked with the node erosion flags, so that each propagation only visits
+        // the nodes added to the domain at the previous propagation (the erosion front).
         m_timer_bulldozing_domain.start();
 
-        NodeSet erosion_domain = boundary;
-        NodeSet erosion_front = boundary;  // initialize erosion front to boundary nodes
+        size_t front_start = 0;
         for (int i = 0; i < m_erosion_propagations; i++) {
-            NodeSet front;                                   // new erosion front
-            for (const auto& ij : erosion_front) {           // for each node in current erosion front
-                for (int k = 0; k < 4; k++) {                // check each of its neighbors
-                    ChVector2i nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
-                    ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
-                    ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
-                        double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
-                        const ChVector3d& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
-                        NodeRecord nr(z, z, n);                         //     create new record
-                        nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
-                        front.insert(nbr_ij);                           //     add neighbor to new front
-                        m_modified_nodes.push_back(nbr_ij);             //     mark as modified
-                    } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
-                        if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
-                            nr.erosion = true;                          //       include in erosion domain
-                            front.insert(nbr_ij);                       //       add neighbor to new front
-                            m_modified_nodes.push_back(nbr_ij);         //       mark as modified
-                        }
+            size_t front_end = m_erosion_domain.size();
+            for (size_t f = front_start; f < front_end; f++) {            // for each node in current erosion front
+                ChVector2i ij = m_erosion_domain[f];                      //   node coordinates
+                for (int k = 0; k < 4; k++) {                             //   check each of its neighbors
+                    ChVector2i nbr_ij = ij + neighbors4[k];               //     neighbor node coordinates
+                    auto nbr_nr = m_grid.Find(nbr_ij);                    //     neighbor node record
+                    if (!nbr_nr) {                                        //     if neighbor not yet recorded
+                        double z = GetInitHeight(nbr_ij);                 //       undeformed height
+                        const ChVector3d& n = GetInitNormal(nbr_ij);      //       terrain normal
+                        NodeRecord nr(z, z, n);                           //       create new record
+                        nr.erosion = true;                                //       include in erosion domain
+                        m_grid.Insert(nbr_ij, nr);                        //       add new node record
+                        m_erosion_domain.push_back(nbr_ij);               //       add neighbor to new front
+                        m_modified_nodes.push_back(nbr_ij);               //       mark as modified
+                    } else if (!nbr_nr->erosion && nbr_nr->sigma <= 0) {  //     if neighbor not touched
+                        nbr_nr->erosion = true;                           //       include in erosion domain
+                        m_erosion_domain.push_back(nbr_ij);               //       add neighbor to new front
+                        m_modified_nodes.push_back(nbr_ij);               //       mark as modified
                     }
                 }
             }
-            erosion_domain.insert(front.begin(), front.end());  // add current front to erosion domain
-            erosion_front = front;                              // advance erosion front
+            front_start = front_end;  // advance erosion front
         }
 
-        m_num_erosion_nodes = static_cast<int>(erosion_domain.size());
+        m_num_erosion_nodes = static_cast<int>(m_erosion_domain.size());
         m_timer_bulldozing_domain.stop();
 
-        // (3) Erosion algorithm on domain
+        // (3) Erosion algorithm on domain.
         m_timer_bulldozing_erosion.start();
 
-        for (int iter = 0; iter < m_erosion_iterations; iter++) {
-            for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
-                for (int k = 0; k < 4; k++) {
-                    ChVector2i nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
-                        continue;
-                    auto& nbr_nr = rec->second;
-
-                    // (3.1) Flow remaining material to neighbor
-                    double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
-                    if (diff > 0) {
-                        RemoveMaterialFromNode(diff, nr);
-                        AddMaterialToNode(diff, nbr_nr);
-                    }
-
-                    // (3.2) Smoothing
-                    if (nbr_nr.sigma == 0) {
-                        double dy = (nr.level + nr.massremainder) - (nbr_nr.level + nbr_nr.massremainder);
-                        diff = 0.5 * (std::abs(dy) - dy_lim) / 4;  //// TODO: rethink this!
-                        if (diff > 0) {
-                            if (dy > 0) {
-                                RemoveMaterialFromNode(diff, nr);
-                                AddMaterialToNode(diff, nbr_nr);
-                            } else {
-                                RemoveMaterialFromNode(diff, nbr_nr);
-                                AddMaterialToNode(diff, nr);
-                            }
-                        }
-                    }
-                }
-            }
-        }
+        if (m_parallel_erosion)
+            ErodeJacobi(dy_lim, nthreads);
+        else
+            ErodeGaussSeidel(dy_lim);
 
         m_timer_bulldozing_erosion.stop();
 
@@ -1659,7 +2163,7 @@ void SCMLoader::ComputeInternalForces() {
         for (const auto& ij : m_modified_nodes) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
                 continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+            const auto& nr = m_grid.At(ij);           // grid node record
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
@@ -1671,6 +2175,9 @@ void SCMLoader::ComputeInternalForces() {
     }
 
     m_timer_visualization.stop();
+
+    // Page out grid tiles not used during this step, if over the memory budget
+    m_grid.PageOut();
 }
 
 void SCMLoader::AddMaterialToNode(double amount, NodeRecord& nr) {
@@ -1682,6 +2189,110 @@ void SCMLoader::AddMaterialToNode(double amount, NodeRecord& nr) {
     nr.level_initial += amount;                                  //   reset node initial level
 }
 
+// Jacobi-style relaxation: at each iteration, the net amount of material exchanged by each node with its neighbors is
+// first evaluated from the node states at the beginning of the iteration, then applied. Recorded nodes adjacent to the
+// erosion domain only exchange material with their neighbors in the domain.
+void SCMLoader::ErodeJacobi(double dy_lim, int nthreads) {
+    // Collect the nodes involved in erosion (erosion domain and its recorded neighbors)
+    m_erosion_nodes.assign(m_erosion_domain.begin(), m_erosion_domain.end());
+    std::unordered_set<ChVector2i, CoordHash> halo;
+    for (const auto& ij : m_erosion_domain) {
+        for (int k = 0; k < 4; k++) {
+            ChVector2i nbr_ij = ij + neighbors4[k];
+            auto nbr_nr = m_grid.Find(nbr_ij);
+            if (nbr_nr && !nbr_nr->erosion && halo.insert(nbr_ij).second)
+                m_erosion_nodes.push_back(nbr_ij);
+        }
+    }
+
+    // Cache the records of erosion nodes and of their neighbors (no records are created past this point)
+    int num_erosion_nodes = static_cast<int>(m_erosion_nodes.size());
+    m_erosion_records.resize(num_erosion_nodes);
+    m_erosion_neighbors.resize(num_erosion_nodes);
+    m_erosion_delta.resize(num_erosion_nodes);
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int in = 0; in < num_erosion_nodes; in++) {
+        const auto& ij = m_erosion_nodes[in];
+        m_erosion_records[in] = m_grid.Find(ij);
+        for (int k = 0; k < 4; k++)
+            m_erosion_neighbors[in][k] = m_grid.Find(ij + neighbors4[k]);
+    }
+
+    for (int iter = 0; iter < m_erosion_iterations; iter++) {
+        // Net amount of material received by each node
+#pragma omp parallel for num_threads(nthreads)
+        for (int in = 0; in < num_erosion_nodes; in++) {
+            const auto& nr = *m_erosion_records[in];
+            double delta = 0;
+            for (int k = 0; k < 4; k++) {
+                const auto nbr_nr = m_erosion_neighbors[in][k];
+                if (!nbr_nr)
+                    continue;
+                if (nr.erosion)
+                    delta -= ComputeErosionFlow(nr, *nbr_nr, dy_lim);
+                if (nbr_nr->erosion)
+                    delta += ComputeErosionFlow(*nbr_nr, nr, dy_lim);
+            }
+            m_erosion_delta[in] = delta;
+        }
+
+        // Update node levels
+#pragma omp parallel for num_threads(nthreads)
+        for (int in = 0; in < num_erosion_nodes; in++) {
+            double delta = m_erosion_delta[in];
+            if (delta > 0)
+                AddMaterialToNode(delta, *m_erosion_records[in]);
+            else if (delta < 0)
+                RemoveMaterialFromNode(-delta, *m_erosion_records[in]);
+        }
+    }
+}
+
+// Gauss-Seidel sweep: material is exchanged between each node in the erosion domain and its recorded neighbors in turn,
+// using the node states updated by the previous exchanges. This is the serial reference for the Jacobi relaxation.
+void SCMLoader::ErodeGaussSeidel(double dy_lim) {
+    for (int iter = 0; iter < m_erosion_iterations; iter++) {
+        for (const auto& ij : m_erosion_domain) {
+            auto& nr = m_grid.At(ij);
+            for (int k = 0; k < 4; k++) {
+                auto nbr_nr = m_grid.Find(ij + neighbors4[k]);
+                if (!nbr_nr)
+                    continue;
+                double flow = ComputeErosionFlow(nr, *nbr_nr, dy_lim);
+                if (flow > 0) {
+                    RemoveMaterialFromNode(flow, nr);
+                    AddMaterialToNode(flow, *nbr_nr);
+                } else if (flow < 0) {
+                    RemoveMaterialFromNode(-flow, *nbr_nr);
+                    AddMaterialToNode(-flow, nr);
+                }
+            }
+        }
+    }
+}
+
+// Amount of material flowing from a node in the erosion domain to a neighbor node.
+// A negative value indicates flow from the neighbor node.
+double SCMLoader::ComputeErosionFlow(const NodeRecord& nr, const NodeRecord& nbr_nr, double dy_lim) {
+    double flow = 0;
+
+    // Flow remaining material to neighbor
+    double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
+    if (diff > 0)
+        flow += diff;
+
+    // Smoothing
+    if (nbr_nr.sigma == 0) {
+        double dy = (nr.level + nr.massremainder) - (nbr_nr.level + nbr_nr.massremainder);
+        diff = 0.5 * (std::abs(dy) - dy_lim) / 4;  //// TODO: rethink this!
+        if (diff > 0)
+            flow += (dy > 0) ? diff : -diff;
+    }
+
+    return flow;
+}
+
 void SCMLoader::RemoveMaterialFromNode(double amount, NodeRecord& nr) {
     if (nr.massremainder > amount) {                                 // if too much remainder material
         nr.massremainder -= amount;                                  //   decrease remainder material
@@ -1782,14 +2393,13 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2i ij, int iv) {
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        nodes.reserve(m_grid.GetNumNodes());
+        m_grid.ForEach([&nodes](const ChVector2i& ij, const NodeRecord& nr) {  //
+            nodes.push_back(std::make_pair(ij, nr.level));
+        });
     } else {
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            nodes.push_back(std::make_pair(ij, m_grid.At(ij).level));
         }
     }
     return nodes;
@@ -1801,7 +2411,7 @@ std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) c
 void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes) {
     for (const auto& n : nodes) {
         // Modify existing entry in grid map or insert new one
-        m_grid_map[n.first] = SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+        m_grid.Set(n.first, SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first)));
     }
 
     // Update visualization
@@ -1810,7 +2420,7 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
             auto ij = n.first;                           // grid location
             if (!CheckMeshBounds(ij))                    // if outside mesh
                 continue;                                //   do nothing
-            const auto& nr = m_grid_map.at(ij);          // grid node record
+            const auto& nr = m_grid.At(ij);              // grid node record
             int iv = GetMeshVertexIndex(ij);             // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
             if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
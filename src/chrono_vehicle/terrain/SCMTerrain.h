@@ -20,6 +20,11 @@
 #ifndef SCM_TERRAIN_H
 #define SCM_TERRAIN_H
 
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <ostream>
 #include <unordered_map>
@@ -121,10 +126,14 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     void SetBulldozingParameters(
         double erosion_angle,          ///< angle of erosion of the displaced material [degrees]
         double flow_factor = 1.0,      ///< growth of lateral volume relative to pressed volume
-        int erosion_iterations = 3,    ///< number of erosion refinements per timestep
+        int erosion_iterations = 3,    ///< number of (Jacobi) erosion refinements per timestep
         int erosion_propagations = 10  ///< number of concentric vertex selections subject to erosion
     );
 
+    /// Enable/disable the parallel (Jacobi) erosion relaxation of the bulldozing effects (default: true).
+    /// If disabled, erosion is applied with a serial Gauss-Seidel sweep over the erosion domain.
+    void EnableParallelErosion(bool val);
+
     /// Set the vertical level up to which collision is tested (relative to the reference level at the sample point).
     /// Since the contact is unilateral, this could be zero. However, when computing bulldozing flow, one might also
     /// need to know if in the surrounding there is some potential future contact: so it might be better to use a
@@ -204,6 +213,26 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value of 0.8.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    /// Get all terrain characteristics at the point below the specified location.
+    virtual void GetProperties(const ChVector3d& loc,
+                               double& height,
+                               ChVector3d& normal,
+                               float& friction) const override;
+
+    /// Get the terrain heights below the specified locations.
+    /// Heights are evaluated in parallel, using the number of threads set for the containing Chrono system
+    /// (sequentially if any grid tiles are currently paged out to disk).
+    virtual void GetHeightBatch(const std::vector<ChVector3d>& locs, std::vector<double>& heights) const override;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// Heights and normals are evaluated in parallel, using the number of threads set for the containing Chrono system
+    /// (sequentially if any grid tiles are currently paged out to disk). A user-provided friction functor, if any, is
+    /// evaluated sequentially.
+    virtual void GetPropertiesBatch(const std::vector<ChVector3d>& locs,
+                                    std::vector<double>& heights,
+                                    std::vector<ChVector3d>& normals,
+                                    std::vector<float>& frictions) const override;
+
     /// Get SCM information at the node closest to the specified location.
     NodeInfo GetNodeInfo(const ChVector3d& loc) const;
 
@@ -223,6 +252,23 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// GetContactForceNode for rigid bodies and FEA nodes, respectively.
     void SetCosimulationMode(bool val);
 
+    /// Set the level-of-detail coarsening factor (default: 1).
+    /// With a factor n > 1, the undeformed terrain heights and the visualization mesh are stored on a coarse grid with
+    /// spacing n*delta, reducing memory and visualization update cost for large terrain patches. Node records are still
+    /// created on the fine grid (spacing delta), only for nodes under the moving patches that come in contact. Their
+    /// initial heights are interpolated from the coarse grid, consistent with the coarse visualization mesh. The
+    /// visualization mesh displays the terrain deformation at coarse grid vertices only. The terrain extent is
+    /// adjusted so that it contains a whole number of coarse cells. Must be called before Initialize.
+    void SetLevelOfDetail(int factor);
+
+    /// Enable paging of the SCM grid to disk (default: disabled).
+    /// Modified grid nodes are stored in square tiles. At the end of each step, if the memory used by resident tiles
+    /// exceeds the specified budget (in bytes), the least recently used tiles (not reached by any moving patch during
+    /// that step) are written to the specified file and released. Paged-out tiles are read back automatically if
+    /// accessed again. This keeps memory use bounded for very long courses; use moving patches (see AddMovingPatch)
+    /// so that only tiles near the vehicles are in use at any given step.
+    void EnableTilePaging(const std::string& filename, size_t memory_budget);
+
     /// Initialize the terrain system (flat).
     /// This version creates a flat array of points.
     void Initialize(double sizeX,  ///< [in] terrain dimension in the X direction
@@ -296,6 +342,10 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     int GetNumContactPatches() const;
     /// Return the number of nodes in the erosion domain at last step (bulldosing effects).
     int GetNumErosionNodes() const;
+    /// Return the number of grid tiles resident in memory.
+    int GetNumResidentTiles() const;
+    /// Return the number of grid tiles paged out to disk (see EnableTilePaging).
+    int GetNumPagedTiles() const;
 
     /// Return time for updating moving patches at last step (ms).
     double GetTimerMovingPatches() const;
@@ -309,6 +359,12 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     double GetTimerContactForces() const;
     /// Return time for computing bulldozing effects at last step (ms).
     double GetTimerBulldozing() const;
+    /// Return time for raising the boundaries of contact patches at last step (ms). Included in GetTimerBulldozing.
+    double GetTimerBulldozingBoundary() const;
+    /// Return time for computing the erosion domain at last step (ms). Included in GetTimerBulldozing.
+    double GetTimerBulldozingDomain() const;
+    /// Return time for applying erosion at last step (ms). Included in GetTimerBulldozing.
+    double GetTimerBulldozingErosion() const;
     /// Return time for visualization assets update at last step (ms).
     double GetTimerVisUpdate() const;
 
@@ -437,6 +493,121 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         std::size_t operator()(const ChVector2i& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Sparse tiled storage of node records.
+    // Grid nodes are grouped in square tiles of TILE_SIZE x TILE_SIZE nodes. A tile (a dense array of node records) is
+    // allocated when one of its nodes is first recorded; a bit mask identifies the recorded nodes in a tile. Tiles are
+    // located through a hash map on tile coordinates only, so that look-ups and iteration over recorded nodes access
+    // contiguous memory. Concurrent look-ups, and concurrent modification of distinct existing records, are safe;
+    // insertion of new records is not thread-safe.
+    class NodeGrid {
+      public:
+        static const int TILE_BITS = 5;
+        static const int TILE_SIZE = 1 << TILE_BITS;
+
+        NodeGrid() : m_num_nodes(0), m_num_paged(0), m_max_tiles(0), m_stamp(0) {}
+        ~NodeGrid();
+
+        // Return the record at the specified node (nullptr if the node was not recorded).
+        // The non-const version pages in the tile containing the node. The const version does not modify the set of
+        // resident tiles and can be called concurrently; records of paged-out tiles are read into a temporary copy,
+        // valid until the next call to a non-const function.
+        NodeRecord* Find(const ChVector2i& ij);
+        const NodeRecord* Find(const ChVector2i& ij) const;
+
+        // Return the record at the specified node, which must have been recorded.
+        NodeRecord& At(const ChVector2i& ij);
+        const NodeRecord& At(const ChVector2i& ij) const;
+
+        // Record the specified node, if not already recorded. Return the node record and true if newly inserted.
+        std::pair<NodeRecord*, bool> Insert(const ChVector2i& ij, const NodeRecord& nr);
+
+        // Set the record at the specified node, recording the node if needed.
+        NodeRecord& Set(const ChVector2i& ij, const NodeRecord& nr);
+
+        // Return the number of recorded nodes.
+        size_t GetNumNodes() const { return m_num_nodes; }
+
+        // Return the number of tiles (resident or paged out).
+        size_t GetNumTiles() const { return m_tiles.size() + m_num_paged; }
+
+        // Return the number of tiles resident in memory.
+        size_t GetNumResidentTiles() const { return m_tiles.size(); }
+
+        // Return the number of tiles paged out to disk.
+        size_t GetNumPagedTiles() const { return m_num_paged; }
+
+        // Return the memory used by a resident tile (bytes).
+        static size_t GetTileMemory() { return sizeof(Tile); }
+
+        // Enable paging of tiles to the specified file, keeping at most the given number of tiles resident.
+        void SetPaging(const std::string& filename, size_t max_tiles);
+
+        // Return true if paging is enabled.
+        bool IsPaging() const { return m_file.is_open(); }
+
+        // Load (if paged out) and mark as used all tiles overlapping the specified range of grid nodes.
+        // Must be called before any parallel access to nodes in this range.
+        void Prefetch(const ChVector2i& ij_min, const ChVector2i& ij_max);
+
+        // Page out least recently used tiles in excess of the maximum number of resident tiles.
+        // Tiles marked as used since the last call are never paged out.
+        // Temporary copies of paged-out tiles, read by the const version of Find, are released.
+        void PageOut();
+
+        // Remove all node records.
+        void Clear();
+
+        // Invoke the given function f(ij, nr) for all recorded nodes, tile by tile.
+        template <typename Function>
+        void ForEach(Function f) const;
+
+      private:
+        struct Tile {
+            ChVector2i origin;                                      // grid coordinates of first node in tile
+            uint64_t last_use;                                      // paging stamp of last use
+            std::array<uint32_t, TILE_SIZE> mask;                   // recorded nodes (one bit per node, row-wise)
+            std::array<NodeRecord, TILE_SIZE * TILE_SIZE> records;  // node records (row-major)
+        };
+
+        // Location of a tile in the paging file.
+        // A tile is stored as its mask, followed by the records of the recorded nodes only.
+        struct FileSlot {
+            std::streamoff offset;  // offset in paging file
+            int capacity;           // number of node records that fit in the slot
+            bool paged;             // true if the tile is currently paged out
+        };
+
+        // Coordinates of the tile containing the specified node (floor division).
+        static ChVector2i TileCoords(const ChVector2i& ij) {
+            return ChVector2i(ij.x() >> TILE_BITS, ij.y() >> TILE_BITS);
+        }
+
+        // Return the resident tile with specified tile coordinates, paging it in if needed (nullptr if no such tile).
+        Tile* GetTile(const ChVector2i& tij);
+
+        // Return a slot in the paging file able to hold the specified number of node records.
+        FileSlot AllocateSlot(int count);
+
+        void WriteTile(const Tile& tile);
+        void ReadTile(const FileSlot& slot, Tile& tile) const;
+
+        std::unordered_map<ChVector2i, Tile*, CoordHash> m_tile_map;  // tile look-up by tile coordinates
+        std::vector<std::unique_ptr<Tile>> m_tiles;                  // resident tiles
+        size_t m_num_nodes;                                          // number of recorded nodes
+
+        std::unordered_map<ChVector2i, FileSlot, CoordHash> m_slots;  // paging file slots, by tile coordinates
+        std::vector<FileSlot> m_free_slots;                           // released paging file slots
+        mutable std::fstream m_file;                                  // paging file
+        std::string m_filename;                                       // name of paging file
+        size_t m_num_paged;                                           // number of tiles paged out
+        size_t m_max_tiles;                                           // maximum number of resident tiles
+        uint64_t m_stamp;                                             // current paging stamp
+
+        typedef std::unordered_map<ChVector2i, std::unique_ptr<Tile>, CoordHash> TileCopies;
+        mutable TileCopies m_copies;        // copies of paged-out tiles read by const queries
+        mutable std::mutex m_copies_mutex;  // guards the tile copies and the paging file in const queries
+    };
+
     // Create visualization mesh
     void CreateVisualizationMesh(double sizeX, double sizeY);
 
@@ -464,13 +635,17 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Get the terrain normal (expressed in World frame) at the point below the specified location.
     ChVector3d GetNormal(const ChVector3d& loc) const;
 
+    // Get the terrain height and normal (expressed in World frame) at the point below the specified location.
+    void GetHeightNormal(const ChVector3d& loc, double& height, ChVector3d& normal) const;
+
     // Get index of trimesh vertex corresponding to the specified grid node.
     int GetMeshVertexIndex(const ChVector2i& loc);
 
     // Get indices of trimesh faces incident to the specified grid vertex.
     std::vector<int> GetMeshFaceIndices(const ChVector2i& loc);
 
-    // Check if the provided grid location is within the visualization mesh bounds
+    // Check if the provided grid location is a vertex of the visualization mesh
+    // (i.e., within the mesh bounds and on the coarse grid).
     bool CheckMeshBounds(const ChVector2i& loc) const;
 
     // Return information at node closest to specified location.
@@ -521,6 +696,15 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Remove specified amount of material (possibly clamped) from node.
     void RemoveMaterialFromNode(double amount, NodeRecord& nr);
 
+    // Apply erosion on the erosion domain with a parallel Jacobi relaxation.
+    void ErodeJacobi(double dy_lim, int nthreads);
+
+    // Apply erosion on the erosion domain with a serial Gauss-Seidel sweep.
+    void ErodeGaussSeidel(double dy_lim);
+
+    // Amount of material flowing from a node in the erosion domain to a neighbor node.
+    static double ComputeErosionFlow(const NodeRecord& nr, const NodeRecord& nbr_nr, double dy_lim);
+
     // Update vertex position and color in visualization mesh
     void UpdateMeshVertexCoordinates(const ChVector2i ij, int iv, const NodeRecord& nr);
 
@@ -542,12 +726,13 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     double m_area;         ///< area of a grid cell
     int m_nx;              ///< range for grid indices in X direction: [-m_nx, +m_nx]
     int m_ny;              ///< range for grid indices in Y direction: [-m_ny, +m_ny]
+    int m_lod;             ///< level-of-detail factor (coarse grid spacing is m_lod * m_delta)
 
-    ChMatrixDynamic<> m_heights;  ///< (base) grid heights (when initializing from height-field map)
+    ChMatrixDynamic<> m_heights;  ///< (base) coarse grid heights (when initializing from height-field map or mesh)
     double m_base_height;         ///< default height for vertices outside the projection of input mesh
 
-    std::unordered_map<ChVector2i, NodeRecord, CoordHash> m_grid_map;  ///< modified grid nodes (persistent)
-    std::vector<ChVector2i> m_modified_nodes;                          ///< modified grid nodes (current)
+    NodeGrid m_grid;                           ///< modified grid nodes (persistent)
+    std::vector<ChVector2i> m_modified_nodes;  ///< modified grid nodes (current)
 
     std::vector<MovingPatchInfo> m_patches;  ///< set of active moving patches
     bool m_moving_patch;                     ///< user-specified moving patches?
@@ -582,6 +767,14 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     double m_erosion_slope;
     int m_erosion_iterations;
     int m_erosion_propagations;
+    bool m_parallel_erosion;
+
+    // Bulldozing work data (reused across steps)
+    std::vector<ChVector2i> m_erosion_domain;                     // nodes in erosion domain
+    std::vector<ChVector2i> m_erosion_nodes;                      // erosion domain and recorded neighbors
+    std::vector<NodeRecord*> m_erosion_records;                   // records of erosion nodes
+    std::vector<std::array<NodeRecord*, 4>> m_erosion_neighbors;  // records of erosion node neighbors
+    std::vector<double> m_erosion_delta;                          // net material received by erosion nodes
 
     // Mesh coloring mode
     SCMTerrain::DataPlotType m_plot_type;
@@ -610,6 +803,37 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     friend class SCMTerrain;
 };
 
+template <typename Function>
+void SCMLoader::NodeGrid::ForEach(Function f) const {
+    auto visit = [&f](const Tile& tile) {
+        for (int j = 0; j < TILE_SIZE; j++) {
+            uint32_t row = tile.mask[j];
+            if (!row)
+                continue;
+            for (int i = 0; i < TILE_SIZE; i++) {
+                if (row & (uint32_t(1) << i))
+                    f(ChVector2i(tile.origin.x() + i, tile.origin.y() + j), tile.records[j * TILE_SIZE + i]);
+            }
+        }
+    };
+
+    for (const auto& tile : m_tiles)
+        visit(*tile);
+
+    // Read paged-out tiles in a scratch tile (without paging them in)
+    if (m_num_paged == 0)
+        return;
+    std::lock_guard<std::mutex> lock(m_copies_mutex);
+    std::unique_ptr<Tile> tile(new Tile);
+    for (const auto& slot : m_slots) {
+        if (!slot.second.paged)
+            continue;
+        tile->origin = ChVector2i(slot.first.x() * TILE_SIZE, slot.first.y() * TILE_SIZE);
+        ReadTile(slot.second, *tile);
+        visit(*tile);
+    }
+}
+
 /// @} vehicle_terrain
 
 }  // end namespace vehicle
@@ -354,11 +354,23 @@ bool ChTire::DiscTerrainCollisionEnvelope(
 
     const size_t n_div = 180;
     double x_step = 2.0 * disc_radius / n_div;
+
+    // Query the terrain heights at all test points along the disc in a single batch (the query buffers are reused
+    // across calls)
+    static thread_local std::vector<ChVector3d> locs;
+    static thread_local std::vector<double> heights;
+    locs.resize(n_div - 1);
+    for (size_t i = 1; i < n_div; i++) {
+        double x = -disc_radius + x_step * double(i);
+        locs[i - 1] = disc_center + x * longitudinal + voffset;
+    }
+    terrain.GetHeightBatch(locs, heights);
+
     double A = 0;  // overlapping area of tire disc and road surface contour
     for (size_t i = 1; i < n_div; i++) {
         double x = -disc_radius + x_step * double(i);
         ChVector3d pTest = disc_center + x * longitudinal;
-        double q = terrain.GetHeight(pTest + voffset);
+        double q = heights[i - 1];
         double a = ChWorldFrame::Height(pTest) - sqrt(disc_radius * disc_radius - x * x);
         if (q > a) {
             A += q - a;
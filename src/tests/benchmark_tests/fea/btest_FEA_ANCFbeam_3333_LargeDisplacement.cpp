@@ -63,7 +63,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, PARDISO_MKL, MUMPS };
 
 class ANCFBeamTest {
   public:
-    ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFBeamTest() { delete m_system; }
 
@@ -85,7 +85,7 @@ class ANCFBeamTest {
     int m_NumThreads;
 };
 
-ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = num_elements;
     m_NumThreads = NumThreads;
@@ -186,6 +186,8 @@ ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThre
     // Create mesh container
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
+    mesh->EnableBatchedInternalForces(useBatched);
+    mesh->EnableSharedPrecompute(useBatched);
 
     // Setup visualization
     auto vis_surf = chrono_types::make_shared<ChVisualShapeFEA>(mesh);
@@ -461,6 +463,10 @@ int main(int argc, char* argv[]) {
                         ANCFBeamTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_PreInt");
                     }
+                    {
+                        ANCFBeamTest test(num_els(i), ls, NumThreads, false, true);
+                        test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_PreIntBatched");
+                    }
 
                     if (NumThreads == MaxThreads)
                         run = false;
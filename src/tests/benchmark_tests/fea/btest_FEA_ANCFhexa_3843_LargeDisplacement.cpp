@@ -62,7 +62,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, PARDISO_MKL, MUMPS };
 
 class ANCFHexaTest {
   public:
-    ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFHexaTest() { delete m_system; }
 
@@ -84,7 +84,7 @@ class ANCFHexaTest {
     int m_NumThreads;
 };
 
-ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = 2 * num_elements * num_elements;
     m_NumThreads = NumThreads;
@@ -178,6 +178,8 @@ ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThre
     // Create mesh container
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
+    mesh->EnableBatchedInternalForces(useBatched);
+    mesh->EnableSharedPrecompute(useBatched);
 
     // Setup visualization
     auto mvisualizemesh = chrono_types::make_shared<ChVisualShapeFEA>(mesh);
@@ -482,6 +484,10 @@ int main(int argc, char* argv[]) {
                         ANCFHexaTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_PreInt");
                     }
+                    {
+                        ANCFHexaTest test(num_els(i), ls, NumThreads, false, true);
+                        test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_PreIntBatched");
+                    }
 
                     if (NumThreads == MaxThreads)
                         run = false;
@@ -62,7 +62,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, PARDISO_MKL, MUMPS };
 
 class ANCFShellTest {
   public:
-    ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFShellTest() { delete m_system; }
 
@@ -84,7 +84,11 @@ class ANCFShellTest {
     int m_NumThreads;
 };
 
-ANCFShellTest::ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFShellTest::ANCFShellTest(int num_elements,
+                             SolverType solver_type,
+                             int NumThreads,
+                             bool useContInt,
+                             bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = 2 * num_elements * num_elements;
     m_NumThreads = NumThreads;
@@ -178,6 +182,8 @@ ANCFShellTest::ANCFShellTest(int num_elements, SolverType solver_type, int NumTh
     // Create mesh container
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
+    mesh->EnableBatchedInternalForces(useBatched);
+    mesh->EnableSharedPrecompute(useBatched);
 
     // Setup visualization
     auto mvisualizemesh = chrono_types::make_shared<ChVisualShapeFEA>(mesh);
@@ -480,6 +486,10 @@ int main(int argc, char* argv[]) {
                         ANCFShellTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_PreInt");
                     }
+                    {
+                        ANCFShellTest test(num_els(i), ls, NumThreads, false, true);
+                        test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_PreIntBatched");
+                    }
 
                     if (NumThreads == MaxThreads)
                         run = false;
@@ -0,0 +1,113 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Multicore benchmark for the broadphase collision grid.
+//
+// Small spheres settle in a container made of five large boxes. The container
+// walls span the entire collision domain, so with a fine single-level grid
+// (FIXED_DENSITY) they intersect a large number of bins. With a two-level grid
+// (TWO_LEVEL) the walls are kept out of the grid and tested directly against
+// all other shapes.
+//
+// The global reference frame has Z up.
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "chrono/utils/ChUtilsGenerators.h"
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+template <ChBroadphase::GridType GRID>
+class ContainerTest : public utils::ChBenchmarkTest {
+  public:
+    ContainerTest();
+    ~ContainerTest() { delete m_system; }
+
+    virtual ChSystem* GetSystem() override { return m_system; }
+    virtual void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  private:
+    ChSystemMulticoreSMC* m_system;
+    double m_step;
+};
+
+template <ChBroadphase::GridType GRID>
+ContainerTest<GRID>::ContainerTest() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
+    m_system->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    m_system->SetNumThreads(4);
+
+    m_system->GetSettings()->solver.max_iteration_bilateral = 100;
+    m_system->GetSettings()->solver.tolerance = 1e-3;
+
+    m_system->GetSettings()->collision.narrowphase_algorithm = ChNarrowphase::Algorithm::HYBRID;
+    m_system->GetSettings()->collision.broadphase_grid = GRID;
+    m_system->GetSettings()->collision.grid_density = 2;
+    m_system->GetSettings()->collision.large_shape_bins = 64;
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(2e6f);
+    mat->SetFriction(0.4f);
+    mat->SetRestitution(0.4f);
+
+    // Container (five boxes attached to a fixed body)
+    ChVector3d hdim(2, 2, 1);
+
+    auto bin = chrono_types::make_shared<ChBody>();
+    bin->SetFixed(true);
+    bin->EnableCollision(true);
+    utils::AddBoxContainer(bin, mat,                                      //
+                           ChFrame<>(ChVector3d(0, 0, hdim.z()), QUNIT),  //
+                           hdim * 2, 0.2,                                 //
+                           ChVector3i(2, 2, -1));
+    m_system->AddBody(bin);
+
+    // Granular material
+    double radius = 0.02;
+    double r = 1.01 * radius;
+    utils::ChPDSampler<double> sampler(2 * r);
+    utils::ChGenerator gen(m_system);
+    auto m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
+    m1->SetDefaultMaterial(mat);
+    m1->SetDefaultDensity(2000);
+    m1->SetDefaultSize(radius);
+
+    ChVector3d range(hdim.x() - r, hdim.y() - r, 0);
+    ChVector3d center(0, 0, 2 * r);
+    for (int il = 0; il < 4; il++) {
+        gen.CreateObjectsBox(sampler, center, range);
+        center.z() += 2 * r;
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 100  // number of steps for hot start
+#define NUM_SIM_STEPS 100   // number of simulation steps for each benchmark
+#define REPEATS 5
+
+using ContainerTest_OneLevel = ContainerTest<ChBroadphase::GridType::FIXED_DENSITY>;
+using ContainerTest_TwoLevel = ContainerTest<ChBroadphase::GridType::TWO_LEVEL>;
+
+CH_BM_SIMULATION_LOOP(Container_OneLevel, ContainerTest_OneLevel, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_LOOP(Container_TwoLevel, ContainerTest_TwoLevel, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,114 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for parallel processing of assembly items (bodies and links).
+// A large number of independent double pendulums is simulated with an
+// increasing number of Chrono threads, using either the PSOR solver or the
+// multithreaded graph-colored PSOR solver.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORColored.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+#define NUM_PENDULUMS 10000  // number of double pendulums
+
+template <int NTHREADS>
+class AssemblyTest : public utils::ChBenchmarkTest {
+  public:
+    AssemblyTest();
+    ~AssemblyTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  protected:
+    ChSystemNSC* m_system;
+    double m_step;
+};
+
+// Same test, using the graph-colored PSOR solver with the same number of threads.
+template <int NTHREADS>
+class AssemblyTestColored : public AssemblyTest<NTHREADS> {
+  public:
+    AssemblyTestColored() {
+        auto solver = chrono_types::make_shared<ChSolverPSORColored>(NTHREADS);
+        solver->SetMaxIterations(20);
+        this->m_system->SetSolver(solver);
+    }
+};
+
+template <int NTHREADS>
+AssemblyTest<NTHREADS>::AssemblyTest() : m_step(1e-3) {
+    m_system = new ChSystemNSC;
+    m_system->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    m_system->SetNumThreads(NTHREADS, 1, 1);
+    m_system->EnableParallelLoops(NTHREADS > 1);
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(20);
+    m_system->SetSolver(solver);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    m_system->AddBody(ground);
+
+    double length = 0.5;
+    double width = 0.05;
+    for (int ip = 0; ip < NUM_PENDULUMS; ip++) {
+        ChVector3d loc(ip * 2 * width, 0, 0);
+        std::shared_ptr<ChBody> prev = ground;
+        for (int ib = 0; ib < 2; ib++) {
+            auto pend = chrono_types::make_shared<ChBodyEasyBox>(length, width, width, 1000, false, false);
+            pend->SetPos(loc + ChVector3d(0, 0, (ib + 0.5) * length));
+            pend->SetRot(QuatFromAngleY(CH_PI_2));
+            m_system->AddBody(pend);
+
+            auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+            rev->Initialize(pend, prev, ChFrame<>(loc + ChVector3d(0, 0, ib * length), QuatFromAngleY(CH_PI_2)));
+            m_system->AddLink(rev);
+
+            prev = pend;
+        }
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 50  // number of steps for hot start
+#define NUM_SIM_STEPS 100  // number of simulation steps for each benchmark
+
+CH_BM_SIMULATION_LOOP(Assembly_T1, AssemblyTest<1>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(Assembly_T2, AssemblyTest<2>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(Assembly_T4, AssemblyTest<4>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(Assembly_T8, AssemblyTest<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+
+CH_BM_SIMULATION_LOOP(AssemblyColored_T1, AssemblyTestColored<1>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(AssemblyColored_T2, AssemblyTestColored<2>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(AssemblyColored_T4, AssemblyTestColored<4>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(AssemblyColored_T8, AssemblyTestColored<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the Schur complement product of the system descriptor,
+// evaluated with the default implementation (virtual calls per constraint and
+// variable) and with compiled products (flattened 6-DOF block kernels).
+//
+// The model consists of NC pendulum chains of 20 links each, connected with
+// revolute joints (ChConstraintTwoBodies). Each benchmark "step" is one product.
+//
+// =============================================================================
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChBenchmark.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+template <int NC, bool COMPILED>
+class SchurProductTest : public utils::ChBenchmarkTest {
+  public:
+    SchurProductTest();
+    ~SchurProductTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->GetSystemDescriptor()->SchurComplementProduct(m_result, m_l); }
+
+  private:
+    ChSystemNSC* m_system;
+    ChVectorDynamic<> m_l;
+    ChVectorDynamic<> m_result;
+};
+
+template <int NC, bool COMPILED>
+SchurProductTest<NC, COMPILED>::SchurProductTest() : m_system(new ChSystemNSC()) {
+    m_system->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    m_system->AddBody(ground);
+
+    int num_links = 20;
+    double length = 0.5;
+    for (int ic = 0; ic < NC; ic++) {
+        std::shared_ptr<ChBody> prev = ground;
+        for (int il = 0; il < num_links; il++) {
+            auto link = chrono_types::make_shared<ChBodyEasyBox>(length, 0.05, 0.05, 1000, false, false);
+            link->SetPos(ChVector3d((il + 0.5) * length, 3, ic * 0.2));
+            m_system->AddBody(link);
+
+            auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+            rev->Initialize(link, prev, ChFrame<>(ChVector3d(il * length, 3, ic * 0.2)));
+            m_system->AddLink(rev);
+
+            prev = link;
+        }
+    }
+
+    // Take one step to load the descriptor, then prepare the compiled arrays (if enabled)
+    m_system->DoStepDynamics(1e-3);
+
+    auto& sysd = *m_system->GetSystemDescriptor();
+    sysd.EnableCompiledProducts(COMPILED);
+    sysd.UpdateCompiledProducts();
+
+    m_l = ChVectorDynamic<>::Random(sysd.CountActiveConstraints());
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 10  // number of products for hot start
+#define NUM_SIM_STEPS 100  // number of products for each benchmark
+
+using SchurProduct0100_default = SchurProductTest<100, false>;
+using SchurProduct0100_compiled = SchurProductTest<100, true>;
+using SchurProduct1000_default = SchurProductTest<1000, false>;
+using SchurProduct1000_compiled = SchurProductTest<1000, true>;
+
+CH_BM_SIMULATION_LOOP(Schur0100_default, SchurProduct0100_default, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(Schur0100_compiled, SchurProduct0100_compiled, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+CH_BM_SIMULATION_LOOP(Schur1000_default, SchurProduct1000_default, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(Schur1000_compiled, SchurProduct1000_compiled, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -18,6 +18,7 @@
 
 #include "chrono/ChConfig.h"
 #include "chrono/core/ChRandom.h"
+#include "chrono/solver/ChSolverPSORColored.h"
 #include "chrono/utils/ChBenchmark.h"
 
 #include "chrono/physics/ChSystemNSC.h"
@@ -35,7 +36,7 @@ using namespace chrono;
 template <int N>
 class MixerTestNSC : public utils::ChBenchmarkTest {
   public:
-    MixerTestNSC();
+    MixerTestNSC(bool pooled_contacts = false);
     ~MixerTestNSC() { delete m_system; }
 
     ChSystem* GetSystem() override { return m_system; }
@@ -43,13 +44,13 @@ class MixerTestNSC : public utils::ChBenchmarkTest {
 
     void SimulateVis();
 
-  private:
+  protected:
     ChSystemNSC* m_system;
     double m_step;
 };
 
 template <int N>
-MixerTestNSC<N>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
+MixerTestNSC<N>::MixerTestNSC(bool pooled_contacts) : m_system(new ChSystemNSC(pooled_contacts)), m_step(0.02) {
     m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
 
     auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
@@ -127,6 +128,20 @@ void MixerTestNSC<N>::SimulateVis() {
 #endif
 }
 
+// Same test, with pooled storage of contact objects in the NSC contact container.
+template <int N>
+class MixerTestNSCPooled : public MixerTestNSC<N> {
+  public:
+    MixerTestNSCPooled() : MixerTestNSC<N>(true) {}
+};
+
+// Same test, using the graph-colored PSOR solver with 4 threads.
+template <int N>
+class MixerTestNSCColored : public MixerTestNSC<N> {
+  public:
+    MixerTestNSCColored() { this->m_system->SetSolver(chrono_types::make_shared<ChSolverPSORColored>(4)); }
+};
+
 // =============================================================================
 
 #define NUM_SKIP_STEPS 2000  // number of steps for hot start
@@ -135,6 +150,12 @@ void MixerTestNSC<N>::SimulateVis() {
 CH_BM_SIMULATION_LOOP(MixerNSC032, MixerTestNSC<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(MixerNSC064, MixerTestNSC<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+CH_BM_SIMULATION_LOOP(MixerNSC032_pooled, MixerTestNSCPooled<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC064_pooled, MixerTestNSCPooled<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+CH_BM_SIMULATION_LOOP(MixerNSC032_colored, MixerTestNSCColored<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerNSC064_colored, MixerTestNSCColored<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for terrain queries on a RigidTerrain mesh patch.
+// Compares the throughput of GetProperties when using ray casting into the
+// collision system and when using the precomputed mesh query index.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/core/ChRandom.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+template <bool INDEXED>
+class TerrainFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        m_system = new ChSystemSMC();
+        m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+        m_terrain = new RigidTerrain(m_system);
+        m_terrain->UseMeshQueryIndex(INDEXED);
+        auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+        m_terrain->AddPatch(mat, ChCoordsys<>(), vehicle::GetDataFile("terrain/meshes/test_patch.obj"), true, 0, false);
+        m_terrain->Initialize();
+        m_system->GetCollisionSystem()->Initialize();
+
+        // Query locations above the mesh patch
+        ChUniformDistribution x_dist(-22, 0);
+        ChUniformDistribution y_dist(0, 42);
+        m_locations.resize(10000);
+        for (auto& loc : m_locations)
+            loc = ChVector3d(x_dist.GetRandom(), y_dist.GetRandom(), 20);
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        delete m_terrain;
+        delete m_system;
+    }
+
+  protected:
+    ChSystemSMC* m_system;
+    RigidTerrain* m_terrain;
+    std::vector<ChVector3d> m_locations;
+};
+
+#define BM_TERRAIN_QUERIES(TEST_NAME, INDEXED)                                               \
+    BENCHMARK_TEMPLATE_DEFINE_F(TerrainFixture, TEST_NAME, INDEXED)(benchmark::State & st) { \
+        double height;                                                                       \
+        ChVector3d normal;                                                                   \
+        float friction;                                                                      \
+        for (auto _ : st) {                                                                  \
+            for (const auto& loc : m_locations) {                                            \
+                m_terrain->GetProperties(loc, height, normal, friction);                     \
+                benchmark::DoNotOptimize(height);                                            \
+            }                                                                                \
+        }                                                                                    \
+        double num_queries = (double)st.iterations() * m_locations.size();                   \
+        auto rate = benchmark::Counter(num_queries, benchmark::Counter::kIsRate);            \
+        st.counters["Queries"] = rate;                                                       \
+    }                                                                                        \
+    BENCHMARK_REGISTER_F(TerrainFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
+BM_TERRAIN_QUERIES(RayCast, false)
+BM_TERRAIN_QUERIES(QueryIndex, true)
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
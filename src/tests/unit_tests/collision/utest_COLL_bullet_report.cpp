@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for multithreaded contact reporting in the Bullet collision system.
+//
+// Contacts between a set of spheres and boxes resting on a ground box are
+// reported to the NSC and SMC contact containers with one thread and with
+// multiple threads. The two lists of contacts (including their order and, for
+// SMC, the contact forces) must be identical.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+// Collect the contacts in the container, in the order in which they are stored
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        objA.push_back(contactobjA);
+        objB.push_back(contactobjB);
+        pointA.push_back(pA);
+        dist.push_back(distance);
+        force.push_back(react_forces);
+        return true;
+    }
+
+    std::vector<ChContactable*> objA;
+    std::vector<ChContactable*> objB;
+    std::vector<ChVector3d> pointA;
+    std::vector<double> dist;
+    std::vector<ChVector3d> force;
+};
+
+std::shared_ptr<ContactCollector> ReportContacts(ChSystem& sys, int nthreads) {
+    // Threads used by both the collision system and the contact container
+    sys.SetNumThreads(nthreads);
+    sys.GetCollisionSystem()->ReportContacts(sys.GetContactContainer().get());
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    return collector;
+}
+
+void CreateBodies(ChSystem& sys, std::shared_ptr<ChContactMaterial> mat) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    // Slightly interpenetrating spheres and boxes, the lowest layer resting on the ground
+    for (int ix = 0; ix < 12; ix++) {
+        for (int iy = 0; iy < 2; iy++) {
+            for (int iz = 0; iz < 12; iz++) {
+                ChVector3d pos(-3.3 + 0.6 * ix, 0.29 + 0.58 * iy, -3.3 + 0.6 * iz);
+                std::shared_ptr<ChBody> body;
+                if ((ix + iz) % 2 == 0)
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.3, 1000, false, true, mat);
+                else
+                    body = chrono_types::make_shared<ChBodyEasyBox>(0.6, 0.6, 0.6, 1000, false, true, mat);
+                body->SetPos(pos);
+                sys.AddBody(body);
+            }
+        }
+    }
+
+    sys.GetCollisionSystem()->Initialize();
+    sys.Setup();
+    sys.ComputeCollisions();
+}
+
+void CompareContacts(ChSystem& sys) {
+    auto contacts_ref = ReportContacts(sys, 1);
+    auto contacts = ReportContacts(sys, 4);
+
+    ASSERT_GT(contacts_ref->objA.size(), 0u);
+    ASSERT_EQ(contacts->objA.size(), contacts_ref->objA.size());
+    for (size_t i = 0; i < contacts->objA.size(); i++) {
+        ASSERT_EQ(contacts->objA[i], contacts_ref->objA[i]);
+        ASSERT_EQ(contacts->objB[i], contacts_ref->objB[i]);
+        ASSERT_EQ(contacts->pointA[i], contacts_ref->pointA[i]);
+        ASSERT_EQ(contacts->dist[i], contacts_ref->dist[i]);
+        ASSERT_EQ(contacts->force[i], contacts_ref->force[i]);
+    }
+}
+
+TEST(ChCollisionSystemBullet, report_contacts_NSC) {
+    ChSystemNSC sys;
+    CreateBodies(sys, chrono_types::make_shared<ChContactMaterialNSC>());
+    CompareContacts(sys);
+}
+
+TEST(ChCollisionSystemBullet, report_contacts_SMC) {
+    ChSystemSMC sys;
+    CreateBodies(sys, chrono_types::make_shared<ChContactMaterialSMC>());
+    CompareContacts(sys);
+}
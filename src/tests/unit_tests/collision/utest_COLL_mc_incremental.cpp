@@ -0,0 +1,147 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the incremental broadphase of the multicore collision system.
+//
+// Two identical systems (a lattice of touching spheres on a large ground box)
+// are processed with a full broadphase rebuild at each step and with the
+// incremental broadphase, respectively. At each step, a few spheres are moved
+// (some of them outside the current collision domain) or have their state
+// changed. The two lists of contacts must be identical, in the same order.
+//
+// =============================================================================
+
+#include <tuple>
+
+#include "gtest/gtest.h"
+
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+typedef std::tuple<unsigned int, unsigned int, double, double, double> ContactData;
+
+// Collect the contacts in the system as (body A, body B, point on A), in the order of the contact container
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        auto bodyA = dynamic_cast<ChBody*>(contactobjA);
+        auto bodyB = dynamic_cast<ChBody*>(contactobjB);
+        if (bodyA->GetIndex() < bodyB->GetIndex())
+            contacts.push_back(std::make_tuple(bodyA->GetIndex(), bodyB->GetIndex(), pA.x(), pA.y(), pA.z()));
+        else
+            contacts.push_back(std::make_tuple(bodyB->GetIndex(), bodyA->GetIndex(), pB.x(), pB.y(), pB.z()));
+        return true;
+    }
+
+    std::vector<ContactData> contacts;
+};
+
+std::vector<ContactData> GetContacts(ChSystem& sys) {
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    return collector->contacts;
+}
+
+void CreateSystem(ChSystemNSC& sys, ChBroadphase::GridType grid, bool incremental) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    auto coll_sys = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+    if (grid == ChBroadphase::GridType::TWO_LEVEL)
+        coll_sys->SetBroadphaseGridTwoLevel(1, 16);
+    else
+        coll_sys->SetBroadphaseGridDensity(1);
+    coll_sys->SetBroadphaseIncremental(incremental);
+    coll_sys->SetEnvelope(0.01);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 0.2, 4, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.1, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    // Lattice of touching spheres, the lowest layer resting on the ground
+    double radius = 0.1;
+    for (int ix = 0; ix < 10; ix++) {
+        for (int iy = 0; iy < 2; iy++) {
+            for (int iz = 0; iz < 10; iz++) {
+                auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+                sphere->SetPos(ChVector3d(-0.9 + 2 * radius * ix, radius + 2 * radius * iy, -0.9 + 2 * radius * iz));
+                sys.AddBody(sphere);
+            }
+        }
+    }
+
+    sys.GetCollisionSystem()->Initialize();
+    sys.Setup();
+}
+
+class IncrementalTest : public ::testing::TestWithParam<ChBroadphase::GridType> {};
+
+TEST_P(IncrementalTest, compare_full) {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys;
+    CreateSystem(sys_ref, GetParam(), false);
+    CreateSystem(sys, GetParam(), true);
+
+    const auto& bodies_ref = sys_ref.GetBodies();
+    const auto& bodies = sys.GetBodies();
+    int num_bodies = (int)bodies.size();
+
+    for (int it = 0; it < 50; it++) {
+        // Displace a few spheres; every 10 steps, move one sphere outside the collision domain
+        for (int k = 0; k < 3; k++) {
+            int i = 1 + (7 * it + 31 * k) % (num_bodies - 1);
+            ChVector3d disp(0.03 * ((it + k) % 3 - 1), 0.02 * (k % 2), 0.04 * ((it + 2 * k) % 3 - 1));
+            if (it % 10 == 9 && k == 0)
+                disp = ChVector3d(0, 2.0, 0);
+            bodies_ref[i]->SetPos(bodies_ref[i]->GetPos() + disp);
+            bodies[i]->SetPos(bodies[i]->GetPos() + disp);
+        }
+
+        // Change the state of one sphere
+        int j = 1 + (13 * it) % (num_bodies - 1);
+        bodies_ref[j]->SetFixed(!bodies_ref[j]->IsFixed());
+        bodies[j]->SetFixed(!bodies[j]->IsFixed());
+
+        sys_ref.ComputeCollisions();
+        sys.ComputeCollisions();
+
+        auto contacts_ref = GetContacts(sys_ref);
+        auto contacts = GetContacts(sys);
+        ASSERT_GT(contacts_ref.size(), 0u);
+        ASSERT_EQ(contacts.size(), contacts_ref.size());
+        for (size_t ic = 0; ic < contacts.size(); ic++) {
+            ASSERT_EQ(std::get<0>(contacts[ic]), std::get<0>(contacts_ref[ic]));
+            ASSERT_EQ(std::get<1>(contacts[ic]), std::get<1>(contacts_ref[ic]));
+            ASSERT_NEAR(std::get<2>(contacts[ic]), std::get<2>(contacts_ref[ic]), 1e-12);
+            ASSERT_NEAR(std::get<3>(contacts[ic]), std::get<3>(contacts_ref[ic]), 1e-12);
+            ASSERT_NEAR(std::get<4>(contacts[ic]), std::get<4>(contacts_ref[ic]), 1e-12);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChCollisionSystemMulticore,
+                         IncrementalTest,
+                         ::testing::Values(ChBroadphase::GridType::FIXED_DENSITY, ChBroadphase::GridType::TWO_LEVEL));
@@ -0,0 +1,131 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Tests for triangle mesh collision shapes in the multicore collision system.
+//
+// A fixed body carries a flat triangulated grid (represented as a single mesh
+// shape with a BVH over its faces).
+// - ray test: vertical rays must hit the grid plane (and only within its extent)
+// - contact test: a sphere and a box dropped on the grid must come to rest on it
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+// Create a fixed body with a flat square grid mesh (in its x-z plane) of given half-size and resolution
+std::shared_ptr<ChBody> CreateGround(ChSystem& sys, double hsize, int n, std::shared_ptr<ChContactMaterial> mat) {
+    auto mesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+    auto& vertices = mesh->GetCoordsVertices();
+    auto& faces = mesh->GetIndicesVertexes();
+    double delta = 2 * hsize / n;
+    for (int ix = 0; ix <= n; ix++) {
+        for (int iz = 0; iz <= n; iz++) {
+            vertices.push_back(ChVector3d(-hsize + ix * delta, 0, -hsize + iz * delta));
+        }
+    }
+    for (int ix = 0; ix < n; ix++) {
+        for (int iz = 0; iz < n; iz++) {
+            int v0 = ix * (n + 1) + iz;
+            int v1 = v0 + 1;
+            int v2 = v0 + (n + 1);
+            int v3 = v2 + 1;
+            faces.push_back(ChVector3i(v0, v1, v2));
+            faces.push_back(ChVector3i(v1, v3, v2));
+        }
+    }
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetPos(ChVector3d(0.3, -0.5, 0.2));
+    ground->SetRot(QuatFromAngleY(CH_PI / 6));
+    ground->SetFixed(true);
+    ground->EnableCollision(true);
+    auto shape = chrono_types::make_shared<ChCollisionShapeTriangleMesh>(mat, mesh, true, false, 0.0);
+    ground->AddCollisionShape(shape);
+    sys.AddBody(ground);
+
+    return ground;
+}
+
+TEST(ChCollisionSystemMulticore, trimesh_ray) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    auto ground = CreateGround(sys, 2.0, 32, mat);
+
+    // Advance one step to update the collision system (all bodies are fixed)
+    sys.DoStepDynamics(1e-3);
+
+    auto coll_sys = sys.GetCollisionSystem();
+
+    // Rays within the grid extent (expressed in the ground frame) hit the grid plane
+    for (int i = 0; i < 20; i++) {
+        ChVector3d loc(-1.93 + 0.19 * i, 0, 1.81 - 0.19 * i);
+        ChVector3d point = ground->TransformPointLocalToParent(loc);
+        ChCollisionSystem::ChRayhitResult result;
+        bool hit = coll_sys->RayHit(point + ChVector3d(0, 2, 0), point - ChVector3d(0, 2, 0), result);
+        ASSERT_TRUE(hit);
+        ASSERT_EQ(result.hitModel, ground->GetCollisionModel().get());
+        ASSERT_NEAR((result.abs_hitPoint - point).Length(), 0.0, 1e-8);
+        ASSERT_NEAR((result.abs_hitNormal - ChVector3d(0, 1, 0)).Length(), 0.0, 1e-8);
+        ASSERT_NEAR(result.dist_factor, 0.5, 1e-8);
+    }
+
+    // Rays outside the grid extent miss
+    for (int i = 0; i < 20; i++) {
+        ChVector3d loc(2.1 + 0.1 * i, 0, -2.0 + 0.2 * i);
+        ChVector3d point = ground->TransformPointLocalToParent(loc);
+        ChCollisionSystem::ChRayhitResult result;
+        ASSERT_FALSE(coll_sys->RayHit(point + ChVector3d(0, 2, 0), point - ChVector3d(0, 2, 0), result));
+    }
+}
+
+TEST(ChCollisionSystemMulticore, trimesh_contact) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = CreateGround(sys, 2.0, 32, mat);
+
+    double radius = 0.2;
+    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+    sphere->SetPos(ChVector3d(-0.5, 0.0, 0.3));
+    sys.AddBody(sphere);
+
+    double hheight = 0.1;
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 2 * hheight, 0.4, 1000, false, true, mat);
+    box->SetPos(ChVector3d(0.6, 0.0, -0.4));
+    sys.AddBody(box);
+
+    double step = 1e-3;
+    for (int i = 0; i < 1000; i++)
+        sys.DoStepDynamics(step);
+
+    // Both bodies rest on the grid (whose plane is at the height of the ground body)
+    double height = ground->GetPos().y();
+    ASSERT_GT(sys.GetNumContacts(), 0u);
+    ASSERT_NEAR(sphere->GetPos().y(), height + radius, 1e-2);
+    ASSERT_NEAR(box->GetPos().y(), height + hheight, 1e-2);
+    ASSERT_LT(sphere->GetPosDt().Length(), 1e-2);
+    ASSERT_LT(box->GetPosDt().Length(), 1e-2);
+}
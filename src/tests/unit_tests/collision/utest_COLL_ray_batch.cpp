@@ -0,0 +1,96 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for batched ray-hit tests.
+//
+// A grid of vertical rays is cast onto a set of spheres and boxes, once ray by
+// ray (RayHit) and once as a batch (RayHitBatch) using multiple threads. The
+// two sets of results must be identical.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+class RayBatchTest : public ::testing::TestWithParam<ChCollisionSystem::Type> {};
+
+TEST_P(RayBatchTest, compare_single) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(GetParam());
+    sys.SetNumThreads(1, 4, 1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    for (int i = 0; i < 4; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.4, 1000, false, true, mat);
+        sphere->SetPos(ChVector3d(-1.5 + i, 0.5 * i, -1.0));
+        sphere->SetFixed(true);
+        sys.AddBody(sphere);
+
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.6, 0.3, 0.6, 1000, false, true, mat);
+        box->SetPos(ChVector3d(-1.5 + i, -0.5 * i, 1.0));
+        box->SetFixed(true);
+        sys.AddBody(box);
+    }
+
+    // Advance one step to update the collision system (all bodies are fixed)
+    sys.DoStepDynamics(1e-3);
+
+    // Grid of vertical rays, ordered row by row
+    std::vector<ChVector3d> from;
+    std::vector<ChVector3d> to;
+    int n = 64;
+    for (int ix = 0; ix < n; ix++) {
+        for (int iz = 0; iz < n; iz++) {
+            double x = -2.5 + 5.0 * ix / (n - 1);
+            double z = -2.0 + 4.0 * iz / (n - 1);
+            from.push_back(ChVector3d(x, 5, z));
+            to.push_back(ChVector3d(x, -5, z));
+        }
+    }
+
+    auto coll_sys = sys.GetCollisionSystem();
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    int num_hits = coll_sys->RayHitBatch(from, to, results);
+    ASSERT_EQ(results.size(), from.size());
+    ASSERT_GT(num_hits, 0);
+
+    int num_hits_single = 0;
+    for (size_t i = 0; i < from.size(); i++) {
+        ChCollisionSystem::ChRayhitResult result;
+        bool hit = coll_sys->RayHit(from[i], to[i], result);
+        ASSERT_EQ(hit, results[i].hit);
+        if (!hit)
+            continue;
+        num_hits_single++;
+        ASSERT_EQ(result.hitModel, results[i].hitModel);
+        ASSERT_NEAR((result.abs_hitPoint - results[i].abs_hitPoint).Length(), 0.0, 1e-12);
+        ASSERT_NEAR(result.dist_factor, results[i].dist_factor, 1e-12);
+    }
+    ASSERT_EQ(num_hits, num_hits_single);
+}
+
+#ifdef CHRONO_COLLISION
+INSTANTIATE_TEST_SUITE_P(ChCollisionSystem,
+                         RayBatchTest,
+                         ::testing::Values(ChCollisionSystem::Type::BULLET, ChCollisionSystem::Type::MULTICORE));
+#else
+INSTANTIATE_TEST_SUITE_P(ChCollisionSystem, RayBatchTest, ::testing::Values(ChCollisionSystem::Type::BULLET));
+#endif
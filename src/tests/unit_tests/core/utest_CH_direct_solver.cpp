@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for reuse of the symbolic factorization in sparse direct solvers.
+//
+// A sequence of linear systems with the same sparsity pattern (but different
+// values) is solved with the Eigen SparseLU and SparseQR solvers. The symbolic
+// analysis must be performed only once, until the sparsity pattern changes, and
+// the solutions must match those obtained with a full factorization.
+//
+// =============================================================================
+
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// ------------------------------------------------------------------
+
+// Load a tridiagonal (and optionally two additional off-diagonal) matrix with values depending on 'scale'.
+// As for Chrono system matrices, the sparsity pattern is structurally symmetric.
+void LoadMatrix(ChSparseMatrix& A, int n, double scale, bool extra) {
+    A.resize(n, n);
+    A.setZero();
+    for (int i = 0; i < n; i++) {
+        A.insert(i, i) = 4.0 * scale + i;
+        if (i > 0)
+            A.insert(i, i - 1) = -1.0;
+        if (i < n - 1)
+            A.insert(i, i + 1) = -1.0 * scale;
+    }
+    if (extra) {
+        A.insert(0, n - 1) = 0.5;
+        A.insert(n - 1, 0) = 0.25;
+    }
+    A.makeCompressed();
+}
+
+void TestReuse(ChDirectSolverLS& solver, ChDirectSolverLS& solver_ref) {
+    const int n = 50;
+    solver.ReuseSymbolicFactorization(true);
+    solver_ref.ReuseSymbolicFactorization(false);
+
+    ChVectorDynamic<> rhs(n);
+    for (int i = 0; i < n; i++)
+        rhs(i) = 1.0 + 0.1 * i;
+
+    for (int k = 0; k < 6; k++) {
+        // Change the sparsity pattern for the last two systems
+        bool extra = (k >= 4);
+        LoadMatrix(solver.A(), n, 1.0 + 0.5 * k, extra);
+        solver.b() = rhs;
+
+        ASSERT_TRUE(solver.SetupCurrent());
+        solver.SolveCurrent();
+
+        double res_norm = (solver.A() * solver.x() - rhs).norm();
+        ASSERT_LT(res_norm, 1e-10);
+
+        LoadMatrix(solver_ref.A(), n, 1.0 + 0.5 * k, extra);
+        solver_ref.b() = rhs;
+        ASSERT_TRUE(solver_ref.SetupCurrent());
+        solver_ref.SolveCurrent();
+        ASSERT_LT((solver.x() - solver_ref.x()).norm(), 1e-12);
+
+        // Symbolic analysis at first call and when the pattern changes
+        unsigned int expected_analyze = extra ? 2 : 1;
+        ASSERT_EQ(solver.GetNumAnalyzeCalls(), expected_analyze);
+    }
+
+    ASSERT_EQ(solver.GetNumSetupCalls(), 6u);
+    ASSERT_LE(solver.GetTimeSetup_SolverCallAnalyze(), solver.GetTimeSetup_SolverCall());
+}
+
+TEST(ChDirectSolverLS, reuse_symbolic_LU) {
+    ChSolverSparseLU solver;
+    ChSolverSparseLU solver_ref;
+    TestReuse(solver, solver_ref);
+}
+
+TEST(ChDirectSolverLS, reuse_symbolic_QR) {
+    ChSolverSparseQR solver;
+    ChSolverSparseQR solver_ref;
+    TestReuse(solver, solver_ref);
+}
@@ -0,0 +1,185 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the batched evaluation of ANCF internal forces in ChMesh.
+//
+// A cantilever of ANCF 3243 beam elements ("Pre-Integration" method) is
+// simulated with and without batched internal forces. All elements but the last
+// one have the same dimensions and material and, with shared precomputed
+// matrices, are therefore evaluated in batches; the last (longer) element is
+// evaluated individually. The results
+// must not depend on the evaluation mode (up to the summation order of the
+// internal forces).
+//
+// Elements are batched if their precomputed matrices match within the tolerance
+// used for sharing these matrices, even if sharing is disabled.
+//
+// A third test checks that the "Pre-Integration" precomputed matrices are
+// shared between the identical elements and that the results do not depend on
+// whether they are shared. Sharing is enabled either on each element or for
+// the entire mesh.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementBeamANCF_3243.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// =============================================================================
+
+const int num_elements = 16;
+
+std::unique_ptr<ChSystemSMC> CreateSystem(bool batched,
+                                          bool shared,
+                                          std::shared_ptr<ChMesh>& mesh,
+                                          std::vector<std::shared_ptr<ChNodeFEAxyzDDD>>& nodes) {
+    auto sys = chrono_types::make_unique<ChSystemSMC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys->SetNumThreads(4);
+    sys->SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+
+    auto material = chrono_types::make_shared<ChMaterialBeamANCF>(7850, 2e9, 0.3, 10 * (1 + 0.3) / (12 + 11 * 0.3),
+                                                                  10 * (1 + 0.3) / (12 + 11 * 0.3));
+
+    mesh = chrono_types::make_shared<ChMesh>();
+    mesh->EnableBatchedInternalForces(batched);
+
+    double dx = 0.1;
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(0, 0, 0));
+    nodeA->SetFixed(true);
+    mesh->AddNode(nodeA);
+    nodes.push_back(nodeA);
+
+    double x = 0;
+    for (int i = 0; i <= num_elements; i++) {
+        double length = (i < num_elements) ? dx : 2 * dx;
+        x += length;
+
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(x, 0, 0));
+        mesh->AddNode(nodeB);
+
+        auto element = chrono_types::make_shared<ChElementBeamANCF_3243>();
+        element->SetNodes(nodeA, nodeB);
+        element->SetDimensions(length, 0.02, 0.02);
+        element->SetMaterial(material);
+        element->SetAlphaDamp(0.01);
+        element->SetIntFrcCalcMethod(ChElementBeamANCF_3243::IntFrcMethod::PreInt);
+        element->EnableSharedPrecompute(shared);
+        mesh->AddElement(element);
+
+        nodes.push_back(nodeB);
+        nodeA = nodeB;
+    }
+
+    sys->Add(mesh);
+
+    return sys;
+}
+
+TEST(ChMesh, ANCF_batched) {
+    std::shared_ptr<ChMesh> mesh_ref;
+    std::shared_ptr<ChMesh> mesh;
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> nodes_ref;
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> nodes;
+    auto sys_ref = CreateSystem(false, false, mesh_ref, nodes_ref);
+    auto sys = CreateSystem(true, true, mesh, nodes);
+
+    double step = 1e-3;
+    for (int i = 0; i < 50; i++) {
+        sys_ref->DoStepDynamics(step);
+        sys->DoStepDynamics(step);
+    }
+
+    ASSERT_EQ(mesh_ref->GetNumBatchedElements(), 0u);
+    ASSERT_EQ(mesh->GetNumBatchedElements(), (unsigned int)num_elements);
+
+    ASSERT_EQ(nodes_ref.size(), nodes.size());
+    ASSERT_LT(nodes_ref.back()->GetPos().z(), 0.0);
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_NEAR((nodes[i]->GetPos() - nodes_ref[i]->GetPos()).Length(), 0.0, 1e-8);
+        ASSERT_NEAR((nodes[i]->GetSlope1() - nodes_ref[i]->GetSlope1()).Length(), 0.0, 1e-8);
+        ASSERT_NEAR((nodes[i]->GetPosDt() - nodes_ref[i]->GetPosDt()).Length(), 0.0, 1e-6);
+    }
+}
+
+TEST(ChMesh, ANCF_batched_unshared) {
+    std::shared_ptr<ChMesh> mesh_ref;
+    std::shared_ptr<ChMesh> mesh;
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> nodes_ref;
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> nodes;
+    auto sys_ref = CreateSystem(false, false, mesh_ref, nodes_ref);
+    auto sys = CreateSystem(true, false, mesh, nodes);
+
+    double step = 1e-3;
+    for (int i = 0; i < 50; i++) {
+        sys_ref->DoStepDynamics(step);
+        sys->DoStepDynamics(step);
+    }
+
+    ASSERT_EQ(mesh->GetNumBatchedElements(), (unsigned int)num_elements);
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_NEAR((nodes[i]->GetPos() - nodes_ref[i]->GetPos()).Length(), 0.0, 1e-8);
+        ASSERT_NEAR((nodes[i]->GetPosDt() - nodes_ref[i]->GetPosDt()).Length(), 0.0, 1e-6);
+    }
+}
+
+TEST(ChElementANCF, shared_precompute) {
+    std::shared_ptr<ChMesh> mesh_ref;
+    std::shared_ptr<ChMesh> mesh;
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> nodes_ref;
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> nodes;
+
+    auto sys_ref = CreateSystem(false, false, mesh_ref, nodes_ref);
+    auto sys = CreateSystem(false, true, mesh, nodes);
+
+    double step = 1e-3;
+    for (int i = 0; i < 50; i++) {
+        sys_ref->DoStepDynamics(step);
+        sys->DoStepDynamics(step);
+    }
+
+    auto first_ref = std::dynamic_pointer_cast<ChElementBeamANCF_3243>(mesh_ref->GetElement(0));
+    auto first = std::dynamic_pointer_cast<ChElementBeamANCF_3243>(mesh->GetElement(0));
+    auto last = std::dynamic_pointer_cast<ChElementBeamANCF_3243>(mesh->GetElement(num_elements));
+    ASSERT_EQ(first_ref->GetPrecomputeUseCount(), 1);
+    ASSERT_EQ(first->GetPrecomputeUseCount(), num_elements);
+    ASSERT_EQ(last->GetPrecomputeUseCount(), 1);
+
+    ASSERT_EQ(nodes_ref.size(), nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_NEAR((nodes[i]->GetPos() - nodes_ref[i]->GetPos()).Length(), 0.0, 1e-8);
+        ASSERT_NEAR((nodes[i]->GetPosDt() - nodes_ref[i]->GetPosDt()).Length(), 0.0, 1e-6);
+    }
+}
+
+TEST(ChMesh, shared_precompute) {
+    std::shared_ptr<ChMesh> mesh;
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> nodes;
+
+    // Sharing disabled on all elements, but enabled for the mesh
+    auto sys = CreateSystem(false, false, mesh, nodes);
+    mesh->EnableSharedPrecompute(true);
+    sys->DoStepDynamics(1e-3);
+
+    auto first = std::dynamic_pointer_cast<ChElementBeamANCF_3243>(mesh->GetElement(0));
+    auto last = std::dynamic_pointer_cast<ChElementBeamANCF_3243>(mesh->GetElement(num_elements));
+    ASSERT_TRUE(first->IsSharedPrecomputeEnabled());
+    ASSERT_EQ(first->GetPrecomputeUseCount(), num_elements);
+    ASSERT_EQ(last->GetPrecomputeUseCount(), 1);
+}
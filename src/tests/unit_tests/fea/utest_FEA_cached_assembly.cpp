@@ -0,0 +1,113 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the cached assembly of the system matrix in ChSystemDescriptor.
+//
+// A cantilever ANCF cable (stiffness blocks and a node-frame constraint) is
+// simulated with a direct sparse solver with locked sparsity pattern, with and
+// without cached assembly. After the first steps, the system matrix must be
+// assembled through the cached slot map, and the results must be identical.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementCableANCF.h"
+#include "chrono/fea/ChLinkNodeFrame.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// =============================================================================
+
+const int num_elements = 10;
+
+std::unique_ptr<ChSystemSMC> CreateSystem(bool cached, std::shared_ptr<ChMesh>& mesh) {
+    auto sys = chrono_types::make_unique<ChSystemSMC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys->SetNumThreads(2);
+    sys->GetSystemDescriptor()->EnableCachedAssembly(cached);
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    sys->SetSolver(solver);
+
+    auto section = chrono_types::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.01);
+    section->SetYoungModulus(1e8);
+    section->SetDensity(1000);
+
+    mesh = chrono_types::make_shared<ChMesh>();
+    double length = 1.0;
+    std::shared_ptr<ChNodeFEAxyzD> prev;
+    for (int i = 0; i <= num_elements; i++) {
+        auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector3d(i * length / num_elements, 0, 0),
+                                                             ChVector3d(1, 0, 0));
+        mesh->AddNode(node);
+        if (prev) {
+            auto element = chrono_types::make_shared<ChElementCableANCF>();
+            element->SetNodes(prev, node);
+            element->SetSection(section);
+            mesh->AddElement(element);
+        }
+        prev = node;
+    }
+    sys->Add(mesh);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    auto hinge = chrono_types::make_shared<ChLinkNodeFrame>();
+    hinge->Initialize(std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(0)), ground);
+    sys->Add(hinge);
+
+    return sys;
+}
+
+TEST(ChSystemDescriptor, cached_assembly) {
+    std::shared_ptr<ChMesh> mesh_ref;
+    std::shared_ptr<ChMesh> mesh;
+    auto sys_ref = CreateSystem(false, mesh_ref);
+    auto sys = CreateSystem(true, mesh);
+
+    double step = 1e-3;
+    int num_steps = 50;
+    for (int i = 0; i < num_steps; i++) {
+        sys_ref->DoStepDynamics(step);
+        sys->DoStepDynamics(step);
+    }
+
+    // All but the first assemblies (pattern learning and slot map recording) use the cached slot map
+    ASSERT_EQ(sys_ref->GetSystemDescriptor()->GetNumCachedAssemblies(), 0u);
+    ASSERT_GE(sys->GetSystemDescriptor()->GetNumCachedAssemblies(), (unsigned int)(num_steps - 2));
+
+    // The assembled matrices, and hence the results, are identical
+    for (unsigned int i = 0; i < mesh->GetNumNodes(); i++) {
+        auto node_ref = std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh_ref->GetNode(i));
+        auto node = std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(i));
+        ASSERT_NEAR((node->GetPos() - node_ref->GetPos()).Length(), 0.0, 1e-12);
+        ASSERT_NEAR((node->GetPosDt() - node_ref->GetPosDt()).Length(), 0.0, 1e-10);
+    }
+}
+
+TEST(ChSystemDescriptor, cached_assembly_solver_type) {
+    ChSystemSMC sys;
+    sys.GetSystemDescriptor()->EnableCachedAssembly(true);
+
+    // Changing the solver type replaces the system descriptor, but keeps its options
+    sys.SetSolverType(ChSolver::Type::SPARSE_LU);
+    ASSERT_TRUE(sys.GetSystemDescriptor()->IsCachedAssemblyEnabled());
+}
@@ -0,0 +1,292 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the explicit central difference integrator with lumped mass.
+//
+// A pendulum made of a chain of bar elements, hinged to a fixed body with a
+// ChLinkNodeFrame constraint, swings under gravity. The constraint is enforced
+// by projection and the motion must match the one obtained with the implicit
+// HHT integrator. Further tests check the fallback to the penalty method when
+// some constraints cannot be projected, the critical time step estimate and the
+// mass scaling of the mesh elements (including ANCF elements, whose stiffness is
+// only available after a force evaluation), the use of the integrator with
+// diagonal lumping turned off, and the handling of state changes between steps.
+//
+// =============================================================================
+
+#include <limits>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/fea/ChElementBar.h"
+#include "chrono/fea/ChElementBeamANCF_3243.h"
+#include "chrono/fea/ChLinkNodeFrame.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// =============================================================================
+
+const int num_elements = 8;
+
+std::unique_ptr<ChSystemSMC> CreateSystem(bool explicit_integrator,
+                                          std::shared_ptr<ChMesh>& mesh,
+                                          std::shared_ptr<ChLinkNodeFrame>& hinge,
+                                          std::vector<std::shared_ptr<ChNodeFEAxyz>>& nodes) {
+    auto sys = chrono_types::make_unique<ChSystemSMC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    if (explicit_integrator) {
+        auto integrator = chrono_types::make_shared<ChTimestepperCentralDifference>(sys.get());
+        integrator->EnableAutomaticSubsteps(true);
+        sys->SetTimestepper(integrator);
+    } else {
+        sys->SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+        sys->SetTimestepperType(ChTimestepper::Type::HHT);
+    }
+
+    mesh = chrono_types::make_shared<ChMesh>();
+
+    double dx = 1.0 / num_elements;
+    for (int i = 0; i <= num_elements; i++) {
+        auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(i * dx, 0, 0));
+        node->SetMass(0.01);
+        mesh->AddNode(node);
+        nodes.push_back(node);
+    }
+    for (int i = 0; i < num_elements; i++) {
+        auto element = chrono_types::make_shared<ChElementBar>();
+        element->SetNodes(nodes[i], nodes[i + 1]);
+        element->SetArea(1e-4);
+        element->SetDensity(1000);
+        element->SetYoungModulus(1e9);
+        element->SetRayleighDamping(1e-5);
+        mesh->AddElement(element);
+    }
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys->Add(ground);
+
+    hinge = chrono_types::make_shared<ChLinkNodeFrame>();
+    hinge->Initialize(nodes[0], ground);
+    sys->Add(hinge);
+
+    sys->Add(mesh);
+
+    return sys;
+}
+
+TEST(ChTimestepperCentralDifference, pendulum) {
+    std::shared_ptr<ChMesh> mesh_ref;
+    std::shared_ptr<ChMesh> mesh;
+    std::shared_ptr<ChLinkNodeFrame> hinge_ref;
+    std::shared_ptr<ChLinkNodeFrame> hinge;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes_ref;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    auto sys_ref = CreateSystem(false, mesh_ref, hinge_ref, nodes_ref);
+    auto sys = CreateSystem(true, mesh, hinge, nodes);
+
+    auto integrator = std::static_pointer_cast<ChTimestepperCentralDifference>(sys->GetTimestepper());
+
+    double step = 1e-3;
+    for (int i = 0; i < 200; i++) {
+        sys_ref->DoStepDynamics(step);
+        sys->DoStepDynamics(step);
+
+        ASSERT_LT(hinge->GetConstraintViolation().norm(), 1e-10);
+    }
+
+    // The step size is limited by the critical time step of the elements
+    ASSERT_GT(integrator->GetCriticalTimeStep(), 0.0);
+    ASSERT_LT(integrator->GetCriticalTimeStep(), step);
+    ASSERT_GE(integrator->GetNumSubsteps() * integrator->GetCriticalTimeStep(), step);
+
+    // The pendulum swings as with the implicit integrator and the hinge carries its weight
+    ASSERT_LT(nodes.back()->GetPos().z(), -0.05);
+    ASSERT_NEAR((nodes.back()->GetPos() - nodes_ref.back()->GetPos()).Length(), 0.0, 2e-3);
+    ASSERT_GT(hinge->GetReactionOnNode().Length(), 0.0);
+}
+
+TEST(ChTimestepperCentralDifference, penalty_fallback) {
+    // Same pendulum, with an additional constraint (a body locked to ground) which does not support projection.
+    // All constraints must then be enforced with the penalty method, exactly as if projection was disabled.
+    std::shared_ptr<ChMesh> mesh_ref;
+    std::shared_ptr<ChMesh> mesh;
+    std::shared_ptr<ChLinkNodeFrame> hinge_ref;
+    std::shared_ptr<ChLinkNodeFrame> hinge;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes_ref;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    auto sys_ref = CreateSystem(true, mesh_ref, hinge_ref, nodes_ref);
+    auto sys = CreateSystem(true, mesh, hinge, nodes);
+
+    std::static_pointer_cast<ChTimestepperCentralDifference>(sys_ref->GetTimestepper())
+        ->EnableConstraintProjection(false);
+
+    for (auto s : {sys_ref.get(), sys.get()}) {
+        auto ground = s->GetBodies().front();
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetMass(1);
+        body->SetPos(ChVector3d(0, 0, -1));
+        s->Add(body);
+        auto lock = chrono_types::make_shared<ChLinkLockLock>();
+        lock->Initialize(body, ground, ChFrame<>(ChVector3d(0, 0, -1)));
+        s->Add(lock);
+    }
+
+    ASSERT_FALSE(sys->CanProjectLumped());
+
+    double step = 1e-3;
+    for (int i = 0; i < 20; i++) {
+        sys_ref->DoStepDynamics(step);
+        sys->DoStepDynamics(step);
+    }
+
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_EQ(nodes[i]->GetPos(), nodes_ref[i]->GetPos());
+        ASSERT_EQ(nodes[i]->GetPosDt(), nodes_ref[i]->GetPosDt());
+    }
+    ASSERT_EQ(hinge->GetReactionOnNode(), hinge_ref->GetReactionOnNode());
+}
+
+TEST(ChTimestepperCentralDifference, state_change) {
+    // The state of the pendulum is modified between two steps. The initial acceleration of the next step must be
+    // recomputed, with or without acceleration reuse, so that the results match those of a fresh integrator.
+    for (bool reuse : {false, true}) {
+        std::shared_ptr<ChMesh> mesh_ref;
+        std::shared_ptr<ChMesh> mesh;
+        std::shared_ptr<ChLinkNodeFrame> hinge_ref;
+        std::shared_ptr<ChLinkNodeFrame> hinge;
+        std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes_ref;
+        std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+        auto sys_ref = CreateSystem(true, mesh_ref, hinge_ref, nodes_ref);
+        auto sys = CreateSystem(true, mesh, hinge, nodes);
+
+        for (auto s : {sys_ref.get(), sys.get()}) {
+            auto integrator = std::static_pointer_cast<ChTimestepperCentralDifference>(s->GetTimestepper());
+            integrator->EnableAccelerationReuse(reuse);
+        }
+
+        double step = 1e-3;
+        for (int i = 0; i < 20; i++) {
+            sys_ref->DoStepDynamics(step);
+            sys->DoStepDynamics(step);
+        }
+
+        // The projected steps do not use the system descriptor
+        ASSERT_TRUE(sys->GetSystemDescriptor()->GetConstraints().empty());
+
+        // Move the tip of the pendulum and stop it
+        for (auto n : {nodes_ref.back(), nodes.back()}) {
+            n->SetPos(n->GetPos() + ChVector3d(0, 0, 0.01));
+            n->SetPosDt(VNULL);
+        }
+
+        auto integrator = chrono_types::make_shared<ChTimestepperCentralDifference>(sys_ref.get());
+        integrator->EnableAutomaticSubsteps(true);
+        integrator->EnableAccelerationReuse(reuse);
+        sys_ref->SetTimestepper(integrator);
+
+        for (int i = 0; i < 20; i++) {
+            sys_ref->DoStepDynamics(step);
+            sys->DoStepDynamics(step);
+        }
+
+        for (size_t i = 0; i < nodes.size(); i++) {
+            ASSERT_EQ(nodes[i]->GetPos(), nodes_ref[i]->GetPos());
+            ASSERT_EQ(nodes[i]->GetPosDt(), nodes_ref[i]->GetPosDt());
+        }
+    }
+}
+
+TEST(ChTimestepperCentralDifference, mass_scaling) {
+    std::shared_ptr<ChMesh> mesh;
+    std::shared_ptr<ChLinkNodeFrame> hinge;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    auto sys = CreateSystem(true, mesh, hinge, nodes);
+
+    auto integrator = std::static_pointer_cast<ChTimestepperCentralDifference>(sys->GetTimestepper());
+
+    sys->DoStepDynamics(1e-3);
+    double critical_step = integrator->GetCriticalTimeStep();
+    unsigned int num_substeps = integrator->GetNumSubsteps();
+    ASSERT_NEAR(mesh->EstimateCriticalTimeStep(), critical_step, 1e-3 * critical_step);
+    ASSERT_EQ(mesh->GetNumMassScaledElements(), 0u);
+
+    // Scaling the element masses to a larger critical time step reduces the number of substeps
+    mesh->SetMassScaling(4 * critical_step);
+    integrator->ResetLumpedMass();
+    sys->DoStepDynamics(1e-3);
+
+    ASSERT_EQ(mesh->GetNumMassScaledElements(), (unsigned int)num_elements);
+    ASSERT_NEAR(integrator->GetCriticalTimeStep(), 4 * critical_step, 1e-6 * critical_step);
+    ASSERT_LT(integrator->GetNumSubsteps(), num_substeps);
+}
+
+TEST(ChTimestepperCentralDifference, critical_step_ANCF) {
+    // Cantilever of ANCF beam elements using the "Pre-Integration" method, for which the element stiffness used in
+    // the critical time step estimate is only set during the internal force evaluation
+    ChSystemSMC sys;
+    auto integrator = chrono_types::make_shared<ChTimestepperCentralDifference>(&sys);
+    integrator->EnableAutomaticSubsteps(true);
+    sys.SetTimestepper(integrator);
+
+    auto material = chrono_types::make_shared<ChMaterialBeamANCF>(7850, 2e9, 0.3, 10 * (1 + 0.3) / (12 + 11 * 0.3),
+                                                                  10 * (1 + 0.3) / (12 + 11 * 0.3));
+    auto mesh = chrono_types::make_shared<ChMesh>();
+
+    double dx = 0.1;
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(0, 0, 0));
+    nodeA->SetFixed(true);
+    mesh->AddNode(nodeA);
+    for (int i = 0; i < num_elements; i++) {
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d((i + 1) * dx, 0, 0));
+        mesh->AddNode(nodeB);
+        auto element = chrono_types::make_shared<ChElementBeamANCF_3243>();
+        element->SetNodes(nodeA, nodeB);
+        element->SetDimensions(dx, 0.02, 0.02);
+        element->SetMaterial(material);
+        element->SetIntFrcCalcMethod(ChElementBeamANCF_3243::IntFrcMethod::PreInt);
+        mesh->AddElement(element);
+        nodeA = nodeB;
+    }
+    sys.Add(mesh);
+
+    // The critical time step used for the first step matches the estimate at the (nearly unchanged) current state
+    double step = 1e-5;
+    sys.DoStepDynamics(step);
+    double critical_step = integrator->GetCriticalTimeStep();
+    ASSERT_LT(critical_step, std::numeric_limits<double>::infinity());
+    ASSERT_NEAR(mesh->EstimateCriticalTimeStep(), critical_step, 1e-3 * critical_step);
+}
+
+TEST(ChTimestepperCentralDifference, lumping_off) {
+    std::shared_ptr<ChMesh> mesh;
+    std::shared_ptr<ChLinkNodeFrame> hinge;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    auto sys = CreateSystem(true, mesh, hinge, nodes);
+
+    auto integrator = std::static_pointer_cast<ChTimestepperCentralDifference>(sys->GetTimestepper());
+    integrator->SetDiagonalLumpingOFF();
+    integrator->EnableConstraintProjection(false);
+
+    for (int i = 0; i < 10; i++)
+        sys->DoStepDynamics(1e-3);
+
+    ASSERT_LT(nodes.back()->GetPos().z(), 0.0);
+}
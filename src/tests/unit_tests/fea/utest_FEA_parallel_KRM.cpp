@@ -0,0 +1,80 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the parallel loading of element KRM matrices in ChMesh.
+//
+// A cantilever of Euler beam elements is simulated with 1 and 4 threads. Half
+// of the elements evaluate their KR matrices by numerical differentiation
+// (perturbing the shared nodes) and are therefore processed sequentially. The
+// results must not depend on the number of threads (up to the summation order of
+// the internal forces).
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// =============================================================================
+
+const int num_elements = 20;
+
+std::unique_ptr<ChSystemSMC> CreateSystem(int num_threads, std::vector<std::shared_ptr<ChNodeFEAxyzrot>>& nodes) {
+    auto sys = chrono_types::make_unique<ChSystemSMC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys->SetNumThreads(num_threads);
+    sys->SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+
+    auto section = chrono_types::make_shared<ChBeamSectionEulerEasyRectangular>(0.02, 0.02, 2e8, 8e7, 1000);
+    section->SetRayleighDamping(1e-3);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    ChBuilderBeamEuler builder;
+    builder.BuildBeam(mesh, section, num_elements, ChVector3d(0, 0, 0), ChVector3d(1, 0, 0), ChVector3d(0, 1, 0));
+    builder.GetLastBeamNodes().front()->SetFixed(true);
+
+    const auto& elements = builder.GetLastBeamElements();
+    for (size_t i = 0; i < elements.size(); i += 2)
+        elements[i]->use_numerical_diff_for_KR = true;
+
+    nodes = builder.GetLastBeamNodes();
+    sys->Add(mesh);
+
+    return sys;
+}
+
+TEST(ChMesh, parallel_KRM) {
+    std::vector<std::shared_ptr<ChNodeFEAxyzrot>> nodes_ref;
+    std::vector<std::shared_ptr<ChNodeFEAxyzrot>> nodes;
+    auto sys_ref = CreateSystem(1, nodes_ref);
+    auto sys = CreateSystem(4, nodes);
+
+    double step = 1e-3;
+    for (int i = 0; i < 100; i++) {
+        sys_ref->DoStepDynamics(step);
+        sys->DoStepDynamics(step);
+    }
+
+    ASSERT_EQ(nodes_ref.size(), nodes.size());
+    ASSERT_GT(nodes_ref.back()->GetPos().y(), -1.0);
+    ASSERT_LT(nodes_ref.back()->GetPos().y(), 0.0);
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_NEAR((nodes[i]->GetPos() - nodes_ref[i]->GetPos()).Length(), 0.0, 1e-8);
+        ASSERT_NEAR((nodes[i]->GetPosDt() - nodes_ref[i]->GetPosDt()).Length(), 0.0, 1e-6);
+    }
+}
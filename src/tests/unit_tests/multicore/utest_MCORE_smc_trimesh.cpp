@@ -0,0 +1,131 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit tests for SMC contacts with triangle mesh collision shapes.
+// - shear history: a sphere resting on a vertex of a triangulated grid touches
+//   several faces of the same mesh shape; each of these contacts must have its
+//   own entry in the contact history (multi-step tangential displacement model).
+// - mesh-mesh: overlapping triangle mesh shapes on two bodies are rejected.
+//
+// =============================================================================
+
+#include <set>
+#include <stdexcept>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Create a flat square grid mesh (in the x-y plane) of given half-size and resolution
+std::shared_ptr<ChTriangleMeshConnected> CreateGrid(double hsize, int n) {
+    auto mesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+    auto& vertices = mesh->GetCoordsVertices();
+    auto& faces = mesh->GetIndicesVertexes();
+    double delta = 2 * hsize / n;
+    for (int ix = 0; ix <= n; ix++) {
+        for (int iy = 0; iy <= n; iy++) {
+            vertices.push_back(ChVector3d(-hsize + ix * delta, -hsize + iy * delta, 0));
+        }
+    }
+    for (int ix = 0; ix < n; ix++) {
+        for (int iy = 0; iy < n; iy++) {
+            int v0 = ix * (n + 1) + iy;
+            int v1 = v0 + 1;
+            int v2 = v0 + (n + 1);
+            int v3 = v2 + 1;
+            faces.push_back(ChVector3i(v0, v2, v1));
+            faces.push_back(ChVector3i(v1, v2, v3));
+        }
+    }
+    return mesh;
+}
+
+std::shared_ptr<ChBody> AddMeshBody(ChSystem& sys,
+                                    std::shared_ptr<ChContactMaterial> mat,
+                                    const ChVector3d& pos,
+                                    bool fixed) {
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetMass(1);
+    body->SetPos(pos);
+    body->SetFixed(fixed);
+    body->EnableCollision(true);
+    auto shape = chrono_types::make_shared<ChCollisionShapeTriangleMesh>(mat, CreateGrid(1.0, 4), false, false, 0.0);
+    body->AddCollisionShape(shape);
+    sys.AddBody(body);
+    return body;
+}
+
+TEST(ChSystemMulticoreSMC, trimesh_shear_history) {
+    ChSystemMulticoreSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.GetSettings()->solver.contact_force_model = ChSystemSMC::Hooke;
+    sys.GetSettings()->solver.tangential_displ_mode = ChSystemSMC::MultiStep;
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetFriction(0.4f);
+
+    // Ground with a grid mesh; the grid vertex at the origin is shared by 6 faces
+    AddMeshBody(sys, mat, ChVector3d(0, 0, 0), true);
+
+    // Sphere slightly penetrating the grid, centered above the origin vertex
+    double radius = 0.1;
+    auto sphere = chrono_types::make_shared<ChBody>();
+    sphere->SetMass(1);
+    sphere->SetInertiaXX(0.4 * radius * radius * ChVector3d(1, 1, 1));
+    sphere->SetPos(ChVector3d(0, 0, radius - 1e-4));
+    sphere->EnableCollision(true);
+    sphere->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, radius));
+    sys.AddBody(sphere);
+
+    const auto& cd_data = sys.data_manager->cd_data;
+    const auto& host_data = sys.data_manager->host_data;
+
+    for (int it = 0; it < 10; it++) {
+        sys.DoStepDynamics(1e-4);
+
+        // Faces of the mesh in contact with the sphere (all distinct)
+        uint num_contacts = cd_data->num_rigid_contacts;
+        ASSERT_GE(num_contacts, 2u);
+        std::set<int> faces;
+        for (uint i = 0; i < num_contacts; i++) {
+            ASSERT_GE(cd_data->contact_faceIDs[i], 0);
+            faces.insert(cd_data->contact_faceIDs[i]);
+        }
+        ASSERT_EQ(faces.size(), num_contacts);
+
+        // The contact history is stored on the body with larger index (the sphere), one entry per face
+        int body = (int)sphere->GetIndex();
+        std::set<int> history_faces;
+        for (int i = 0; i < max_shear; i++) {
+            if (host_data.shear_neigh[max_shear * body + i].x != -1)
+                history_faces.insert(host_data.shear_face[max_shear * body + i]);
+        }
+        ASSERT_EQ(history_faces, faces);
+    }
+}
+
+TEST(ChSystemMulticoreSMC, trimesh_mesh_mesh) {
+    ChSystemMulticoreSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+
+    AddMeshBody(sys, mat, ChVector3d(0, 0, 0), true);
+    AddMeshBody(sys, mat, ChVector3d(0.1, 0.1, 0.001), false);
+
+    EXPECT_THROW(sys.DoStepDynamics(1e-4), std::runtime_error);
+}
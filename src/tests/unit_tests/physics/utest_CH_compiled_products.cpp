@@ -0,0 +1,156 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the compiled (matrix-free) products of the system descriptor.
+//
+// The model consists of pendulum chains (ChConstraintTwoBodies) and boxes
+// resting on the ground (body-body contact constraints). The Schur complement
+// and KKT system products are evaluated with and without compiled products and
+// compared. The same model is also simulated with the APGD solver in both modes.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverAPGD.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+const int num_links = 4;
+const int num_boxes = 4;
+
+std::unique_ptr<ChSystemNSC> CreateSystem(bool compiled) {
+    auto sys = chrono_types::make_unique<ChSystemNSC>();
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys->GetSystemDescriptor()->EnableCompiledProducts(compiled);
+
+    auto solver = chrono_types::make_shared<ChSolverAPGD>();
+    solver->SetMaxIterations(100);
+    sys->SetSolver(solver);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    // Pendulum chain, released from a horizontal configuration
+    double length = 0.5;
+    std::shared_ptr<ChBody> prev = ground;
+    for (int il = 0; il < num_links; il++) {
+        auto link = chrono_types::make_shared<ChBodyEasyBox>(length, 0.05, 0.05, 1000, false, false);
+        link->SetPos(ChVector3d((il + 0.5) * length, 3, 0));
+        sys->AddBody(link);
+
+        auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev->Initialize(link, prev, ChFrame<>(ChVector3d(il * length, 3, 0)));
+        sys->AddLink(rev);
+
+        prev = link;
+    }
+
+    // Stack of boxes
+    for (int ib = 0; ib < num_boxes; ib++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.2, 0.4, 1000, false, true, mat);
+        box->SetPos(ChVector3d(-3, 0.1 + ib * 0.2, 0));
+        sys->AddBody(box);
+    }
+
+    return sys;
+}
+
+TEST(ChSystemDescriptor, compiled_products) {
+    auto sys = CreateSystem(false);
+
+    double step = 1e-3;
+    for (int i = 0; i < 50; i++)
+        sys->DoStepDynamics(step);
+
+    auto& sysd = *sys->GetSystemDescriptor();
+    unsigned int nq = sysd.CountActiveVariables();
+    unsigned int nc = sysd.CountActiveConstraints();
+    ASSERT_GT(nc, 0u);
+
+    ChVectorDynamic<> l = ChVectorDynamic<>::Random(nc);
+    ChVectorDynamic<> x = ChVectorDynamic<>::Random(nq + nc);
+    std::vector<bool> enabled(nc);
+    for (unsigned int i = 0; i < nc; i++)
+        enabled[i] = (i % 3 != 0);
+
+    // Products with virtual calls
+    ChVectorDynamic<> Nl_ref, Nl_enabled_ref, Zx_ref;
+    sysd.SchurComplementProduct(Nl_ref, l);
+    sysd.SchurComplementProduct(Nl_enabled_ref, l, &enabled);
+    sysd.SystemProduct(Zx_ref, x);
+
+    // Compiled products
+    sysd.EnableCompiledProducts(true);
+    sysd.UpdateCompiledProducts();
+    ASSERT_EQ(sysd.GetNumCompiledConstraints(), nc);
+
+    ChVectorDynamic<> Nl, Nl_enabled, Zx;
+    sysd.SchurComplementProduct(Nl, l);
+    sysd.SchurComplementProduct(Nl_enabled, l, &enabled);
+    sysd.SystemProduct(Zx, x);
+
+    ASSERT_LT((Nl - Nl_ref).lpNorm<Eigen::Infinity>(), 1e-12 * (1 + Nl_ref.lpNorm<Eigen::Infinity>()));
+    ASSERT_LT((Nl_enabled - Nl_enabled_ref).lpNorm<Eigen::Infinity>(),
+              1e-12 * (1 + Nl_enabled_ref.lpNorm<Eigen::Infinity>()));
+    ASSERT_LT((Zx - Zx_ref).lpNorm<Eigen::Infinity>(), 1e-12 * (1 + Zx_ref.lpNorm<Eigen::Infinity>()));
+
+    // Move the pendulum links and load the new Jacobians, without an explicit update of the compiled arrays
+    for (auto& body : sys->GetBodies()) {
+        if (!body->IsFixed())
+            body->SetRot(QuatFromAngleZ(0.3) * body->GetRot());
+    }
+    sys->Update(false);
+    sys->LoadConstraintJacobians();
+    for (auto& constr : sysd.GetConstraints())
+        constr->Update_auxiliary();
+
+    sysd.SchurComplementProduct(Nl, l);
+    sysd.SystemProduct(Zx, x);
+
+    sysd.EnableCompiledProducts(false);
+    sysd.SchurComplementProduct(Nl_ref, l);
+    sysd.SystemProduct(Zx_ref, x);
+
+    ASSERT_LT((Nl - Nl_ref).lpNorm<Eigen::Infinity>(), 1e-12 * (1 + Nl_ref.lpNorm<Eigen::Infinity>()));
+    ASSERT_LT((Zx - Zx_ref).lpNorm<Eigen::Infinity>(), 1e-12 * (1 + Zx_ref.lpNorm<Eigen::Infinity>()));
+}
+
+TEST(ChSystemDescriptor, compiled_simulation) {
+    auto sys_ref = CreateSystem(false);
+    auto sys = CreateSystem(true);
+
+    double step = 1e-3;
+    for (int i = 0; i < 100; i++) {
+        sys_ref->DoStepDynamics(step);
+        sys->DoStepDynamics(step);
+    }
+
+    const auto& bodies_ref = sys_ref->GetBodies();
+    const auto& bodies = sys->GetBodies();
+    ASSERT_EQ(bodies_ref.size(), bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        ASSERT_NEAR((bodies[i]->GetPos() - bodies_ref[i]->GetPos()).Length(), 0.0, 1e-8);
+        ASSERT_NEAR((bodies[i]->GetPosDt() - bodies_ref[i]->GetPosDt()).Length(), 0.0, 1e-6);
+    }
+}
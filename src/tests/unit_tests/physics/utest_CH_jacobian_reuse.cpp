@@ -0,0 +1,112 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the Newton matrix (Jacobian) update strategies of implicit
+// integrators.
+//
+// A pendulum chain is simulated with full Newton (Jacobian update at every
+// iteration) and with automatic reuse of the Jacobian across iterations and
+// steps. The results must agree, while the automatic strategy must perform
+// fewer calls to the solver's Setup function.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+const int num_links = 4;
+
+std::unique_ptr<ChSystemSMC> CreateSystem(ChTimestepper::Type type,
+                                          ChImplicitIterativeTimestepper::JacobianUpdate update) {
+    auto sys = chrono_types::make_unique<ChSystemSMC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto solver = chrono_types::make_shared<ChSolverSparseQR>();
+    solver->LockSparsityPattern(true);
+    sys->SetSolver(solver);
+
+    sys->SetTimestepperType(type);
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys->GetTimestepper());
+    integrator->SetMaxIters(20);
+    integrator->SetAbsTolerances(1e-8);
+    integrator->SetJacobianUpdateMethod(update);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(sys->GetTimestepper()))
+        hht->SetStepControl(false);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    // Horizontal pendulum chain, released from rest
+    double length = 0.5;
+    std::shared_ptr<ChBody> prev = ground;
+    for (int il = 0; il < num_links; il++) {
+        auto link = chrono_types::make_shared<ChBodyEasyBox>(length, 0.05, 0.05, 1000, false, false);
+        link->SetPos(ChVector3d((il + 0.5) * length, 0, 0));
+        sys->AddBody(link);
+
+        auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev->Initialize(link, prev, ChFrame<>(ChVector3d(il * length, 0, 0)));
+        sys->AddLink(rev);
+
+        prev = link;
+    }
+
+    return sys;
+}
+
+class JacobianReuseTest : public ::testing::TestWithParam<ChTimestepper::Type> {};
+
+TEST_P(JacobianReuseTest, automatic) {
+    auto type = GetParam();
+    auto sys_ref = CreateSystem(type, ChImplicitIterativeTimestepper::JacobianUpdate::EVERY_ITERATION);
+    auto sys = CreateSystem(type, ChImplicitIterativeTimestepper::JacobianUpdate::AUTOMATIC);
+
+    double step = 1e-3;
+    for (int i = 0; i < 200; i++) {
+        sys_ref->DoStepDynamics(step);
+        sys->DoStepDynamics(step);
+    }
+
+    auto integrator_ref = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys_ref->GetTimestepper());
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys->GetTimestepper());
+
+    // One solve per Newton iteration, and fewer setups when reusing the Jacobian
+    ASSERT_EQ(integrator_ref->GetNumSetupCallsTotal(), integrator_ref->GetNumSolveCallsTotal());
+    ASSERT_EQ(integrator->GetNumIterationsTotal(), integrator->GetNumSolveCallsTotal());
+    ASSERT_LT(integrator->GetNumSetupCallsTotal(), integrator_ref->GetNumSetupCallsTotal());
+    ASSERT_LT(integrator->GetNumSetupCallsTotal(), integrator->GetNumSolveCallsTotal());
+
+    // Both strategies converge to the same solution
+    const auto& bodies_ref = sys_ref->GetBodies();
+    const auto& bodies = sys->GetBodies();
+    ASSERT_EQ(bodies_ref.size(), bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        ASSERT_NEAR((bodies[i]->GetPos() - bodies_ref[i]->GetPos()).Length(), 0.0, 1e-4);
+        ASSERT_NEAR((bodies[i]->GetPosDt() - bodies_ref[i]->GetPosDt()).Length(), 0.0, 1e-3);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChImplicitIterativeTimestepper,
+                         JacobianReuseTest,
+                         ::testing::Values(ChTimestepper::Type::EULER_IMPLICIT,
+                                           ChTimestepper::Type::HHT,
+                                           ChTimestepper::Type::NEWMARK));
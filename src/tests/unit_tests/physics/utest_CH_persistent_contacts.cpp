@@ -0,0 +1,149 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for warm starting NSC contacts from persistent contact identities.
+//
+// A stack of boxes rests on the ground. The reaction cache provided by the
+// Bullet persistent manifolds is disabled (through a narrowphase callback), so
+// that the only source of initial guesses for the warm-started PSOR solver is
+// the contact matching performed by ChContactContainerNSC. Once the stack has
+// settled, the number of solver iterations is compared with and without
+// persistent contacts. Removing a body invalidates the cached contacts.
+//
+// =============================================================================
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+const int num_boxes = 5;
+
+// Narrowphase callback discarding the reaction cache of the collision system
+class NoReactionCache : public ChCollisionSystem::NarrowphaseCallback {
+  public:
+    virtual bool OnNarrowphase(ChCollisionInfo& contactinfo) override {
+        contactinfo.reaction_cache = nullptr;
+        return true;
+    }
+};
+
+std::unique_ptr<ChSystemNSC> CreateSystem(bool persistent) {
+    auto sys = chrono_types::make_unique<ChSystemNSC>();
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys->GetCollisionSystem()->RegisterNarrowphaseCallback(chrono_types::make_shared<NoReactionCache>());
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(1000);
+    solver->SetTolerance(1e-6);
+    solver->EnableWarmStart(true);
+    sys->SetSolver(solver);
+
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(sys->GetContactContainer());
+    container->EnablePersistentContacts(persistent);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 1, 4, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    for (int ib = 0; ib < num_boxes; ib++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.2, 0.4, 1000, false, true, mat);
+        box->SetPos(ChVector3d(0, 0.1 + ib * 0.2, 0));
+        sys->AddBody(box);
+    }
+
+    return sys;
+}
+
+// Simulate the stack and return the total number of solver iterations after settling
+int Simulate(ChSystemNSC* sys, int& num_persistent) {
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(sys->GetContactContainer());
+    double step = 1e-3;
+    for (int i = 0; i < 500; i++)
+        sys->DoStepDynamics(step);
+
+    int iterations = 0;
+    num_persistent = 0;
+    for (int i = 0; i < 100; i++) {
+        sys->DoStepDynamics(step);
+        iterations += sys->GetSolver()->AsIterative()->GetIterations();
+        num_persistent += container->GetNumPersistentContacts();
+
+        // each previous contact initializes at most one new contact
+        EXPECT_LE(container->GetNumPersistentContacts(), sys->GetNumContacts());
+    }
+
+    return iterations;
+}
+
+TEST(ChContactContainerNSC, persistent_contacts) {
+    auto sys_ref = CreateSystem(false);
+    auto sys = CreateSystem(true);
+
+    int num_persistent_ref;
+    int num_persistent;
+    int iterations_ref = Simulate(sys_ref.get(), num_persistent_ref);
+    int iterations = Simulate(sys.get(), num_persistent);
+
+    // Contacts of the settled stack are matched to contacts of the previous step
+    ASSERT_EQ(num_persistent_ref, 0);
+    ASSERT_GT(num_persistent, 0);
+
+    // Warm starting from the previous reactions reduces the number of solver iterations
+    ASSERT_LT(iterations, iterations_ref);
+
+    // Both stacks remain at rest
+    for (const auto& body : sys->GetBodies()) {
+        ASSERT_LT(body->GetPosDt().Length(), 1e-2);
+    }
+    for (const auto& body : sys_ref->GetBodies()) {
+        ASSERT_LT(body->GetPosDt().Length(), 1e-2);
+    }
+}
+
+TEST(ChContactContainerNSC, persistent_contacts_remove) {
+    auto sys = CreateSystem(true);
+    auto container = std::static_pointer_cast<ChContactContainerNSC>(sys->GetContactContainer());
+
+    double step = 1e-3;
+    for (int i = 0; i < 200; i++)
+        sys->DoStepDynamics(step);
+    ASSERT_GT(container->GetNumPersistentContacts(), 0u);
+
+    // Remove (and release) the bottom box of the stack; cached contacts referring to it must be discarded
+    {
+        auto box = sys->GetBodies()[1];
+        sys->RemoveBody(box);
+    }
+    ASSERT_EQ(sys->GetNumContacts(), 0u);
+
+    sys->DoStepDynamics(step);
+    ASSERT_EQ(container->GetNumPersistentContacts(), 0u);
+
+    // The remaining boxes drop onto the ground and settle again
+    for (int i = 0; i < 500; i++)
+        sys->DoStepDynamics(step);
+    ASSERT_GT(container->GetNumPersistentContacts(), 0u);
+}
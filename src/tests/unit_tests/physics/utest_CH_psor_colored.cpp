@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the multithreaded graph-colored PSOR solver.
+//
+// The model consists of several hanging pendulum chains and a set of boxes
+// resting on the ground. The same model is simulated with ChSolverPSOR and with
+// ChSolverPSORColored; both solvers are run to convergence and the resulting
+// body states and joint reactions are compared.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORColored.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+const int num_chains = 5;
+const int num_links = 4;
+const int num_boxes = 4;
+
+std::unique_ptr<ChSystemNSC> CreateSystem(std::shared_ptr<ChIterativeSolverVI> solver) {
+    auto sys = chrono_types::make_unique<ChSystemNSC>();
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    solver->SetMaxIterations(2000);
+    solver->SetTolerance(1e-12);
+    sys->SetSolver(solver);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    // Pendulum chains, hanging at rest
+    double length = 0.5;
+    for (int ic = 0; ic < num_chains; ic++) {
+        ChVector3d loc(-4.0 + ic, 3.0, 0);
+        std::shared_ptr<ChBody> prev = ground;
+        for (int il = 0; il < num_links; il++) {
+            auto link = chrono_types::make_shared<ChBodyEasyBox>(0.05, length, 0.05, 1000, false, false);
+            link->SetPos(loc - ChVector3d(0, (il + 0.5) * length, 0));
+            sys->AddBody(link);
+
+            auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+            rev->Initialize(link, prev, ChFrame<>(loc - ChVector3d(0, il * length, 0)));
+            sys->AddLink(rev);
+
+            prev = link;
+        }
+    }
+
+    // Boxes resting on the ground
+    for (int ib = 0; ib < num_boxes; ib++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.4, 1000, false, true, mat);
+        box->SetPos(ChVector3d(-4.0 + 2 * ib, 0.2, 4.0));
+        sys->AddBody(box);
+    }
+
+    return sys;
+}
+
+TEST(ChSolverPSORColored, compare_PSOR) {
+    auto solver = chrono_types::make_shared<ChSolverPSORColored>(4);
+    auto sys_ref = CreateSystem(chrono_types::make_shared<ChSolverPSOR>());
+    auto sys = CreateSystem(solver);
+
+    double step = 1e-3;
+    for (int i = 0; i < 20; i++) {
+        sys_ref->DoStepDynamics(step);
+        sys->DoStepDynamics(step);
+    }
+
+    // Independent chains and boxes can be colored with few colors
+    ASSERT_GE(solver->GetNumColors(), 2);
+    ASSERT_LE(solver->GetNumColors(), 8);
+
+    // Both solvers converge to the same solution
+    ASSERT_LT(solver->GetError(), 1e-6);
+
+    const auto& bodies_ref = sys_ref->GetBodies();
+    const auto& bodies = sys->GetBodies();
+    ASSERT_EQ(bodies_ref.size(), bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        ASSERT_NEAR((bodies[i]->GetPos() - bodies_ref[i]->GetPos()).Length(), 0.0, 1e-6);
+        ASSERT_NEAR((bodies[i]->GetPosDt() - bodies_ref[i]->GetPosDt()).Length(), 0.0, 1e-5);
+    }
+
+    const auto& links_ref = sys_ref->GetLinks();
+    const auto& links = sys->GetLinks();
+    ASSERT_EQ(links_ref.size(), links.size());
+    for (size_t i = 0; i < links.size(); i++) {
+        auto force_ref = links_ref[i]->GetReaction2().force;
+        auto force = links[i]->GetReaction2().force;
+        ASSERT_NEAR((force - force_ref).Length(), 0.0, 1e-3 * force_ref.Length());
+    }
+}
+
+TEST(ChSolverPSORColored, num_threads) {
+    ChSystemNSC sys;
+
+    // A solver created by the system follows the number of Chrono threads
+    sys.SetSolverType(ChSolver::Type::PSOR_COLORED);
+    sys.SetNumThreads(3);
+    ASSERT_EQ(std::static_pointer_cast<ChSolverPSORColored>(sys.GetSolver())->GetNumThreads(), 3);
+
+    // A user-provided solver keeps its own setting
+    auto solver = chrono_types::make_shared<ChSolverPSORColored>(2);
+    sys.SetSolver(solver);
+    sys.SetNumThreads(4);
+    ASSERT_EQ(solver->GetNumThreads(), 2);
+}
@@ -0,0 +1,164 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+//  A pile of spheres settles in a fixed box. The same problem is simulated
+//  with 1 and with multiple Chrono threads (parallel evaluation of SMC contact
+//  forces). Body states and contact force reports must match.
+//  A custom (not thread-safe) contact force algorithm is always invoked
+//  sequentially.
+//
+// =============================================================================
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChContactSMC.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#define SMC_SEQUENTIAL
+#include "../utest_SMC.h"
+
+// Create a system with a pile of spheres in a box, using the specified number of Chrono threads
+std::unique_ptr<ChSystemSMC> CreateSystem(ChSystemSMC::ContactForceModel fmodel, int nthreads) {
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(2e5f);
+    mat->SetPoissonRatio(0.3f);
+    mat->SetFriction(0.3f);
+    mat->SetRestitution(0.1f);
+
+    auto sys = chrono_types::make_unique<ChSystemSMC>();
+    SetSimParameters(sys.get(), ChVector3d(0, -9.81, 0), fmodel);
+    sys->SetNumThreads(nthreads, 1, 1);
+
+    AddWall(sys.get(), mat, ChVector3d(4, 0.2, 4), 1.0, ChVector3d(0, -0.1, 0), VNULL, true);
+    AddWall(sys.get(), mat, ChVector3d(0.2, 4, 4), 1.0, ChVector3d(-2.1, 2, 0), VNULL, true);
+    AddWall(sys.get(), mat, ChVector3d(0.2, 4, 4), 1.0, ChVector3d(+2.1, 2, 0), VNULL, true);
+    AddWall(sys.get(), mat, ChVector3d(4, 4, 0.2), 1.0, ChVector3d(0, 2, -2.1), VNULL, true);
+    AddWall(sys.get(), mat, ChVector3d(4, 4, 0.2), 1.0, ChVector3d(0, 2, +2.1), VNULL, true);
+
+    double radius = 0.2;
+    for (int ix = 0; ix < 8; ix++) {
+        for (int iy = 0; iy < 4; iy++) {
+            for (int iz = 0; iz < 8; iz++) {
+                ChVector3d pos(-1.75 + ix * 0.5 + 0.01 * iy, radius + iy * 0.45, -1.75 + iz * 0.5 - 0.01 * iy);
+                AddSphere(sys.get(), mat, radius, 1.0, pos, VNULL);
+            }
+        }
+    }
+
+    return sys;
+}
+
+class ParallelForcesTest : public ::testing::TestWithParam<ChSystemSMC::ContactForceModel> {};
+
+TEST_P(ParallelForcesTest, parallel_forces) {
+    auto fmodel = GetParam();
+    auto sys1 = CreateSystem(fmodel, 1);
+    auto sysN = CreateSystem(fmodel, 4);
+
+    double time_step = 1e-4;
+    for (int i = 0; i < 2000; i++) {
+        sys1->DoStepDynamics(time_step);
+        sysN->DoStepDynamics(time_step);
+    }
+
+    ASSERT_GT(sys1->GetNumContacts(), 0u);
+    ASSERT_EQ(sys1->GetNumContacts(), sysN->GetNumContacts());
+
+    auto container1 = sys1->GetContactContainer();
+    auto containerN = sysN->GetContactContainer();
+    container1->ComputeContactForces();
+    containerN->ComputeContactForces();
+
+    const auto& bodies1 = sys1->GetBodies();
+    const auto& bodiesN = sysN->GetBodies();
+    ASSERT_EQ(bodies1.size(), bodiesN.size());
+
+    for (size_t i = 0; i < bodies1.size(); i++) {
+        ASSERT_NEAR((bodies1[i]->GetPos() - bodiesN[i]->GetPos()).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((bodies1[i]->GetPosDt() - bodiesN[i]->GetPosDt()).Length(), 0.0, 1e-10);
+
+        auto force1 = container1->GetContactableForce(bodies1[i].get());
+        auto forceN = containerN->GetContactableForce(bodiesN[i].get());
+        ASSERT_NEAR((force1 - forceN).Length(), 0.0, 1e-8 * (1 + force1.Length()));
+
+        auto torque1 = container1->GetContactableTorque(bodies1[i].get());
+        auto torqueN = containerN->GetContactableTorque(bodiesN[i].get());
+        ASSERT_NEAR((torque1 - torqueN).Length(), 0.0, 1e-8 * (1 + torque1.Length()));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoSequential,
+                         ParallelForcesTest,
+                         ::testing::Values(ChSystemSMC::ContactForceModel::Hooke,
+                                           ChSystemSMC::ContactForceModel::Hertz));
+
+// Custom contact force algorithm (default force calculation) which records the OpenMP threads invoking it
+class RecordingForceTorque : public ChSystemSMC::ChContactForceTorqueSMC {
+  public:
+    virtual ChWrenchd CalculateForceTorque(const ChSystemSMC& sys,
+                                           const ChVector3d& normal_dir,
+                                           const ChVector3d& p1,
+                                           const ChVector3d& p2,
+                                           const ChVector3d& vel1,
+                                           const ChVector3d& vel2,
+                                           const ChContactMaterialCompositeSMC& mat,
+                                           double delta,
+                                           double eff_radius,
+                                           double mass1,
+                                           double mass2,
+                                           ChContactable* objA,
+                                           ChContactable* objB) const override {
+        // not thread-safe
+        num_calls++;
+        if (ChOMP::GetThreadNum() != 0)
+            num_other_threads++;
+        return m_default.CalculateForceTorque(sys, normal_dir, p1, p2, vel1, vel2, mat, delta, eff_radius, mass1,
+                                              mass2, objA, objB);
+    }
+
+    mutable int num_calls = 0;
+    mutable int num_other_threads = 0;
+
+  private:
+    ChDefaultContactForceTorqueSMC m_default;
+};
+
+TEST(ParallelForcesTest, custom_algorithm) {
+    auto sys1 = CreateSystem(ChSystemSMC::ContactForceModel::Hertz, 1);
+    auto sysN = CreateSystem(ChSystemSMC::ContactForceModel::Hertz, 4);
+
+    auto algo1 = chrono_types::make_unique<RecordingForceTorque>();
+    auto algoN = chrono_types::make_unique<RecordingForceTorque>();
+    auto recorder1 = algo1.get();
+    auto recorderN = algoN.get();
+    ASSERT_FALSE(recorderN->IsThreadSafe());
+    sys1->SetContactForceTorqueAlgorithm(std::move(algo1));
+    sysN->SetContactForceTorqueAlgorithm(std::move(algoN));
+
+    double time_step = 1e-4;
+    for (int i = 0; i < 1000; i++) {
+        sys1->DoStepDynamics(time_step);
+        sysN->DoStepDynamics(time_step);
+    }
+
+    ASSERT_GT(recorderN->num_calls, 0);
+    ASSERT_EQ(recorder1->num_calls, recorderN->num_calls);
+    ASSERT_EQ(recorderN->num_other_threads, 0);
+
+    const auto& bodies1 = sys1->GetBodies();
+    const auto& bodiesN = sysN->GetBodies();
+    for (size_t i = 0; i < bodies1.size(); i++) {
+        ASSERT_NEAR((bodies1[i]->GetPos() - bodiesN[i]->GetPos()).Length(), 0.0, 1e-10);
+    }
+}
@@ -0,0 +1,148 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the bulldozing effects in SCM deformable terrain.
+//
+// A box with prescribed motion is pushed into the soil and then dragged along
+// the terrain, with bulldozing enabled. The same simulation is run with one and
+// with multiple threads, for which the resulting terrain deformation must be
+// identical, and with the serial (Gauss-Seidel) erosion, for which the terrain
+// deformation must be close.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+struct BulldozingResult {
+    std::vector<SCMTerrain::NodeLevel> nodes;
+    int num_erosion_nodes;
+};
+
+BulldozingResult Simulate(int nthreads, bool parallel_erosion) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetNumThreads(nthreads);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.3, 0.2, 1000, false, true, mat);
+    box->SetFixed(true);
+    box->SetPos(ChVector3d(-0.5, 0, 0.15));
+    sys.AddBody(box);
+
+    SCMTerrain terrain(&sys, false);
+    terrain.SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+    terrain.EnableBulldozing(true);
+    terrain.SetBulldozingParameters(55, 1.0, 5, 10);
+    terrain.EnableParallelErosion(parallel_erosion);
+    terrain.Initialize(3.0, 2.0, 0.02);
+
+    // Sink the box into the soil, then drag it along the X direction
+    double step = 1e-3;
+    int num_erosion_nodes = 0;
+    for (int i = 0; i < 300; i++) {
+        ChVector3d pos = box->GetPos();
+        if (i < 100)
+            pos.z() -= 2e-3;
+        else
+            pos.x() += 4e-3;
+        box->SetPos(pos);
+        sys.DoStepDynamics(step);
+        num_erosion_nodes = std::max(num_erosion_nodes, terrain.GetNumErosionNodes());
+    }
+
+    BulldozingResult result;
+    result.nodes = terrain.GetModifiedNodes(true);
+    result.num_erosion_nodes = num_erosion_nodes;
+    std::sort(result.nodes.begin(), result.nodes.end(),
+              [](const SCMTerrain::NodeLevel& a, const SCMTerrain::NodeLevel& b) {
+                  return a.first.x() < b.first.x() || (a.first.x() == b.first.x() && a.first.y() < b.first.y());
+              });
+
+    return result;
+}
+
+TEST(SCMTerrain, bulldozing_threads) {
+    auto result_ref = Simulate(1, true);
+    auto result = Simulate(4, true);
+
+    ASSERT_GT(result_ref.num_erosion_nodes, 0);
+    ASSERT_EQ(result.num_erosion_nodes, result_ref.num_erosion_nodes);
+
+    // Material was displaced both below and above the initial (zero) level
+    double level_min = 0;
+    double level_max = 0;
+    for (const auto& node : result_ref.nodes) {
+        level_min = std::min(level_min, node.second);
+        level_max = std::max(level_max, node.second);
+    }
+    ASSERT_LT(level_min, 0.0);
+    ASSERT_GT(level_max, 0.0);
+
+    ASSERT_EQ(result.nodes.size(), result_ref.nodes.size());
+    for (size_t i = 0; i < result.nodes.size(); i++) {
+        ASSERT_EQ(result.nodes[i].first, result_ref.nodes[i].first);
+        ASSERT_EQ(result.nodes[i].second, result_ref.nodes[i].second);
+    }
+}
+
+TEST(SCMTerrain, bulldozing_serial) {
+    auto result_ref = Simulate(1, false);
+    auto result = Simulate(4, true);
+
+    ASSERT_EQ(result.num_erosion_nodes, result_ref.num_erosion_nodes);
+
+    // The parallel (Jacobi) and serial (Gauss-Seidel) erosion schemes exchange material in a different order, so the
+    // deformation differences accumulate over the simulation. Compare the overall terrain shape.
+    std::map<std::pair<int, int>, double> levels_ref;
+    double level_min_ref = 0;
+    double level_max_ref = 0;
+    double volume_ref = 0;
+    for (const auto& node : result_ref.nodes) {
+        levels_ref[{node.first.x(), node.first.y()}] = node.second;
+        level_min_ref = std::min(level_min_ref, node.second);
+        level_max_ref = std::max(level_max_ref, node.second);
+        volume_ref += node.second;
+    }
+
+    double level_min = 0;
+    double level_max = 0;
+    double volume = 0;
+    double diff2 = 0;
+    for (const auto& node : result.nodes) {
+        auto ref = levels_ref.find({node.first.x(), node.first.y()});
+        double level_ref = (ref == levels_ref.end()) ? 0.0 : ref->second;
+        level_min = std::min(level_min, node.second);
+        level_max = std::max(level_max, node.second);
+        volume += node.second;
+        diff2 += (node.second - level_ref) * (node.second - level_ref);
+    }
+    double diff_rms = std::sqrt(diff2 / result.nodes.size());
+
+    ASSERT_NEAR(level_min, level_min_ref, 0.1 * std::abs(level_min_ref));
+    ASSERT_NEAR(level_max, level_max_ref, 0.1 * level_max_ref);
+    ASSERT_NEAR(volume, volume_ref, 0.1 * std::abs(volume_ref));
+    ASSERT_LT(diff_rms, 0.2 * level_max_ref);
+}
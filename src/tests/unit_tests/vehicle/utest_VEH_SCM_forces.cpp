@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the multithreaded computation of SCM contact forces.
+//
+// Two boxes with prescribed motion are pushed into the soil and dragged along
+// the terrain. The same simulation is run with one and with multiple threads.
+// The terrain deformation must be identical and the contact forces on the two
+// boxes must match (up to round-off in the force accumulation).
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+struct ForcesResult {
+    std::vector<SCMTerrain::NodeLevel> nodes;
+    ChVector3d force[2];
+    ChVector3d torque[2];
+};
+
+ForcesResult Simulate(int nthreads) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetNumThreads(nthreads);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    std::shared_ptr<ChBody> boxes[2];
+    for (int i = 0; i < 2; i++) {
+        boxes[i] = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.3, 0.2, 1000, false, true, mat);
+        boxes[i]->SetFixed(true);
+        boxes[i]->SetPos(ChVector3d(-0.5, -0.4 + 0.8 * i, 0.15));
+        sys.AddBody(boxes[i]);
+    }
+
+    SCMTerrain terrain(&sys, false);
+    terrain.SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+    terrain.Initialize(3.0, 2.0, 0.02);
+
+    // Sink the boxes into the soil (at different rates), then drag them along the X direction
+    double step = 1e-3;
+    for (int i = 0; i < 200; i++) {
+        for (int j = 0; j < 2; j++) {
+            ChVector3d pos = boxes[j]->GetPos();
+            if (i < 100)
+                pos.z() -= (2 + j) * 1e-3;
+            else
+                pos.x() += 4e-3;
+            boxes[j]->SetPos(pos);
+        }
+        sys.DoStepDynamics(step);
+    }
+
+    ForcesResult result;
+    result.nodes = terrain.GetModifiedNodes(false);
+    for (int j = 0; j < 2; j++) {
+        bool in_contact = terrain.GetContactForceBody(boxes[j], result.force[j], result.torque[j]);
+        EXPECT_TRUE(in_contact);
+    }
+
+    return result;
+}
+
+TEST(SCMTerrain, contact_forces_threads) {
+    auto result_ref = Simulate(1);
+    auto result = Simulate(4);
+
+    // Nodes modified over the last step, in the same order
+    ASSERT_GT(result_ref.nodes.size(), 0u);
+    ASSERT_EQ(result.nodes.size(), result_ref.nodes.size());
+    for (size_t i = 0; i < result.nodes.size(); i++) {
+        ASSERT_EQ(result.nodes[i].first, result_ref.nodes[i].first);
+        ASSERT_EQ(result.nodes[i].second, result_ref.nodes[i].second);
+    }
+
+    // Soil reaction on the boxes
+    for (int j = 0; j < 2; j++) {
+        ASSERT_GT(result_ref.force[j].z(), 0.0);
+        double fscale = result_ref.force[j].Length();
+        double tscale = result_ref.torque[j].Length() + 1;
+        ASSERT_NEAR((result.force[j] - result_ref.force[j]).Length(), 0.0, 1e-10 * fscale);
+        ASSERT_NEAR((result.torque[j] - result_ref.torque[j]).Length(), 0.0, 1e-10 * tscale);
+    }
+}
@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the level-of-detail option in SCM deformable terrain.
+//
+// The same terrain profile (specified as a triangular mesh) is used to
+// initialize an SCM terrain with a single-resolution grid and one with a
+// coarse grid for the undeformed heights and visualization mesh. Initial
+// heights at the fine grid nodes must match at the coarse grid vertices and
+// be close elsewhere; the coarse visualization mesh must have fewer vertices.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+// Terrain profile over [-hsize, hsize] x [-hsize, hsize], with n x n cells
+std::shared_ptr<ChTriangleMeshConnected> CreateProfile(double hsize, int n) {
+    auto mesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+    auto& vertices = mesh->GetCoordsVertices();
+    auto& faces = mesh->GetIndicesVertexes();
+    double delta = 2 * hsize / n;
+    for (int iy = 0; iy <= n; iy++) {
+        for (int ix = 0; ix <= n; ix++) {
+            double x = -hsize + ix * delta;
+            double y = -hsize + iy * delta;
+            vertices.push_back(ChVector3d(x, y, 0.1 * std::sin(3 * x) * std::cos(2 * y) + 0.05 * x));
+        }
+    }
+    for (int iy = 0; iy < n; iy++) {
+        for (int ix = 0; ix < n; ix++) {
+            int v0 = ix + (n + 1) * iy;
+            faces.push_back(ChVector3i(v0, v0 + 1, v0 + n + 2));
+            faces.push_back(ChVector3i(v0, v0 + n + 2, v0 + n + 1));
+        }
+    }
+    return mesh;
+}
+
+TEST(SCMTerrain, level_of_detail) {
+    // Grid spacing and profile extent chosen so that both terrains have the same fine grid
+    double delta = 0.0625;
+    int lod = 4;
+    auto profile = CreateProfile(1 + delta, 32);
+
+    ChSystemSMC sys_ref;
+    sys_ref.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    SCMTerrain terrain_ref(&sys_ref);
+    terrain_ref.Initialize(*profile, delta);
+
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    SCMTerrain terrain(&sys);
+    terrain.SetLevelOfDetail(lod);
+    terrain.Initialize(*profile, delta);
+
+    // Coarse visualization mesh
+    int n = (int)std::round(1 / delta);
+    ASSERT_EQ(terrain_ref.GetMesh()->GetMesh()->GetNumVertices(), (unsigned int)((2 * n + 1) * (2 * n + 1)));
+    ASSERT_EQ(terrain.GetMesh()->GetMesh()->GetNumVertices(), (unsigned int)((2 * n / lod + 1) * (2 * n / lod + 1)));
+
+    // Initial heights at fine grid nodes
+    for (int i = -n; i <= n; i++) {
+        for (int j = -n; j <= n; j++) {
+            ChVector3d loc(i * delta, j * delta, 0);
+            double h_ref = terrain_ref.GetInitHeight(loc);
+            double h = terrain.GetInitHeight(loc);
+            if (i % lod == 0 && j % lod == 0)
+                ASSERT_NEAR(h, h_ref, 1e-10);
+            else
+                ASSERT_NEAR(h, h_ref, 2e-2);
+        }
+    }
+}
@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for paging of the SCM deformable terrain grid to disk.
+//
+// A box with prescribed motion is pushed into the soil, dragged along the
+// terrain over several grid tiles, and then dragged back over its own rut.
+// The simulation is run with and without tile paging (with a minimal memory
+// budget). The resulting terrain deformation must be identical, also when
+// queried concurrently from several threads, and the paging file must be
+// removed with the terrain.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+struct PagingResult {
+    std::vector<SCMTerrain::NodeLevel> nodes;
+    std::vector<double> heights;
+    int max_paged_tiles;
+    int num_resident_tiles[2];  // before and after height queries
+};
+
+PagingResult Simulate(const std::string& paging_file) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.3, 0.2, 1000, false, true, mat);
+    box->SetFixed(true);
+    box->SetPos(ChVector3d(-2.5, 0, 0.15));
+    sys.AddBody(box);
+
+    SCMTerrain terrain(&sys, false);
+    terrain.SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+    terrain.EnableBulldozing(true);
+    terrain.AddMovingPatch(box, VNULL, ChVector3d(0.6, 0.5, 0.5));
+    terrain.Initialize(6.0, 2.0, 0.02);
+
+    // Minimal memory budget (a single resident tile)
+    if (!paging_file.empty())
+        terrain.EnableTilePaging(paging_file, 1);
+
+    // Sink the box into the soil, drag it along the X direction, then drag it back
+    double step = 1e-3;
+    int max_paged_tiles = 0;
+    for (int i = 0; i < 1300; i++) {
+        ChVector3d pos = box->GetPos();
+        if (i < 100)
+            pos.z() -= 2e-3;
+        else if (i < 900)
+            pos.x() += 5e-3;
+        else
+            pos.x() -= 5e-3;
+        box->SetPos(pos);
+        sys.DoStepDynamics(step);
+        max_paged_tiles = std::max(max_paged_tiles, terrain.GetNumPagedTiles());
+    }
+
+    PagingResult result;
+    result.nodes = terrain.GetModifiedNodes(true);
+    result.max_paged_tiles = max_paged_tiles;
+
+    // Query the terrain height along the rut from several threads
+    result.num_resident_tiles[0] = terrain.GetNumResidentTiles();
+    int num_threads = 4;
+    int num_points = 1200;
+    result.heights.resize(num_points);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.push_back(std::thread([&terrain, &result, t, num_threads, num_points]() {
+            for (int k = t; k < num_points; k += num_threads)
+                result.heights[k] = terrain.GetHeight(ChVector3d(-3.0 + k * 0.005, 0, 1));
+        }));
+    }
+    for (auto& thread : threads)
+        thread.join();
+    result.num_resident_tiles[1] = terrain.GetNumResidentTiles();
+
+    std::sort(result.nodes.begin(), result.nodes.end(),
+              [](const SCMTerrain::NodeLevel& a, const SCMTerrain::NodeLevel& b) {
+                  return a.first.x() < b.first.x() || (a.first.x() == b.first.x() && a.first.y() < b.first.y());
+              });
+
+    return result;
+}
+
+TEST(SCMTerrain, tile_paging) {
+    std::string paging_file = "utest_VEH_SCM_paging.dat";
+
+    auto result_ref = Simulate("");
+    auto result = Simulate(paging_file);
+
+    // The paging file is removed with the terrain
+    ASSERT_FALSE(std::ifstream(paging_file).good());
+
+    ASSERT_EQ(result_ref.max_paged_tiles, 0);
+    ASSERT_GT(result.max_paged_tiles, 0);
+
+    // Height queries do not page in tiles
+    ASSERT_EQ(result.num_resident_tiles[1], result.num_resident_tiles[0]);
+    for (size_t i = 0; i < result.heights.size(); i++)
+        ASSERT_EQ(result.heights[i], result_ref.heights[i]);
+
+    ASSERT_GT(result_ref.nodes.size(), 0u);
+    ASSERT_EQ(result.nodes.size(), result_ref.nodes.size());
+    for (size_t i = 0; i < result.nodes.size(); i++) {
+        ASSERT_EQ(result.nodes[i].first, result_ref.nodes[i].first);
+        ASSERT_EQ(result.nodes[i].second, result_ref.nodes[i].second);
+    }
+}
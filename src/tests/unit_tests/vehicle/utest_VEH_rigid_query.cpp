@@ -0,0 +1,79 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the precomputed query index of RigidTerrain mesh patches.
+//
+// The same mesh patch (offset from the global origin) is queried at random
+// locations using ray casting into the collision system and using the mesh
+// query index. Hit flags, terrain heights, and terrain normals must match.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChRandom.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+void CreateTerrain(ChSystemSMC& sys, RigidTerrain& terrain, bool indexed) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    ChCoordsys<> pos(ChVector3d(1, -2, 0.5), QuatFromAngleZ(0.3));
+    terrain.UseMeshQueryIndex(indexed);
+    terrain.AddPatch(mat, pos, vehicle::GetDataFile("terrain/meshes/test_patch.obj"), true, 0, false);
+    terrain.Initialize();
+    sys.GetCollisionSystem()->Initialize();
+}
+
+TEST(RigidTerrain, mesh_query_index) {
+    ChSystemSMC sys_ref;
+    RigidTerrain terrain_ref(&sys_ref);
+    CreateTerrain(sys_ref, terrain_ref, false);
+
+    ChSystemSMC sys;
+    RigidTerrain terrain(&sys);
+    CreateTerrain(sys, terrain, true);
+
+    // Random query locations, some of them outside the patch and some below the patch surface
+    ChUniformDistribution x_dist(-30, 10);
+    ChUniformDistribution y_dist(-10, 50);
+    ChUniformDistribution z_dist(-1, 15);
+
+    int num_hits = 0;
+    for (int i = 0; i < 2000; i++) {
+        ChVector3d loc(x_dist.GetRandom(), y_dist.GetRandom(), z_dist.GetRandom());
+
+        double height_ref, height;
+        ChVector3d normal_ref, normal;
+        float friction_ref, friction;
+        bool hit_ref = terrain_ref.FindPoint(loc, height_ref, normal_ref, friction_ref);
+        bool hit = terrain.FindPoint(loc, height, normal, friction);
+
+        ASSERT_EQ(hit, hit_ref);
+        if (!hit_ref)
+            continue;
+
+        num_hits++;
+        ASSERT_NEAR(height, height_ref, 1e-6);
+        ASSERT_NEAR(Vdot(normal, normal_ref), 1.0, 1e-6);
+    }
+
+    ASSERT_GT(num_hits, 0);
+}
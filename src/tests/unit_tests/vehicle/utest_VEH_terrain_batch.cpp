@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for batched terrain queries.
+//
+// Terrain properties at a set of random locations are evaluated with one call
+// to GetPropertiesBatch and GetHeightBatch (multithreaded, where supported)
+// and with individual calls to GetProperties and GetHeight. The results must
+// be identical.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChRandom.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+class FrictionFunctor : public ChTerrain::FrictionFunctor {
+  public:
+    virtual float operator()(const ChVector3d& loc) override { return loc.x() > 0 ? 0.9f : 0.6f; }
+};
+
+void CheckBatch(const ChTerrain& terrain, double xmin, double xmax, double ymin, double ymax) {
+    ChUniformDistribution x_dist(xmin, xmax);
+    ChUniformDistribution y_dist(ymin, ymax);
+    ChUniformDistribution z_dist(0, 5);
+    std::vector<ChVector3d> locs(500);
+    for (auto& loc : locs)
+        loc = ChVector3d(x_dist.GetRandom(), y_dist.GetRandom(), z_dist.GetRandom());
+
+    std::vector<double> heights;
+    std::vector<ChVector3d> normals;
+    std::vector<float> frictions;
+    std::vector<double> heights_only;
+    terrain.GetPropertiesBatch(locs, heights, normals, frictions);
+    terrain.GetHeightBatch(locs, heights_only);
+
+    ASSERT_EQ(heights.size(), locs.size());
+    ASSERT_EQ(heights_only.size(), locs.size());
+    ASSERT_EQ(normals.size(), locs.size());
+    ASSERT_EQ(frictions.size(), locs.size());
+    for (size_t k = 0; k < locs.size(); k++) {
+        double height;
+        ChVector3d normal;
+        float friction;
+        terrain.GetProperties(locs[k], height, normal, friction);
+        ASSERT_EQ(heights[k], height);
+        ASSERT_EQ(heights_only[k], terrain.GetHeight(locs[k]));
+        ASSERT_EQ(normals[k], normal);
+        ASSERT_EQ(frictions[k], friction);
+    }
+}
+
+TEST(ChTerrain, batch_flat) {
+    FlatTerrain terrain(0.5, 0.7f);
+    CheckBatch(terrain, -5, 5, -5, 5);
+
+    terrain.RegisterFrictionFunctor(chrono_types::make_shared<FrictionFunctor>());
+    CheckBatch(terrain, -5, 5, -5, 5);
+}
+
+TEST(ChTerrain, batch_rigid) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetNumThreads(4);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    RigidTerrain terrain(&sys);
+    terrain.UseMeshQueryIndex(true);
+    terrain.AddPatch(mat, ChCoordsys<>(ChVector3d(10, 20, -0.5)), 20, 40, 1, false, 1, false);
+    terrain.AddPatch(mat, ChCoordsys<>(), vehicle::GetDataFile("terrain/meshes/test_patch.obj"), true, 0, false);
+    terrain.Initialize();
+    sys.GetCollisionSystem()->Initialize();
+
+    CheckBatch(terrain, -25, 25, -5, 45);
+}
+
+TEST(ChTerrain, batch_scm) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetNumThreads(4);
+
+    // Terrain profile over [-2, 2] x [-2, 2]
+    int n = 40;
+    double delta = 0.1;
+    ChTriangleMeshConnected profile;
+    for (int iy = 0; iy <= n; iy++) {
+        for (int ix = 0; ix <= n; ix++) {
+            double x = -2 + ix * delta;
+            double y = -2 + iy * delta;
+            profile.GetCoordsVertices().push_back(ChVector3d(x, y, 0.1 * std::sin(3 * x) * std::cos(2 * y)));
+        }
+    }
+    for (int iy = 0; iy < n; iy++) {
+        for (int ix = 0; ix < n; ix++) {
+            int v0 = ix + (n + 1) * iy;
+            profile.GetIndicesVertexes().push_back(ChVector3i(v0, v0 + 1, v0 + n + 2));
+            profile.GetIndicesVertexes().push_back(ChVector3i(v0, v0 + n + 2, v0 + n + 1));
+        }
+    }
+
+    SCMTerrain terrain(&sys, false);
+    terrain.RegisterFrictionFunctor(chrono_types::make_shared<FrictionFunctor>());
+    terrain.Initialize(profile, 0.05);
+
+    CheckBatch(terrain, -1.8, 1.8, -1.8, 1.8);
+}